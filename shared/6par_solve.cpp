@@ -0,0 +1,219 @@
+/*
+BSD 3-Clause License
+
+Copyright (c) Alliance for Sustainable Energy, LLC. See also https://github.com/NREL/ssc/blob/develop/LICENSE
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+   contributors may be used to endorse or promote products derived from
+   this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <thread>
+#include <tuple>
+
+#include "6par_solve.h"
+
+static const char *cache_file_header = "6par_cache 1";
+
+bool module6par_cache::key::operator<( const key &rhs ) const
+{
+	return std::tie( type, nser, max_iter, vmp, imp, voc, isc, bvoc, aisc, gpmp, tref, tol )
+		< std::tie( rhs.type, rhs.nser, rhs.max_iter, rhs.vmp, rhs.imp, rhs.voc, rhs.isc, rhs.bvoc, rhs.aisc, rhs.gpmp, rhs.tref, rhs.tol );
+}
+
+module6par_cache::key module6par_cache::make_key( const module6par &m, int max_iter, double tol )
+{
+	key k;
+	k.type = m.Type;
+	k.nser = m.Nser;
+	k.max_iter = max_iter;
+	k.vmp = m.Vmp;
+	k.imp = m.Imp;
+	k.voc = m.Voc;
+	k.isc = m.Isc;
+	k.bvoc = m.bVoc;
+	k.aisc = m.aIsc;
+	k.gpmp = m.gPmp;
+	k.tref = m.Tref;
+	k.tol = tol;
+	return k;
+}
+
+module6par_cache &module6par_cache::instance()
+{
+	static module6par_cache cache;
+	return cache;
+}
+
+bool module6par_cache::lookup( module6par &m, int max_iter, double tol, int *err )
+{
+	std::lock_guard<std::mutex> lock( m_mutex );
+	std::map< key, entry >::const_iterator it = m_entries.find( make_key( m, max_iter, tol ) );
+	if ( it == m_entries.end() )
+		return false;
+
+	const entry &e = it->second;
+	m.Type = e.type;
+	m.a = e.a;
+	m.Il = e.Il;
+	m.Io = e.Io;
+	m.Rs = e.Rs;
+	m.Rsh = e.Rsh;
+	m.Adj = e.Adj;
+	if ( err ) *err = e.err;
+	return true;
+}
+
+void module6par_cache::store( const module6par &inputs, const module6par &solved, int max_iter, double tol, int err )
+{
+	entry e;
+	e.err = err;
+	e.type = solved.Type;
+	e.a = solved.a;
+	e.Il = solved.Il;
+	e.Io = solved.Io;
+	e.Rs = solved.Rs;
+	e.Rsh = solved.Rsh;
+	e.Adj = solved.Adj;
+
+	std::lock_guard<std::mutex> lock( m_mutex );
+	m_entries[ make_key( inputs, max_iter, tol ) ] = e;
+	m_modified = true;
+}
+
+bool module6par_cache::load( const std::string &file )
+{
+	std::lock_guard<std::mutex> lock( m_mutex );
+	if ( m_loaded.count( file ) )
+		return true;
+	m_loaded.insert( file );
+
+	if ( !util::file_exists( file.c_str() ) )
+		return true; // nothing solved yet
+
+	util::stdfile fp( file, "r" );
+	if ( !fp.ok() )
+		return false;
+
+	std::string line;
+	if ( !util::read_line( fp, line ) || line != cache_file_header )
+		return false;
+
+	while ( util::read_line( fp, line ) )
+	{
+		key k;
+		entry e;
+		// %lg round trips the %.17g written by save()
+		if ( sscanf( line.c_str(), "%d %d %d %lg %lg %lg %lg %lg %lg %lg %lg %lg %d %d %lg %lg %lg %lg %lg %lg",
+				&k.type, &k.nser, &k.max_iter, &k.vmp, &k.imp, &k.voc, &k.isc, &k.bvoc, &k.aisc, &k.gpmp, &k.tref, &k.tol,
+				&e.err, &e.type, &e.a, &e.Il, &e.Io, &e.Rs, &e.Rsh, &e.Adj ) == 20 )
+			m_entries.insert( std::make_pair( k, e ) );
+	}
+	return true;
+}
+
+bool module6par_cache::save( const std::string &file )
+{
+	std::lock_guard<std::mutex> lock( m_mutex );
+	if ( !m_modified )
+		return true;
+
+	util::stdfile fp( file, "w" );
+	if ( !fp.ok() )
+		return false;
+
+	fprintf( fp, "%s\n", cache_file_header );
+	for ( std::map< key, entry >::const_iterator it = m_entries.begin(); it != m_entries.end(); ++it )
+	{
+		const key &k = it->first;
+		const entry &e = it->second;
+		fprintf( fp, "%d %d %d %.17g %.17g %.17g %.17g %.17g %.17g %.17g %.17g %.17g %d %d %.17g %.17g %.17g %.17g %.17g %.17g\n",
+			k.type, k.nser, k.max_iter, k.vmp, k.imp, k.voc, k.isc, k.bvoc, k.aisc, k.gpmp, k.tref, k.tol,
+			e.err, e.type, e.a, e.Il, e.Io, e.Rs, e.Rsh, e.Adj );
+	}
+	m_modified = false;
+	return true;
+}
+
+size_t module6par_cache::size()
+{
+	std::lock_guard<std::mutex> lock( m_mutex );
+	return m_entries.size();
+}
+
+void module6par_cache::clear()
+{
+	std::lock_guard<std::mutex> lock( m_mutex );
+	m_entries.clear();
+	m_loaded.clear();
+	m_modified = false;
+}
+
+int module6par_solve_cached( module6par &m, int max_iter, double tol, module6par_cache *cache )
+{
+	int err = 0;
+	if ( cache && cache->lookup( m, max_iter, tol, &err ) )
+		return err;
+
+	module6par inputs( m );
+	err = m.solve_with_sanity_and_heuristics<double>( max_iter, tol );
+	if ( cache )
+		cache->store( inputs, m, max_iter, tol, err );
+	return err;
+}
+
+std::vector<int> module6par_solve_batch( std::vector<module6par> &modules, int max_iter, double tol, int n_threads, module6par_cache *cache )
+{
+	std::vector<int> errors( modules.size(), 0 );
+	if ( modules.empty() )
+		return errors;
+
+	if ( n_threads <= 0 )
+		n_threads = std::max( 1, (int)std::thread::hardware_concurrency() );
+	n_threads = std::min( n_threads, (int)modules.size() );
+
+	// the solver has no shared state, so modules are simply handed out to the workers in turn
+	std::atomic<size_t> next( 0 );
+	auto run = [&]()
+	{
+		for ( size_t i = next++; i < modules.size(); i = next++ )
+			errors[i] = module6par_solve_cached( modules[i], max_iter, tol, cache );
+	};
+
+	if ( n_threads == 1 )
+		run();
+	else
+	{
+		std::vector<std::thread> workers;
+		for ( int t = 0; t < n_threads; t++ )
+			workers.emplace_back( run );
+		for ( size_t t = 0; t < workers.size(); t++ )
+			workers[t].join();
+	}
+	return errors;
+}
@@ -34,6 +34,12 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #ifndef __6_PAR_SOLVE_H__
 #define __6_PAR_SOLVE_H__
 
+#include <map>
+#include <mutex>
+#include <set>
+#include <string>
+#include <vector>
+
 #include "6par_gamma.h"
 #include "6par_newton.h"
 #include "lib_util.h"
@@ -539,4 +545,53 @@ public:
 
 };
 
+/* Solved coefficients keyed by the datasheet inputs and solver settings. The process-wide instance is
+   consulted by module6par_solve_cached, and can be loaded from and saved to a text file so that a module
+   library only has to be solved once. All members are safe to call from several threads. */
+class module6par_cache
+{
+public:
+	static module6par_cache &instance();
+
+	// on a hit, sets the coefficients (and the technology the heuristics settled on) and the error code
+	bool lookup( module6par &m, int max_iter, double tol, int *err );
+	void store( const module6par &inputs, const module6par &solved, int max_iter, double tol, int err );
+
+	// merges the entries of a file, once per file; returns false if it exists but cannot be read
+	bool load( const std::string &file );
+	// writes all entries if any were added since the last load or save
+	bool save( const std::string &file );
+
+	size_t size();
+	void clear();
+
+private:
+	module6par_cache() : m_modified(false) { }
+
+	struct key
+	{
+		int type, nser, max_iter;
+		double vmp, imp, voc, isc, bvoc, aisc, gpmp, tref, tol;
+		bool operator<( const key &rhs ) const;
+	};
+	struct entry
+	{
+		int err, type;
+		double a, Il, Io, Rs, Rsh, Adj;
+	};
+	static key make_key( const module6par &m, int max_iter, double tol );
+
+	std::map< key, entry > m_entries;
+	std::set< std::string > m_loaded;
+	bool m_modified;
+	std::mutex m_mutex;
+};
+
+// solve_with_sanity_and_heuristics<double>, answered from the cache when it has seen the same inputs
+int module6par_solve_cached( module6par &m, int max_iter, double tol, module6par_cache *cache = &module6par_cache::instance() );
+
+// solves every module on n_threads workers (0 uses all hardware threads), returning the error code of each
+std::vector<int> module6par_solve_batch( std::vector<module6par> &modules, int max_iter, double tol, int n_threads = 0,
+	module6par_cache *cache = &module6par_cache::instance() );
+
 #endif
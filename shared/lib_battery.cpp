@@ -522,11 +522,12 @@ double battery_t::calculate_max_charge_kw(double *max_current_A) {
     double power_W = 0;
     double current = 0;
     size_t its = 0;
-    while (std::abs(power_W - voltage->calculate_max_charge_w(q, qmax, thermal->T_battery(), &current)) > tolerance
-           && its++ < 10) {
-        power_W = voltage->calculate_max_charge_w(q, qmax, thermal->T_battery(), &current);
+    double max_W = voltage->calculate_max_charge_w(q, qmax, thermal->T_battery(), &current);
+    while (std::abs(power_W - max_W) > tolerance && its++ < 10) {
+        power_W = max_W;
         thermal->updateTemperature(current, state->last_idx + 1);
         qmax = capacity->qmax() * thermal->capacity_percent() * 0.01 * SOC_ratio;
+        max_W = voltage->calculate_max_charge_w(q, qmax, thermal->T_battery(), &current);
     }
     if (max_current_A)
         *max_current_A = current;
@@ -541,11 +542,12 @@ double battery_t::calculate_max_discharge_kw(double *max_current_A) {
     double power_W = 0;
     double current = 0;
     size_t its = 0;
-    while (std::abs(power_W - voltage->calculate_max_discharge_w(q, qmax, thermal->T_battery(), &current)) > tolerance
-           && its++ < 5) {
-        power_W = voltage->calculate_max_discharge_w(q, qmax, thermal->T_battery(), &current);
+    double max_W = voltage->calculate_max_discharge_w(q, qmax, thermal->T_battery(), &current);
+    while (std::abs(power_W - max_W) > tolerance && its++ < 5) {
+        power_W = max_W;
         thermal->updateTemperature(current, state->last_idx + 1);
         qmax = capacity->qmax() * thermal->capacity_percent()  * 0.01;
+        max_W = voltage->calculate_max_discharge_w(q, qmax, thermal->T_battery(), &current);
     }
     if (max_current_A)
         *max_current_A = current;
@@ -783,6 +785,85 @@ void battery_t::set_state(const battery_state& tmp_state) {
     *state = tmp_state;
 }
 
+void battery_t::save_checkpoint(battery_checkpoint &cp) {
+    cp.last_idx = state->last_idx;
+    cp.V = state->V;
+    cp.Q = state->Q;
+    cp.Q_max = state->Q_max;
+    cp.I = state->I;
+    cp.I_dischargeable = state->I_dischargeable;
+    cp.I_chargeable = state->I_chargeable;
+    cp.P = state->P;
+    cp.P_dischargeable = state->P_dischargeable;
+    cp.P_chargeable = state->P_chargeable;
+
+    cp.capacity = *state->capacity;
+    cp.voltage = *state->voltage;
+    cp.thermal = *state->thermal;
+    cp.losses = *state->losses;
+
+    lifetime_state &life = *state->lifetime;
+    cp.q_relative = life.q_relative;
+    cp.n_cycles = life.n_cycles;
+    cp.cycle_range = life.cycle_range;
+    cp.cycle_DOD = life.cycle_DOD;
+    cp.average_range = life.average_range;
+    cp.day_age_of_battery = life.day_age_of_battery;
+    cp.cycle = *life.cycle;
+    cp.has_calendar = life.calendar != nullptr;
+    if (cp.has_calendar)
+        cp.calendar = *life.calendar;
+    cp.has_nmc = life.nmc_li_neg != nullptr;
+    if (cp.has_nmc)
+        cp.nmc_li_neg = *life.nmc_li_neg;
+    cp.has_lmolto = life.lmo_lto != nullptr;
+    if (cp.has_lmolto)
+        cp.lmo_lto = *life.lmo_lto;
+
+    cp.replacement = *state->replacement;
+}
+
+void battery_t::restore_checkpoint(const battery_checkpoint &cp) {
+    state->last_idx = cp.last_idx;
+    state->V = cp.V;
+    state->Q = cp.Q;
+    state->Q_max = cp.Q_max;
+    state->I = cp.I;
+    state->I_dischargeable = cp.I_dischargeable;
+    state->I_chargeable = cp.I_chargeable;
+    state->P = cp.P;
+    state->P_dischargeable = cp.P_dischargeable;
+    state->P_chargeable = cp.P_chargeable;
+
+    *state->capacity = cp.capacity;
+    *state->voltage = cp.voltage;
+    *state->thermal = cp.thermal;
+    *state->losses = cp.losses;
+
+    lifetime_state &life = *state->lifetime;
+    life.q_relative = cp.q_relative;
+    life.n_cycles = cp.n_cycles;
+    life.cycle_range = cp.cycle_range;
+    life.cycle_DOD = cp.cycle_DOD;
+    life.average_range = cp.average_range;
+    life.day_age_of_battery = cp.day_age_of_battery;
+    *life.cycle = cp.cycle;
+    if (cp.has_calendar) {
+        if (!life.calendar) life.calendar = std::make_shared<calendar_state>();
+        *life.calendar = cp.calendar;
+    }
+    if (cp.has_nmc) {
+        if (!life.nmc_li_neg) life.nmc_li_neg = std::make_shared<lifetime_nmc_state>();
+        *life.nmc_li_neg = cp.nmc_li_neg;
+    }
+    if (cp.has_lmolto) {
+        if (!life.lmo_lto) life.lmo_lto = std::make_shared<lifetime_lmolto_state>();
+        *life.lmo_lto = cp.lmo_lto;
+    }
+
+    *state->replacement = cp.replacement;
+}
+
 void battery_t::update_state(double I) {
     state->I = I;
     state->Q = capacity->q0();
@@ -281,6 +281,46 @@ struct battery_state {
     friend std::ostream &operator<<(std::ostream &os, const battery_state &p);
 };
 
+/*
+Checkpoint of the mutable battery state for rolling back dispatch iterations. Saving and restoring copy field by field
+into the live state, without the temporary battery_state of get_state/set_state. The cycle-counting vectors are copied
+into buffers owned by the checkpoint that keep their capacity, so after the first few steps a save/restore does not allocate
+*/
+struct battery_checkpoint {
+    size_t last_idx;
+    double V;
+    double Q;
+    double Q_max;
+    double I;
+    double I_dischargeable;
+    double I_chargeable;
+    double P;
+    double P_dischargeable;
+    double P_chargeable;
+
+    capacity_state capacity;
+    voltage_state voltage;
+    thermal_state thermal;
+    losses_state losses;
+
+    // lifetime_state scalars and the sub-states present for the lifetime model
+    double q_relative;
+    int n_cycles;
+    double cycle_range;
+    double cycle_DOD;
+    double average_range;
+    double day_age_of_battery;
+    cycle_state cycle;
+    bool has_calendar;
+    calendar_state calendar;
+    bool has_nmc;
+    lifetime_nmc_state nmc_li_neg;
+    bool has_lmolto;
+    lifetime_lmolto_state lmo_lto;
+
+    replacement_state replacement;
+};
+
 struct battery_params {
     enum CHEM {
         LEAD_ACID, LITHIUM_ION, VANADIUM_REDOX, IRON_FLOW
@@ -417,6 +457,11 @@ public:
 
     void set_state(const battery_state& state);
 
+    // equivalent to get_state/set_state for rollback within a time step, see battery_checkpoint
+    void save_checkpoint(battery_checkpoint &cp);
+
+    void restore_checkpoint(const battery_checkpoint &cp);
+
 private:
     std::unique_ptr<capacity_t> capacity;
     std::unique_ptr<thermal_t> thermal;
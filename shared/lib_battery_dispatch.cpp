@@ -67,6 +67,7 @@ dispatch_t::dispatch_t(battery_t* Battery, double dt_hour, double SOC_min, doubl
     // initalize Battery and a copy of the Battery for iteration
     _Battery = Battery;
     _Battery_initial = new battery_t(*_Battery);
+    _Battery->save_checkpoint(_Battery_checkpoint);
 
     m_outage_manager = std::unique_ptr<outage_manager>(new outage_manager(m_batteryPower, _Battery));
     _min_outage_soc = SOC_min_outage;
@@ -105,6 +106,7 @@ dispatch_t::dispatch_t(const dispatch_t& dispatch)
 
     _Battery = new battery_t(*dispatch._Battery);
     _Battery_initial = new battery_t(*dispatch._Battery_initial);
+    _Battery_checkpoint = dispatch._Battery_checkpoint;
 
     _min_outage_soc = dispatch._min_outage_soc;
     m_outage_manager = std::unique_ptr<outage_manager>(new outage_manager(m_batteryPower, _Battery));
@@ -117,6 +119,7 @@ void dispatch_t::copy(const dispatch_t* dispatch)
 {
     _Battery->set_state(dispatch->_Battery->get_state());
     _Battery_initial->set_state(dispatch->_Battery_initial->get_state());
+    _Battery_checkpoint = dispatch->_Battery_checkpoint;
     init(_Battery, dispatch->_dt_hour, dispatch->_current_choice, dispatch->_t_min, dispatch->_mode);
 
     // can't create shallow copy of unique ptr
@@ -146,7 +149,7 @@ dispatch_t::~dispatch_t()
 }
 void dispatch_t::finalize(size_t idx, double& I)
 {
-	_Battery->set_state(_Battery_initial->get_state());
+	_Battery->restore_checkpoint(_Battery_checkpoint);
 	m_batteryPower->powerBatteryDC = 0;
 	m_batteryPower->powerBatteryAC = 0;
 	m_batteryPower->powerGridToBattery = 0;
@@ -270,7 +273,7 @@ bool dispatch_t::check_constraints(double& I, size_t count)
     // reset
     if (iterate)
     {
-        _Battery->set_state(_Battery_initial->get_state());
+        _Battery->restore_checkpoint(_Battery_checkpoint);
         m_batteryPowerFlow->calculate();
     }
 
@@ -427,7 +430,8 @@ void dispatch_t::runDispatch(size_t lifetimeIndex)
     double I = current_controller(m_batteryPower->powerBatteryDC);
 
     // Setup battery iteration
-    _Battery_initial->set_state(_Battery->get_state());
+    _Battery->save_checkpoint(_Battery_checkpoint);
+    _Battery_initial->restore_checkpoint(_Battery_checkpoint);
 
     bool iterate = true;
     size_t count = 0;
@@ -448,7 +452,7 @@ void dispatch_t::runDispatch(size_t lifetimeIndex)
             m_batteryPower->powerBatteryDC = I * _Battery->V() * util::watt_to_kilowatt;
         }
         else {
-            _Battery->set_state(_Battery_initial->get_state());
+            _Battery->restore_checkpoint(_Battery_checkpoint);
         }
         count++;
 
@@ -488,7 +492,7 @@ void dispatch_t::dispatch_dc_outage_step(size_t lifetimeIndex) {
     double batt_losses = _Battery->calculate_loss(max_charge_kwdc, lifetimeIndex);
 
     // Setup battery iteration
-    auto Battery_initial = _Battery->get_state();
+    _Battery->save_checkpoint(_Battery_outage_checkpoint);
 
     if ((pv_kwac - batt_losses) * (1 - ac_loss_percent) > crit_load_kwac) {
         double remaining_kwdc = -(pv_kwac * (1 - ac_loss_percent) - crit_load_kwac) / dc_ac_eff + pv_clipped;
@@ -499,7 +503,7 @@ void dispatch_t::dispatch_dc_outage_step(size_t lifetimeIndex) {
         double dc_input = pv_kwdc + remaining_kwdc;
         double est_crit_load_unmet = m_batteryPower->powerCritLoadUnmet;
         while (m_batteryPower->powerCritLoadUnmet > tolerance) {
-            _Battery->set_state(Battery_initial);
+            _Battery->restore_checkpoint(_Battery_outage_checkpoint);
             dc_input = pv_kwdc + remaining_kwdc + (m_batteryPower->powerCritLoadUnmet) / dc_ac_eff;
             // remaining_kw_dc is a negative number, so add it to pv_kwdc to reduce inverter dc power
             m_batteryPower->sharedInverter->calculateACPower(dc_input, V_pv, m_batteryPower->sharedInverter->Tdry_C);
@@ -532,7 +536,7 @@ void dispatch_t::dispatch_dc_outage_step(size_t lifetimeIndex) {
                     if (m_batteryPower->powerCritLoadUnmet < tolerance)
                         break;
                     discharge_kwdc *= 1.01;
-                    _Battery->set_state(Battery_initial);
+                    _Battery->restore_checkpoint(_Battery_outage_checkpoint);
                     m_batteryPower->powerBatteryTarget = discharge_kwdc;
                     m_batteryPower->powerBatteryDC = discharge_kwdc;
                     runDispatch(lifetimeIndex);
@@ -576,7 +580,7 @@ void dispatch_t::dispatch_ac_outage_step(size_t lifetimeIndex) {
             double discharge_kwdc = required_kwdc;
 
             // iterate in case the dispatched power is slightly less (by tolerance) than required
-            auto Battery_initial = _Battery->get_state();
+            _Battery->save_checkpoint(_Battery_outage_checkpoint);
             m_batteryPower->powerBatteryTarget = discharge_kwdc;
             m_batteryPower->powerBatteryDC = discharge_kwdc;
             runDispatch(lifetimeIndex);
@@ -585,7 +589,7 @@ void dispatch_t::dispatch_ac_outage_step(size_t lifetimeIndex) {
                     if (m_batteryPower->powerCritLoadUnmet < tolerance)
                         break;
                     discharge_kwdc *= 1.01;
-                    _Battery->set_state(Battery_initial);
+                    _Battery->restore_checkpoint(_Battery_outage_checkpoint);
                     m_batteryPower->powerBatteryTarget = discharge_kwdc;
                     m_batteryPower->powerBatteryDC = discharge_kwdc;
                     runDispatch(lifetimeIndex);
@@ -673,6 +677,7 @@ dispatch_automatic_t::dispatch_automatic_t(
     _forecast_hours = look_ahead_hours;
     _steps_per_hour = (size_t)(1. / dt_hour);
     _num_steps = 24 * _steps_per_hour;
+    _cliploss_window.set_width(_forecast_hours * _steps_per_hour);
 
 	_day_index = 0;
 	_month = 1;
@@ -710,6 +715,7 @@ void dispatch_automatic_t::init_with_pointer(const dispatch_automatic_t* tmp)
     _weather_forecast_mode = tmp->_weather_forecast_mode;
 	_safety_factor = tmp->_safety_factor;
 	_forecast_hours = tmp->_forecast_hours;
+    _cliploss_window.set_width(_forecast_hours * _steps_per_hour);
     m_battReplacementCostPerKWH = tmp->m_battReplacementCostPerKWH;
     m_battCycleCostChoice = tmp->m_battCycleCostChoice;
     m_cycleCost = tmp->m_cycleCost;
@@ -738,6 +744,7 @@ void dispatch_automatic_t::update_pv_data(std::vector<double> P_pv_ac){ _P_pv_ac
 void dispatch_automatic_t::update_cliploss_data(double_vec P_cliploss)
 {
     _P_cliploss_dc = P_cliploss;
+    _cliploss_window.reset();
 
     // append to end to allow for look-ahead
     for (size_t i = 0; i != _forecast_hours * _steps_per_hour; i++)
@@ -901,7 +908,7 @@ bool dispatch_automatic_t::check_constraints(double& I, size_t count)
         // reset
         if (iterate)
         {
-            _Battery->set_state(_Battery_initial->get_state());
+            _Battery->restore_checkpoint(_Battery_checkpoint);
             //			m_batteryPower->powerBatteryAC = 0;
             //			m_batteryPower->powerGridToBattery = 0;
             //			m_batteryPower->powerBatteryToGrid = 0;
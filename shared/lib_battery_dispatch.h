@@ -178,6 +178,10 @@ protected:
 	battery_t * _Battery;
 	battery_t * _Battery_initial;
 
+	// state of _Battery_initial, restored into _Battery on each constraint iteration
+	battery_checkpoint _Battery_checkpoint;
+	battery_checkpoint _Battery_outage_checkpoint;
+
 	double _dt_hour;
 
 	/**
@@ -379,6 +383,9 @@ protected:
     /*! Full clipping loss due to AC power limits vector [kW] */
     double_vec _P_cliploss_dc;
 
+    /*! Look-ahead window of _P_cliploss_dc, advanced with the dispatch */
+    util::sliding_window _cliploss_window;
+
 	/*! The index of the current day (hour * steps_per_hour + step) */
 	size_t _day_index;
 
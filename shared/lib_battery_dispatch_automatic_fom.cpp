@@ -105,7 +105,7 @@ void dispatch_automatic_front_of_meter_t::init_with_pointer(const dispatch_autom
 	_forecast_hours = tmp->_forecast_hours;
 	_inverter_paco = tmp->_inverter_paco;
 	_forecast_price_rt_series = tmp->_forecast_price_rt_series;
-    ppa_prices = tmp->ppa_prices;
+    ppa_price_window = tmp->ppa_price_window;
 
     discharge_hours = tmp->discharge_hours;
 	m_etaPVCharge = tmp->m_etaPVCharge;
@@ -133,7 +133,9 @@ void dispatch_automatic_front_of_meter_t::setup_cost_forecast_vector()
 	}
 	_forecast_price_rt_series = ppa_price_series;
 
-    ppa_prices.reserve(_forecast_hours * _steps_per_hour);
+    ppa_price_window.set_width(_forecast_hours * _steps_per_hour);
+    // look behind limits _forecast_hours after the base class sized the clipping window
+    _cliploss_window.set_width(_forecast_hours * _steps_per_hour);
     if (discharge_hours >= _forecast_hours * _steps_per_hour) {
         // -1 for 0 indexed arrays, additional -1 to ensure there is always a charging price lower than the discharing price if the forecast hours is = to battery capacity in hours
         // exception caused if look_ahead_hours <= 1 and _steps_per_hour =1 ). specifically, size_t extremely large if set to negative integer - see SAM issue 1547
@@ -194,13 +196,11 @@ void dispatch_automatic_front_of_meter_t::update_dispatch(size_t year, size_t ho
         // Compute forecast variables
         size_t idx_lookahead = _forecast_hours * _steps_per_hour;
 
-        ppa_prices.clear();
-        std::copy(_forecast_price_rt_series.begin() + lifetimeIndex, _forecast_price_rt_series.begin() + lifetimeIndex + idx_lookahead, std::back_inserter(ppa_prices));
-        std::sort(ppa_prices.begin(), ppa_prices.end());
-        auto max_ppa_cost = std::max_element(_forecast_price_rt_series.begin() + lifetimeIndex, _forecast_price_rt_series.begin() + lifetimeIndex + idx_lookahead);
-        auto min_ppa_cost = std::min_element(_forecast_price_rt_series.begin() + lifetimeIndex, _forecast_price_rt_series.begin() + lifetimeIndex + idx_lookahead);
-        auto charge_ppa_cost = ppa_prices[discharge_hours];
-        auto discharge_ppa_cost = ppa_prices[ppa_prices.size() - discharge_hours - 1]; 
+        ppa_price_window.update(_forecast_price_rt_series, lifetimeIndex);
+        double max_ppa_cost = ppa_price_window.max();
+        double min_ppa_cost = ppa_price_window.min();
+        double charge_ppa_cost = ppa_price_window.nth_smallest(discharge_hours);
+        double discharge_ppa_cost = ppa_price_window.nth_largest(discharge_hours);
         double ppa_cost = _forecast_price_rt_series[lifetimeIndex];
 
         /*! Cost to purchase electricity from the utility */
@@ -219,31 +219,25 @@ void dispatch_automatic_front_of_meter_t::update_dispatch(size_t year, size_t ho
         // Compute forecast variables which potentially do change from year to year
         double energyToStoreClipped = 0;
         if (_P_cliploss_dc.size() > lifetimeIndex + _forecast_hours) {
-            energyToStoreClipped = std::accumulate(_P_cliploss_dc.begin() + lifetimeIndex, _P_cliploss_dc.begin() + lifetimeIndex + _forecast_hours * _steps_per_hour, 0.0) * _dt_hour;
+            _cliploss_window.update(_P_cliploss_dc, lifetimeIndex);
+            energyToStoreClipped = _cliploss_window.sum() * _dt_hour;
         }
 
         /*! Economic benefit of charging from the grid in current time step to discharge sometime in next X hours ($/kWh)*/
-        revenueToGridCharge = *max_ppa_cost * m_etaDischarge - usage_cost / m_etaGridCharge - m_cycleCost - m_omCost;
+        revenueToGridCharge = max_ppa_cost * m_etaDischarge - usage_cost / m_etaGridCharge - m_cycleCost - m_omCost;
 
         /*! Computed revenue to charge from Grid in each of next X hours ($/kWh)*/
         double revenueToGridChargeMax = 0;
         if (m_batteryPower->canGridCharge) {
-            std::vector<double> revenueToGridChargeForecast;
-            size_t j = 0;
-            for (size_t i = lifetimeIndex; i < lifetimeIndex + idx_lookahead; i++) {
-                if (m_utilityRateCalculator) {
-                    revenueToGridChargeForecast.push_back(*max_ppa_cost * m_etaDischarge - usage_cost_forecast[j] / m_etaGridCharge - m_cycleCost - m_omCost);
-                }
-                else {
-                    revenueToGridChargeForecast.push_back(*max_ppa_cost * m_etaDischarge - _forecast_price_rt_series[i] / m_etaGridCharge - m_cycleCost - m_omCost);
-                }
-                j++;
-            }
-            revenueToGridChargeMax = *std::max_element(std::begin(revenueToGridChargeForecast), std::end(revenueToGridChargeForecast));
+            // revenue only falls as the charging price rises, so its maximum is at the cheapest step in the window
+            double min_charge_cost = min_ppa_cost;
+            if (m_utilityRateCalculator)
+                min_charge_cost = *std::min_element(usage_cost_forecast.begin(), usage_cost_forecast.begin() + idx_lookahead);
+            revenueToGridChargeMax = max_ppa_cost * m_etaDischarge - min_charge_cost / m_etaGridCharge - m_cycleCost - m_omCost;
         }
 
         /*! Economic benefit of charging from regular PV in current time step to discharge sometime in next X hours ($/kWh)*/
-        revenueToPVCharge = _P_pv_ac[lifetimeIndex] > 0 ? *max_ppa_cost * m_etaDischarge - ppa_cost / m_etaPVCharge - m_cycleCost -m_omCost : 0;
+        revenueToPVCharge = _P_pv_ac[lifetimeIndex] > 0 ? max_ppa_cost * m_etaDischarge - ppa_cost / m_etaPVCharge - m_cycleCost -m_omCost : 0;
 
         /*! Computed revenue to charge from PV in each of next X hours ($/kWh)*/
         size_t t_duration = static_cast<size_t>(ceilf( (float)
@@ -251,20 +245,22 @@ void dispatch_automatic_front_of_meter_t::update_dispatch(size_t year, size_t ho
         size_t pv_hours_on;
         double revenueToPVChargeMax = 0;
         if (m_batteryPower->canSystemCharge) {
-            std::vector<double> revenueToPVChargeForecast;
+            size_t steps_on = 0;
+            double revenue_on_max = 0;
             for (size_t i = lifetimeIndex; i < lifetimeIndex + idx_lookahead && i < _P_pv_ac.size(); i++) {
                 // when considering grid charging, require PV output to exceed battery input capacity before accepting as a better option
-                bool system_on = _P_pv_ac[i] >= m_batteryPower->powerBatteryChargeMaxDC ? 1 : 0;
-                if (system_on) {
-                    revenueToPVChargeForecast.push_back(system_on * (*max_ppa_cost * m_etaDischarge - _forecast_price_rt_series[i] / m_etaPVCharge - m_cycleCost - m_omCost));
+                if (_P_pv_ac[i] >= m_batteryPower->powerBatteryChargeMaxDC) {
+                    double revenue = max_ppa_cost * m_etaDischarge - _forecast_price_rt_series[i] / m_etaPVCharge - m_cycleCost - m_omCost;
+                    revenue_on_max = steps_on == 0 ? revenue : std::fmax(revenue_on_max, revenue);
+                    steps_on++;
                 }
             }
-            pv_hours_on = revenueToPVChargeForecast.size() / _steps_per_hour;
-            revenueToPVChargeMax = pv_hours_on >= t_duration ? *std::max_element(std::begin(revenueToPVChargeForecast), std::end(revenueToPVChargeForecast)): 0;
+            pv_hours_on = steps_on / _steps_per_hour;
+            revenueToPVChargeMax = pv_hours_on >= t_duration && steps_on > 0 ? revenue_on_max : 0;
         }
 
         /*! Economic benefit of charging from clipped PV in current time step to discharge sometime in the next X hours (clipped PV is free) ($/kWh) */
-        revenueToClipCharge = _P_cliploss_dc[lifetimeIndex] > 0 ? *max_ppa_cost * m_etaDischarge - m_cycleCost - m_omCost : 0;
+        revenueToClipCharge = _P_cliploss_dc[lifetimeIndex] > 0 ? max_ppa_cost * m_etaDischarge - m_cycleCost - m_omCost : 0;
 
         /*! Economic benefit of discharging in current time step ($/kWh) */
         revenueToDischarge = ppa_cost * m_etaDischarge - m_cycleCost - m_omCost;
@@ -125,7 +125,7 @@ protected:
 
 	/*! Market real time and forecast prices */
 	std::vector<double> _forecast_price_rt_series;
-    std::vector<double> ppa_prices; // Smaller vector for copying and sorting
+    util::sliding_window ppa_price_window; // Sorted look-ahead window of _forecast_price_rt_series
 
     size_t discharge_hours; // Battery size in hours
 
@@ -197,7 +197,8 @@ void dispatch_pvsmoothing_front_of_meter_t::update_dispatch(size_t year, size_t
             // Compute forecast variables which potentially do change from year to year
             double energyToStoreClipped = 0;
             if (_P_cliploss_dc.size() > lifetimeIndex + _forecast_hours) {
-                energyToStoreClipped = std::accumulate(_P_cliploss_dc.begin() + lifetimeIndex, _P_cliploss_dc.begin() + lifetimeIndex + _forecast_hours * _steps_per_hour, 0.0) * _dt_hour;
+                _cliploss_window.update(_P_cliploss_dc, lifetimeIndex);
+                energyToStoreClipped = _cliploss_window.sum() * _dt_hour;
             }
 
 
@@ -32,11 +32,39 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 
 #include <algorithm>
-#include <functional>
-#include "6par_newton.h"
+#include <cmath>
 
 #include "lib_battery_voltage.h"
 
+/*
+Newton iteration on f(x) = 0 safeguarded by the bracket [lo, hi], where f(lo) < 0 < f(hi). Steps that leave the
+bracket fall back to bisection so the iteration cannot wander off to a root outside the physical current range.
+With first_rising set, f is a power curve that rises to a peak and falls again, and points past the peak are treated
+as lying above the root so the first crossing is returned.
+*/
+template <typename F>
+static double solve_bracketed_newton(F fdf, double x, double lo, double hi, bool first_rising) {
+    if (!(x > lo && x < hi))
+        x = 0.5 * (lo + hi);
+    for (size_t i = 0; i < 100; i++) {
+        double df = 0;
+        double f = fdf(x, &df);
+        if (std::abs(f) < 1e-6)
+            break;
+        if (f < 0 && (!first_rising || df > 0))
+            lo = x;
+        else
+            hi = x;
+        double x_new = (df != 0) ? x - f / df : lo;
+        if (!(x_new > lo && x_new < hi))
+            x_new = 0.5 * (lo + hi);
+        if (std::abs(x_new - x) < 1e-12 * fmax(1., std::abs(x)))
+            return x_new;
+        x = x_new;
+    }
+    return x;
+}
+
 /*
 Define Voltage Model
 */
@@ -397,7 +425,10 @@ double voltage_dynamic_t::voltage_model_tremblay_hybrid(double Q_cell, double I,
     //q0_cell - actual charge of battery (q - I*dt_dr) (Ah)
     //I - battery current (A)
 
-    double Q_cell_mod = calculate_Qfull_mod(Q_cell);
+    return voltage_model_tremblay_hybrid(Q_cell, calculate_Qfull_mod(Q_cell), I, q0_cell);
+}
+
+double voltage_dynamic_t::voltage_model_tremblay_hybrid(double Q_cell, double Q_cell_mod, double I, double q0_cell) {
     double it = Q_cell - q0_cell;
     double E = _E0 - _K * (Q_cell_mod / (Q_cell_mod - it)) + _A * exp(-_B0 * it);
     return E - params->resistance * I;
@@ -453,33 +484,68 @@ double voltage_dynamic_t::calculate_max_charge_w(double q, double qmax, double ,
            params->num_cells_series;
 }
 
-using namespace std::placeholders;
-
 double voltage_dynamic_t::calculate_max_discharge_w(double q, double qmax, double , double *max_current) {
     //q - Actual battery charge (Ah)
     //qmax - Battery capacity (Ah)
 
     q /= params->num_strings;
     qmax /= params->num_strings;
-    double current = q * 0.5;
-    double vol = params->dynamic.Vcut;
+    double dt_hr = params->dt_hr;
+    double Vcut = params->dynamic.Vcut;
+
+    // Candidate currents are I_k = q/2 + k * q/10 for as long as the step leaves charge in the battery and the
+    // voltage stays above cutoff. Voltage falls monotonically with current and power rises to a single peak, so
+    // both the last feasible k and the best k are found by bisection rather than by stepping through the grid,
+    // which took O(1 / dt_hr) voltage evaluations at sub-hourly steps.
+    double Q_cell_mod = calculate_Qfull_mod(qmax);
     double incr = q / 10;
-    double max_p = 0, max_I = 0, max_V = 0;
-    while (current * params->dt_hr < q - tolerance && vol >= params->dynamic.Vcut) {
-        vol = voltage_model_tremblay_hybrid(qmax, current, q - current * params->dt_hr);
-        double p = current * vol;
-        if (p > max_p && vol >= params->dynamic.Vcut) {
+    auto current_at = [&](size_t k) { return q * 0.5 + k * incr; };
+    auto voltage_at = [&](size_t k) {
+        double I = current_at(k);
+        return voltage_model_tremblay_hybrid(qmax, Q_cell_mod, I, q - I * dt_hr);
+    };
+    auto power_at = [&](size_t k) { return current_at(k) * voltage_at(k); };
+
+    double max_p = 0, max_I = 0;
+    if (current_at(0) * dt_hr < q - tolerance && voltage_at(0) >= Vcut) {
+        // last k within the capacity limit
+        auto k_hi = (size_t)fmax(0., ((q - tolerance) / dt_hr - q * 0.5) / incr);
+        while (k_hi > 0 && current_at(k_hi) * dt_hr >= q - tolerance)
+            k_hi--;
+        while (current_at(k_hi + 1) * dt_hr < q - tolerance)
+            k_hi++;
+
+        // last k at or above cutoff voltage
+        if (voltage_at(k_hi) < Vcut) {
+            size_t lo = 0, hi = k_hi;
+            while (hi - lo > 1) {
+                size_t mid = lo + (hi - lo) / 2;
+                if (voltage_at(mid) >= Vcut)
+                    lo = mid;
+                else
+                    hi = mid;
+            }
+            k_hi = lo;
+        }
+
+        // first k at which power stops increasing
+        size_t lo = 0, hi = k_hi;
+        while (lo < hi) {
+            size_t mid = lo + (hi - lo) / 2;
+            if (power_at(mid + 1) > power_at(mid))
+                lo = mid + 1;
+            else
+                hi = mid;
+        }
+        double p = power_at(lo);
+        if (p > 0) {
             max_p = p;
-            max_I = current;
-            max_V = vol;
+            max_I = current_at(lo);
         }
-        current += incr;
     }
-    current = max_I;
-    vol = max_V;
 
     if (max_current)
-        *max_current = current * params->num_strings;
+        *max_current = max_I * params->num_strings;
 
     return max_p * params->num_strings * params->num_cells_series;
 }
@@ -499,44 +565,61 @@ double voltage_dynamic_t::calculate_current_for_target_w(double P_watts, double
     else {
         solver_Q_mod = solver_Q;
     }
-    std::function<void(const double *, double *)> f;
-    double direction = 1.;
-    if (P_watts > 0)
-        f = std::bind(&voltage_dynamic_t::solve_current_for_discharge_power, this, _1, _2);
-    else {
-        f = std::bind(&voltage_dynamic_t::solve_current_for_charge_power, this, _1, _2);
-        direction = -1.;
-    }
-
-    double x[1], resid[1];
+    double x0;
     if (state->cell_voltage != 0)
-        x[0] = solver_power / state->cell_voltage * params->dt_hr;
+        x0 = solver_power / state->cell_voltage * params->dt_hr;
     else
-        x[0] = solver_power / params->dynamic.Vnom * params->dt_hr;
-    bool check = false;
-
-    newton<double, std::function<void(const double *, double *)>, 1>(x, resid, check, f,
-                                                                     100, 1e-6, 1e-6, 0.7);
-
-    return x[0] * params->num_strings * direction;
+        x0 = solver_power / params->dynamic.Vnom * params->dt_hr;
+
+    // current magnitudes are bracketed by the charge available to discharge, or by the headroom to full charge,
+    // which is widened if the requested charge power is beyond it
+    double current;
+    if (P_watts > 0) {
+        double I_max = solver_q / params->dt_hr;
+        if (I_max <= 0)
+            return 0.;
+        current = solve_bracketed_newton([this](double I, double *dfdI) {
+            return solve_current_for_discharge_power(I, dfdI);
+        }, x0, 0., I_max, true);
+    }
+    else {
+        double I_max = fmax(solver_Q - solver_q, tolerance) / params->dt_hr;
+        size_t n = 0;
+        while (solve_current_for_charge_power(I_max, nullptr) < 0 && n++ < 30)
+            I_max *= 2;
+        current = -solve_bracketed_newton([this](double I, double *dfdI) {
+            return solve_current_for_charge_power(I, dfdI);
+        }, x0, 0., I_max, false);
+    }
+    return current * params->num_strings;
 }
 
-void voltage_dynamic_t::solve_current_for_charge_power(const double *x, double *f) {
-    double I = x[0];
+double voltage_dynamic_t::solve_current_for_charge_power(double I, double *dfdI) {
     double it = (solver_Q - (solver_q + I * params->dt_hr));
-    double V = _E0 - _K * solver_Q_mod / (solver_Q_mod - it) + _A * exp(-_B0 * it) + params->resistance * I;
-    f[0] = I * V - solver_power;
+    double D = solver_Q_mod - it;
+    double e = _A * exp(-_B0 * it);
+    double V = _E0 - _K * solver_Q_mod / D + e + params->resistance * I;
+    if (dfdI) {
+        double dVdI = (_K * solver_Q_mod / (D * D) + _B0 * e) * params->dt_hr + params->resistance;
+        *dfdI = V + I * dVdI;
+    }
+    return I * V - solver_power;
 }
 
-void voltage_dynamic_t::solve_current_for_discharge_power(const double *x, double *f) {
+double voltage_dynamic_t::solve_current_for_discharge_power(double I, double *dfdI) {
     //solver_Q_mod - battery capacity (qmax) adjusted for cutoff voltage (Ah)
     //solver_Q - battery capacity (qmax) of original voltage model inputs (Ah)
     //solver_q - actual charge of battery
 
-    double I = x[0];
     double it = (solver_Q - (solver_q - I * params->dt_hr));
-    double V = _E0 - _K * solver_Q_mod / (solver_Q_mod - it) + _A * exp(-_B0 * it) - params->resistance * I;
-    f[0] = I * V - solver_power;
+    double D = solver_Q_mod - it;
+    double e = _A * exp(-_B0 * it);
+    double V = _E0 - _K * solver_Q_mod / D + e - params->resistance * I;
+    if (dfdI) {
+        double dVdI = -(_K * solver_Q_mod / (D * D) + _B0 * e) * params->dt_hr - params->resistance;
+        *dfdI = V + I * dVdI;
+    }
+    return I * V - solver_power;
 }
 
 // Vanadium redox flow model
@@ -613,16 +696,18 @@ double voltage_vanadium_redox_t::calculate_max_discharge_w(double q, double qmax
     solver_Q = qmax / params->num_strings;
     solver_T_k = kelvin;
 
-    std::function<void(const double *, double *)> f = std::bind(&voltage_vanadium_redox_t::solve_max_discharge_power,
-                                                                this, _1, _2);
-
-    double x[1], resid[1];
-    x[0] = (solver_q - tolerance) / params->dt_hr;
-    bool check = false;
-
-    newton<double, std::function<void(const double *, double *)>, 1>(x, resid, check, f,
-                                                                     100, 1e-6, 1e-6, 0.7);
-    double current = x[0];
+    // the power derivative falls from the open-circuit voltage at zero current toward -inf as the battery empties
+    double I_max = (solver_q - tolerance) / params->dt_hr;
+    if (I_max <= 0) {
+        if (max_current)
+            *max_current = 0.;
+        return 0.;
+    }
+    double current = solve_bracketed_newton([this](double I, double *dfdI) {
+        double f = -solve_max_discharge_power(I, dfdI);
+        *dfdI = -*dfdI;
+        return f;
+    }, I_max, 0., I_max, false);
 
     double power = current * voltage_model(solver_q - current * params->dt_hr, solver_Q, current, kelvin) *
                    params->num_strings * params->num_cells_series;
@@ -644,19 +729,20 @@ double voltage_vanadium_redox_t::calculate_current_for_target_w(double P_watts,
     solver_Q = qmax / params->num_strings;
     solver_T_k = kelvin;
 
-    std::function<void(const double *, double *)> f = std::bind(&voltage_vanadium_redox_t::solve_current_for_power,
-                                                                this, _1, _2);
-
-    double x[1], resid[1];
+    double x0;
     if (state->cell_voltage != 0.)
-        x[0] = solver_power / state->cell_voltage * params->dt_hr;
+        x0 = solver_power / state->cell_voltage * params->dt_hr;
     else
-        x[0] = solver_power / params->Vnom_default * params->dt_hr;
-    bool check = false;
+        x0 = solver_power / params->Vnom_default * params->dt_hr;
 
-    newton<double, std::function<void(const double *, double *)>, 1>(x, resid, check, f,
-                                                                     100, 1e-6, 1e-6, 0.7);
-    return x[0] * params->num_strings;
+    // discharge is bracketed by the charge available, charge by the headroom to full charge
+    auto f = [this](double I, double *dfdI) { return solve_current_for_power(I, dfdI); };
+    double current;
+    if (P_watts > 0)
+        current = solve_bracketed_newton(f, x0, 0., solver_q / params->dt_hr, true);
+    else
+        current = solve_bracketed_newton(f, x0, (solver_q - solver_Q) / params->dt_hr, 0., false);
+    return current * params->num_strings;
 }
 
 // I, Q, q0 are on a per-string basis since adding cells in series does not change current or charge
@@ -674,17 +760,30 @@ double voltage_vanadium_redox_t::voltage_model(double q0, double qmax, double I_
     return params->Vnom_default + m_RCF * T * A + std::abs(I_string) * params->resistance;
 }
 
-void voltage_vanadium_redox_t::solve_current_for_power(const double *x, double *f) {
-    double I = x[0];
+double voltage_vanadium_redox_t::solve_current_for_power(double I, double *dfdI) {
     double SOC = (solver_q - I * params->dt_hr) / solver_Q;
-    f[0] = I * (params->Vnom_default + m_RCF * solver_T_k * std::log(SOC * SOC / std::pow(1. - SOC, 2)) +
-        std::abs(I) * params->resistance) - solver_power;
+    double V = params->Vnom_default + m_RCF * solver_T_k * std::log(SOC * SOC / std::pow(1. - SOC, 2)) +
+        std::abs(I) * params->resistance;
+    if (dfdI) {
+        double dSOCdI = -params->dt_hr / solver_Q;
+        double dVdI = m_RCF * solver_T_k * 2 * (1. / SOC + 1. / (1. - SOC)) * dSOCdI +
+                      (I < 0 ? -1. : 1.) * params->resistance;
+        *dfdI = V + I * dVdI;
+    }
+    return I * V - solver_power;
 }
 
-void voltage_vanadium_redox_t::solve_max_discharge_power(const double *x, double *f) {
-    double I = std::abs(x[0]);
+double voltage_vanadium_redox_t::solve_max_discharge_power(double I, double *dfdI) {
+    I = std::abs(I);
     double SOC = (solver_q - I * params->dt_hr) / solver_Q;
-    f[0] = params->Vnom_default + 2 * I * params->resistance + m_RCF * solver_T_k *
+    double h = 1. / SOC - 1. / (1. - SOC);
+    if (dfdI) {
+        double dSOCdI = -params->dt_hr / solver_Q;
+        double dhdSOC = -1. / (SOC * SOC) - 1. / ((1. - SOC) * (1. - SOC));
+        *dfdI = 2 * params->resistance + m_RCF * solver_T_k *
+                                         (2 * (1. / SOC + 1. / (1. - SOC)) * dSOCdI - 2 * h - 2 * I * dhdSOC * dSOCdI);
+    }
+    return params->Vnom_default + 2 * I * params->resistance + m_RCF * solver_T_k *
                                                                (std::log(SOC * SOC / pow(1. - SOC, 2)) -
-                                                               2 * I * (1. / SOC - 1. / (1. - SOC)));
+                                                               2 * I * h);
 }
@@ -214,6 +214,9 @@ protected:
 
     double voltage_model_tremblay_hybrid(double Q_cell, double I, double q0_cell);
 
+    // same as above with the cutoff-adjusted capacity from calculate_Qfull_mod precomputed
+    double voltage_model_tremblay_hybrid(double Q_cell, double Q_cell_mod, double I, double q0_cell);
+
     double calculate_Qfull_mod(double qmax);
 
     // solver quantities
@@ -222,11 +225,10 @@ protected:
     double solver_q; //Actual battery capacity (Ah)
     double solver_power; //Battery output power (W)
 
-    void solve_current_for_charge_power(const double *x, double *f);
-
-    
+    // residual of I * V(I) - solver_power for a current I (A), with its derivative returned in dfdI
+    double solve_current_for_charge_power(double I, double *dfdI);
 
-    void solve_current_for_discharge_power(const double *x, double *f);
+    double solve_current_for_discharge_power(double I, double *dfdI);
 
 private:
     void initialize();
@@ -276,9 +278,10 @@ protected:
 
     double solver_power;
 
-    void solve_current_for_power(const double *x, double *f);
+    // residuals for a current I (A), with their derivatives returned in dfdI
+    double solve_current_for_power(double I, double *dfdI);
 
-    void solve_max_discharge_power(const double *x, double *f);
+    double solve_max_discharge_power(double I, double *dfdI);
 
 private:
     void initialize();
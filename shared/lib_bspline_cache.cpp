@@ -0,0 +1,163 @@
+/*
+BSD 3-Clause License
+
+Copyright (c) Alliance for Sustainable Energy, LLC. See also https://github.com/NREL/ssc/blob/develop/LICENSE
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+   contributors may be used to endorse or promote products derived from
+   this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <exception>
+#include <functional>
+#include <stdexcept>
+#include <thread>
+
+#include "lib_bspline_cache.h"
+#include "bsplinebuilder.h"
+#include "datatable.h"
+
+static std::shared_ptr<const BSpline> fit_cubic(const std::vector<double> &x, const std::vector<double> &y) {
+    if (x.size() != y.size())
+        throw std::invalid_argument("bspline_cache: curve x and y must have the same number of samples");
+    DataTable samples;
+    for (size_t i = 0; i < x.size(); i++)
+        samples.addSample(x[i], y[i]);
+    return std::make_shared<const BSpline>(BSpline::Builder(samples).degree(3).build());
+}
+
+bspline_cache &bspline_cache::instance() {
+    static bspline_cache cache;
+    return cache;
+}
+
+size_t bspline_cache::hash(const std::vector<double> &x, const std::vector<double> &y) {
+    std::hash<double> h;
+    size_t seed = x.size();
+    for (const auto &v : { &x, &y }) {
+        for (double d : *v)
+            seed ^= h(d) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+    }
+    return seed;
+}
+
+std::shared_ptr<const BSpline> bspline_cache::find(size_t h, const std::vector<double> &x, const std::vector<double> &y) {
+    auto range = m_entries.equal_range(h);
+    for (auto it = range.first; it != range.second; ++it) {
+        if (it->second.x == x && it->second.y == y)
+            return it->second.spline;
+    }
+    return nullptr;
+}
+
+std::shared_ptr<const BSpline> bspline_cache::fit(const std::vector<double> &x, const std::vector<double> &y) {
+    size_t h = hash(x, y);
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (auto spline = find(h, x, y))
+            return spline;
+    }
+    auto spline = fit_cubic(x, y);
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (auto existing = find(h, x, y))
+        return existing;
+    m_entries.emplace(h, entry{ x, y, spline });
+    return spline;
+}
+
+std::vector<std::shared_ptr<const BSpline>> bspline_cache::fit(const std::vector<std::vector<double>> &x,
+                                                               const std::vector<std::vector<double>> &y) {
+    if (x.size() != y.size())
+        throw std::invalid_argument("bspline_cache: number of x and y curves must match");
+
+    size_t n = x.size();
+    std::vector<size_t> hashes(n);
+    std::vector<std::shared_ptr<const BSpline>> splines(n);
+    std::vector<size_t> missing;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        for (size_t i = 0; i < n; i++) {
+            hashes[i] = hash(x[i], y[i]);
+            splines[i] = find(hashes[i], x[i], y[i]);
+            if (!splines[i])
+                missing.push_back(i);
+        }
+    }
+    if (missing.empty())
+        return splines;
+
+    // the fits are independent, so each missing curve gets its own thread
+    std::vector<std::exception_ptr> errors(n);
+    auto fit_one = [&](size_t i) {
+        try {
+            splines[i] = fit_cubic(x[i], y[i]);
+        }
+        catch (...) {
+            errors[i] = std::current_exception();
+        }
+    };
+    if (missing.size() == 1)
+        fit_one(missing[0]);
+    else {
+        std::vector<std::thread> workers;
+        for (size_t i : missing)
+            workers.emplace_back(fit_one, i);
+        for (auto &w : workers)
+            w.join();
+    }
+    for (size_t i : missing) {
+        if (errors[i])
+            std::rethrow_exception(errors[i]);
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (size_t i : missing) {
+        if (auto existing = find(hashes[i], x[i], y[i]))
+            splines[i] = existing;
+        else
+            m_entries.emplace(hashes[i], entry{ x[i], y[i], splines[i] });
+    }
+    return splines;
+}
+
+size_t bspline_cache::size() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_entries.size();
+}
+
+void bspline_cache::clear() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_entries.clear();
+}
+
+void bspline_eval(const BSpline &spline, const std::vector<double> &x, std::vector<double> &y) {
+    y.resize(x.size());
+    DenseVector point(1);
+    for (size_t i = 0; i < x.size(); i++) {
+        point(0) = x[i];
+        y[i] = spline.eval(point);
+    }
+}
@@ -0,0 +1,89 @@
+/*
+BSD 3-Clause License
+
+Copyright (c) Alliance for Sustainable Energy, LLC. See also https://github.com/NREL/ssc/blob/develop/LICENSE
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+   contributors may be used to endorse or promote products derived from
+   this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifndef __LIB_BSPLINE_CACHE_H__
+#define __LIB_BSPLINE_CACHE_H__
+
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "bspline.h"
+
+using namespace SPLINTER;
+
+/**
+* \class bspline_cache
+*
+*  Process-wide store of cubic B-splines fitted to one-variable curves, such as the OND inverter efficiency curves
+*  and the mlmodel IAM curve. A fit depends only on its samples, so runs that reuse the same equipment share one
+*  fitted spline instead of repeating the regression.
+*/
+class bspline_cache
+{
+public:
+    static bspline_cache &instance();
+
+    /// Cubic B-spline through the samples (x[i], y[i]), fitted on the first request for those samples
+    std::shared_ptr<const BSpline> fit(const std::vector<double> &x, const std::vector<double> &y);
+
+    /// Splines for several curves, fitting those not already cached on separate threads
+    std::vector<std::shared_ptr<const BSpline>> fit(const std::vector<std::vector<double>> &x,
+                                                    const std::vector<std::vector<double>> &y);
+
+    size_t size();
+
+    void clear();
+
+private:
+    bspline_cache() = default;
+
+    struct entry {
+        std::vector<double> x;
+        std::vector<double> y;
+        std::shared_ptr<const BSpline> spline;
+    };
+
+    static size_t hash(const std::vector<double> &x, const std::vector<double> &y);
+
+    /// Cached spline for the samples or nullptr, called with m_mutex held
+    std::shared_ptr<const BSpline> find(size_t h, const std::vector<double> &x, const std::vector<double> &y);
+
+    std::unordered_multimap<size_t, entry> m_entries;
+    std::mutex m_mutex;
+};
+
+/// Evaluates a one-variable spline at each of the points in x, writing the results to y
+void bspline_eval(const BSpline &spline, const std::vector<double> &x, std::vector<double> &y);
+
+#endif
@@ -1576,6 +1576,21 @@ void isotropic(double, double dn, double df, double alb, double inc, double tilt
     }
 }
 
+// Perez et al. 1990 coefficients for the eight sky clearness (epsilon) bins
+static const double perez_F11R[8] = {-0.0083117, 0.1299457, 0.3296958, 0.5682053,
+                                     0.8730280, 1.1326077, 1.0601591, 0.6777470};
+static const double perez_F12R[8] = {0.5877285, 0.6825954, 0.4868735, 0.1874525,
+                                     -0.3920403, -1.2367284, -1.5999137, -0.3272588};
+static const double perez_F13R[8] = {-0.0620636, -0.1513752, -0.2210958, -0.2951290,
+                                     -0.3616149, -0.4118494, -0.3589221, -0.2504286};
+static const double perez_F21R[8] = {-0.0596012, -0.0189325, 0.0554140, 0.1088631,
+                                     0.2255647, 0.2877813, 0.2642124, 0.1561313};
+static const double perez_F22R[8] = {0.0721249, 0.0659650, -0.0639588, -0.1519229,
+                                     -0.4620442, -0.8230357, -1.1272340, -1.3765031};
+static const double perez_F23R[8] = {-0.0220216, -0.0288748, -0.0260542, -0.0139754,
+                                     0.0012448, 0.0558651, 0.1310694, 0.2506212};
+static const double perez_EPSBINS[7] = {1.065, 1.23, 1.5, 1.95, 2.8, 4.5, 6.2};
+
 void
 perez(double, double dn, double df, double alb, double inc, double tilt, double zen, double poa[3], double diffc[3]) {
     /*
@@ -1587,20 +1602,6 @@ perez(double, double dn, double df, double alb, double inc, double tilt, double
 
     */
 
-    /* Local variables */
-    double F11R[8] = {-0.0083117, 0.1299457, 0.3296958, 0.5682053,
-                      0.8730280, 1.1326077, 1.0601591, 0.6777470};
-    double F12R[8] = {0.5877285, 0.6825954, 0.4868735, 0.1874525,
-                      -0.3920403, -1.2367284, -1.5999137, -0.3272588};
-    double F13R[8] = {-0.0620636, -0.1513752, -0.2210958, -0.2951290,
-                      -0.3616149, -0.4118494, -0.3589221, -0.2504286};
-    double F21R[8] = {-0.0596012, -0.0189325, 0.0554140, 0.1088631,
-                      0.2255647, 0.2877813, 0.2642124, 0.1561313};
-    double F22R[8] = {0.0721249, 0.0659650, -0.0639588, -0.1519229,
-                      -0.4620442, -0.8230357, -1.1272340, -1.3765031};
-    double F23R[8] = {-0.0220216, -0.0288748, -0.0260542, -0.0139754,
-                      0.0012448, 0.0558651, 0.1310694, 0.2506212};
-    double EPSBINS[7] = {1.065, 1.23, 1.5, 1.95, 2.8, 4.5, 6.2};
     double B2 = 0.000005534,
             EPS, T, D, DELTA, A, B, C, ZH, F1, F2, COSINC, x;
     double CZ, ZC, ZENITH, AIRMASS;
@@ -1665,11 +1666,11 @@ perez(double, double dn, double df, double alb, double inc, double tilt, double
             EPS = (dn + D) / D;
             EPS = (EPS + T * B2) / (1.0 + T * B2);
             i = 0;
-            while (i < 7 && EPS > EPSBINS[i])
+            while (i < 7 && EPS > perez_EPSBINS[i])
                 i++;
-            x = F11R[i] + F12R[i] * DELTA + F13R[i] * zen;
+            x = perez_F11R[i] + perez_F12R[i] * DELTA + perez_F13R[i] * zen;
             F1 = (0.0 > x) ? 0.0 : x;
-            F2 = F21R[i] + F22R[i] * DELTA + F23R[i] * zen;
+            F2 = perez_F21R[i] + perez_F22R[i] * DELTA + perez_F23R[i] * zen;
             COSINC = cos(inc);
             if (COSINC < 0.0)
                 ZC = 0.0;
@@ -1697,6 +1698,115 @@ perez(double, double dn, double df, double alb, double inc, double tilt, double
     }
 }
 
+void sky_model_poa(int sky_model, size_t n, const double *hextra, const double *dn, const double *df, const double *alb,
+                   const double *inc, const double *tilt, const double *zen,
+                   double *poa_beam, double *poa_sky, double *poa_gnd,
+                   double *diff_iso, double *diff_cir, double *diff_hor) {
+    /* each loop evaluates the same expressions as the scalar model in the same order so results are identical,
+       with the model selected once and the branches reduced to selects */
+    if (sky_model == 0) {
+        for (size_t k = 0; k < n; k++) {
+            double ct = cos(tilt[k]);
+            double beam = dn[k] * cos(inc[k]);
+            double sky = df[k] * (1.0 + ct) / 2.0;
+            double gnd = (dn[k] * cos(zen[k]) + df[k]) * alb[k] * (1.0 - ct) / 2.0;
+            poa_beam[k] = beam < 0 ? 0 : beam;
+            poa_sky[k] = sky < 0 ? 0 : sky;
+            poa_gnd[k] = gnd < 0 ? 0 : gnd;
+        }
+        if (diff_iso != nullptr)
+            for (size_t k = 0; k < n; k++) diff_iso[k] = poa_sky[k];
+        if (diff_cir != nullptr)
+            for (size_t k = 0; k < n; k++) diff_cir[k] = 0;
+        if (diff_hor != nullptr)
+            for (size_t k = 0; k < n; k++) diff_hor[k] = 0;
+    }
+    else if (sky_model == 1) {
+        for (size_t k = 0; k < n; k++) {
+            double hb = dn[k] * cos(zen[k]);
+            double ht = hb + df[k];
+            if (ht < SMALL) ht = SMALL;
+            double hx = hextra[k] < SMALL ? SMALL : hextra[k];
+            double ct = cos(tilt[k]);
+
+            double Rb = cos(inc[k]) / cos(zen[k]);
+            double Ai = hb / hx;
+            double f = sqrt(hb / ht);
+            double s3 = pow(sin(tilt[k] * 0.5), 3);
+
+            double cir = df[k] * Ai * Rb;
+            double iso = df[k] * (1 - Ai) * 0.5 * (1 + ct);
+            double isohor = df[k] * (1.0 - Ai) * 0.5 * (1.0 + ct) * (1.0 + f * s3);
+
+            double beam = dn[k] * cos(inc[k]);
+            double sky = isohor + cir;
+            double gnd = (hb + df[k]) * alb[k] * (1.0 - ct) / 2.0;
+            poa_beam[k] = beam < 0 ? 0 : beam;
+            poa_sky[k] = sky < 0 ? 0 : sky;
+            poa_gnd[k] = gnd < 0 ? 0 : gnd;
+            if (diff_iso != nullptr) diff_iso[k] = iso;
+            if (diff_cir != nullptr) diff_cir[k] = cir;
+            if (diff_hor != nullptr) diff_hor[k] = isohor - iso;
+        }
+    }
+    else {
+        const double B2 = 0.000005534;
+        for (size_t k = 0; k < n; k++) {
+            double d_n = dn[k] < 0.0 ? 0.0 : dn[k];
+            double D = df[k];
+            double z = zen[k];
+            double ct = cos(tilt[k]);
+            double COSINC = cos(inc[k]);
+            double beam, sky, gnd, iso, cir = 0, hor = 0;
+
+            if (z < 0.0 || z > 1.5271631) { /* isotropic diffuse only outside 0 to 87.5 deg */
+                if (D < 0.0) D = 0.0;
+                beam = (COSINC > 0.0 && z < 1.5707963) ? d_n * COSINC : 0;
+                sky = D * (1.0 + ct) / 2.0;
+                gnd = 0.0;
+                iso = sky;
+            }
+            else if (D <= 0.0) {
+                beam = COSINC > 0.0 ? d_n * COSINC : 0;
+                sky = gnd = iso = 0.0;
+            }
+            else {
+                double CZ = cos(z);
+                double ZH = (CZ > 0.0871557) ? CZ : 0.0871557;
+                double ZENITH = z / DTOR;
+                double AIRMASS = 1.0 / (CZ + 0.15 * pow(93.9 - ZENITH, -1.253));
+                double DELTA = D * AIRMASS / 1367.0;
+                double T = pow(ZENITH, 3.0);
+                double EPS = (d_n + D) / D;
+                EPS = (EPS + T * B2) / (1.0 + T * B2);
+
+                // bins are ascending, so counting the bins below epsilon finds the same bin as a search
+                int i = 0;
+                for (int j = 0; j < 7; j++)
+                    i += EPS > perez_EPSBINS[j];
+                double x = perez_F11R[i] + perez_F12R[i] * DELTA + perez_F13R[i] * z;
+                double F1 = (0.0 > x) ? 0.0 : x;
+                double F2 = perez_F21R[i] + perez_F22R[i] * DELTA + perez_F23R[i] * z;
+                double ZC = COSINC < 0.0 ? 0.0 : COSINC;
+
+                iso = D * (1 - F1) * (1.0 + ct) / 2.0;
+                cir = D * F1 * ZC / ZH;
+                hor = D * F2 * sin(tilt[k]);
+
+                beam = d_n * ZC;
+                sky = iso + cir + hor;
+                gnd = alb[k] * (d_n * CZ + D) * (1.0 - ct) / 2.0;
+            }
+            poa_beam[k] = beam;
+            poa_sky[k] = sky;
+            poa_gnd[k] = gnd;
+            if (diff_iso != nullptr) diff_iso[k] = iso;
+            if (diff_cir != nullptr) diff_cir[k] = cir;
+            if (diff_hor != nullptr) diff_hor[k] = hor;
+        }
+    }
+}
+
 void ineichen(double clearsky_results[3], double apparent_zenith, int month, int day, double pressure = 101325.0, double linke_turbidity = 1.0, double altitude = 0.0, double dni_extra = 1364.0, bool perez_enhancement = false) {
     double cos_zenith = Max(cosd(apparent_zenith), 0);
     double tl = linke_turbidity;
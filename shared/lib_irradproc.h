@@ -824,6 +824,34 @@ void isotropic(double hextra, double dn, double df, double alb, double inc, doub
 */
 void hdkr(double hextra, double dn, double df, double alb, double inc, double tilt, double zen, double poa[3], double diffc[3] /* can be NULL */);
 
+/**
+* Sky model for n timesteps at once, see isotropic(), hdkr(), perez(). The model is selected once and the timesteps are
+* computed in a single loop over contiguous columns, with the same results as calling the scalar model at each timestep.
+*
+* TODO: not called by the models yet. irrad::calc() finds the sun position and transposes one timestep at a time, so it
+* has to be split into a sun position pass and a transposition pass before whole-array callers can use this function.
+*
+* \param[in] sky_model 0 for isotropic, 1 for hdkr, otherwise perez (see irrad::SKYMODEL)
+* \param[in] n number of timesteps
+* \param[in] hextra extraterrestrial irradiance on horizontal surface (W/m2) (unused in isotropic and perez models)
+* \param[in] dn direct normal radiation (W/m2)
+* \param[in] df diffuse horizontal radiation (W/m2)
+* \param[in] alb surface albedo (decimal fraction)
+* \param[in] inc incident angle of direct beam radiation to surface in radians
+* \param[in] tilt surface tilt angle from horizontal in radians
+* \param[in] zen sun zenith angle in radians
+* \param[out] poa_beam incident beam (W/m2)
+* \param[out] poa_sky incident sky diffuse (W/m2)
+* \param[out] poa_gnd incident ground diffuse (W/m2)
+* \param[out] diff_iso isotropic diffuse (W/m2), can be NULL
+* \param[out] diff_cir circumsolar diffuse (W/m2), can be NULL
+* \param[out] diff_hor horizon brightening (W/m2), can be NULL
+*/
+void sky_model_poa(int sky_model, size_t n, const double *hextra, const double *dn, const double *df, const double *alb,
+                   const double *inc, const double *tilt, const double *zen,
+                   double *poa_beam, double *poa_sky, double *poa_gnd,
+                   double *diff_iso, double *diff_cir, double *diff_hor);
+
 
 /**
 * poaDecomp is a function to decompose input plane-of-array irradiance into direct normal, diffuse horizontal, and global horizontal.
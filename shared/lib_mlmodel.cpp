@@ -47,8 +47,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "lib_mlmodel.h"
 // #include "mlm_spline.h"
-#include "bsplinebuilder.h"
-#include "datatable.h"
+#include "lib_bspline_cache.h"
 
 static const double k = 1.38064852e-23; // Boltzmann constant [J/K]
 static const double q = 1.60217662e-19; // Elemenatry charge [C]
@@ -129,11 +128,9 @@ void mlmodel_module_t::initializeManual()
 			}
 			iamSpline.set_points(X, Y);
 			*/
-			DataTable samples;
-			for (int i = 0; i <= IAM_c_cs_elements - 1; i = i + 1) {
-				samples.addSample(IAM_c_cs_incAngle[i], IAM_c_cs_iamValue[i]);
-			}
-			m_bspline3 = BSpline::Builder(samples).degree(3).build();
+			std::vector<double> X(IAM_c_cs_incAngle, IAM_c_cs_incAngle + IAM_c_cs_elements);
+			std::vector<double> Y(IAM_c_cs_iamValue, IAM_c_cs_iamValue + IAM_c_cs_elements);
+			m_bspline3 = *bspline_cache::instance().fit(X, Y);
 
 			isInitialized = true;
 		}
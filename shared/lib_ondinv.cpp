@@ -43,8 +43,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <stdexcept>
 
 #include "lib_ondinv.h"
-#include "bsplinebuilder.h"
-#include "datatable.h"
+#include "lib_bspline_cache.h"
 
 
 const int TEMP_DERATE_ARRAY_LENGTH = 6;
@@ -201,10 +200,8 @@ void ond_inverter::initializeManual()
 		//	}
 		//}
 		Pdc_threshold = 2;
-		std::vector<double> ondspl_X;
-		std::vector<double> ondspl_Y;
-		DenseVector xSamples(1);
-		DataTable samples;
+		std::vector<std::vector<double>> ondspl_X;
+		std::vector<std::vector<double>> ondspl_Y;
 //		int splineIndex;
 //		bool switchoverDone;
 
@@ -215,11 +212,11 @@ void ond_inverter::initializeManual()
 			noOfEfficiencyCurves = 1;
 		}
 
+		ondspl_X.resize(noOfEfficiencyCurves);
+		ondspl_Y.resize(noOfEfficiencyCurves);
 		for (int j = 0; j <= noOfEfficiencyCurves - 1; j = j + 1) {
 //			splineIndex = 0;
 //			switchoverDone = false;
-			ondspl_X.clear();
-			ondspl_Y.clear();
 			double atX[3];
 			double atY[3];
 			const int MAX_ELEMENTS = 100; // = effCurve_elements + 5;
@@ -256,8 +253,8 @@ void ond_inverter::initializeManual()
 				// include overlap at i=2
 				if ((i >=2 && i < MAX_ELEMENTS) && (effCurve_Pdc[j][i] > 0))// && effCurve_eta[j][i] > 0)) 
 				{ // spline
-					ondspl_X.push_back(effCurve_Pdc[j][i]);
-					ondspl_Y.push_back(effCurve_eta[j][i]);
+					ondspl_X[j].push_back(effCurve_Pdc[j][i]);
+					ondspl_Y[j].push_back(effCurve_eta[j][i]);
 				}
 			}
 			/* Spline
@@ -270,17 +267,12 @@ void ond_inverter::initializeManual()
 				}
 			}
 			*/
-			// SPLINTER
-			samples.clear();
-			x_max[j] = ondspl_X.back();
-			for (size_t k = 0; k < ondspl_X.size() && k < ondspl_Y.size(); k++)
-			{
-				xSamples(0) = ondspl_X[k];
-				samples.addSample(xSamples, ondspl_Y[k]);
-			}
-			m_bspline3[j] = BSpline::Builder(samples).degree(3).build();
-
+			x_max[j] = ondspl_X[j].back();
 		}
+		// SPLINTER, the curves are independent so the cache fits any it has not seen in parallel
+		std::vector<std::shared_ptr<const BSpline>> splines = bspline_cache::instance().fit(ondspl_X, ondspl_Y);
+		for (int j = 0; j <= noOfEfficiencyCurves - 1; j = j + 1)
+			m_bspline3[j] = *splines[j];
 		ondIsInitialized = true;
 	}
 }
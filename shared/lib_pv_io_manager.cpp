@@ -1190,8 +1190,17 @@ Module_IO::Module_IO(compute_module* cm, std::string cmName, double dcLoss)
         double gamma = cm->as_double("6par_gpmp");
         int nser = cm->as_integer("6par_nser");
 
+        // solved coefficients are reused across runs with the same datasheet inputs, and optionally across sessions
+        std::string cache_file = cm->is_assigned("6par_cache_file") ? cm->as_string("6par_cache_file") : "";
+        module6par_cache& cache = module6par_cache::instance();
+        if (!cache_file.empty() && !cache.load(cache_file))
+            cm->log("CEC 6 parameter model: could not read solved coefficients from " + cache_file, SSC_WARNING);
+
         module6par m(tech_id, Vmp, Imp, Voc, Isc, beta, alpha, gamma, nser, 298.15);
-        int err = m.solve_with_sanity_and_heuristics<double>(300, 1e-7);
+        int err = module6par_solve_cached(m, 300, 1e-7, &cache);
+
+        if (!cache_file.empty() && !cache.save(cache_file))
+            cm->log("CEC 6 parameter model: could not write solved coefficients to " + cache_file, SSC_WARNING);
 
         if (err != 0)
             throw exec_error(cmName, "CEC 6 parameter model:  Could not solve for normalized coefficients.  Please check your inputs.");
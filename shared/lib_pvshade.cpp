@@ -36,6 +36,8 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <cmath>
 #include <limits>
+#include <map>
+#include <mutex>
 #include <vector>
 
 
@@ -80,7 +82,7 @@ double mask_angle_func(double x, double R, double B, double tilt_eff)
 double trapzd(double (*func)(double,double,double,double), double a, double b, double R, double B, double tilt, int n)
 {
 	double x,tnm,sum,del;
-	static double s;
+	static thread_local double s; // per thread so self-shading can run in concurrent simulations
 	int it,j;
 	if (n == 1)
 	{
@@ -289,13 +291,90 @@ void selfshade_xs_horstr(bool landscape,
 	}
 }
 
-// Accessor for sky diffuse derates for the given surface_tilt. If the value doesn't exist in the table, it is computed.
+namespace {
+    std::mutex sky_diffuse_mutex;
+    std::map<double, std::shared_ptr<sssky_diffuse_table::derate_map> > sky_diffuse_tables;   // derates by gcr
+    size_t sky_diffuse_size = 0;                        // derates held in sky_diffuse_tables
+    size_t sky_diffuse_limit = 200000;                  // about 90 degrees of tilts for two gcrs
+    size_t sky_diffuse_generation = 0;                  // incremented by clear_shared() to detach tables sharing the cleared derates
+
+    long long tilt_key(double surface_tilt) {
+        return std::llround(surface_tilt * 1000.0);
+    }
+}
+
+void sssky_diffuse_table::init(double surface_tilt, double groundCoverageRatio, bool use_shared) {
+    gcr = groundCoverageRatio;
+    derates_table.clear();
+    shared_table.reset();
+    {
+        std::lock_guard<std::mutex> lock(sky_diffuse_mutex);
+        if (use_shared && sky_diffuse_limit > 0) {
+            std::shared_ptr<derate_map> &table = sky_diffuse_tables[gcr];
+            if (!table)
+                table = std::make_shared<derate_map>();
+            shared_table = table;
+            shared_generation = sky_diffuse_generation;
+        }
+    }
+    lookup(surface_tilt);
+}
+
+// Accessor for sky diffuse derates for the given surface_tilt. Derates are looked up in this table's own derates first,
+// then in the table shared by all instances with the same gcr, and are kept in this table's derates once found. A missing
+// derate is computed and added to the shared table while it is under the size limit.
 double sssky_diffuse_table::lookup(double surface_tilt) {
-    char buf[8];
-    sprintf(buf, "%.3f", surface_tilt);
-    if (derates_table.find(buf) != derates_table.end())
-        return derates_table[buf];
-    return compute(surface_tilt);
+    if (gcr == 0)
+        throw std::runtime_error("sssky_diffuse_table::lookup error: gcr required in initialization");
+
+    long long key = tilt_key(surface_tilt);
+    derate_map::const_iterator it = derates_table.find(key);
+    if (it != derates_table.end())
+        return it->second;
+
+    if (shared_table) {
+        std::lock_guard<std::mutex> lock(sky_diffuse_mutex);
+        if (shared_generation != sky_diffuse_generation)
+            shared_table.reset();
+        else {
+            it = shared_table->find(key);
+            if (it != shared_table->end())
+                return derates_table[key] = it->second;
+        }
+    }
+
+    double derate = compute(key / 1000.0);
+    if (shared_table) {
+        std::lock_guard<std::mutex> lock(sky_diffuse_mutex);
+        if (shared_generation != sky_diffuse_generation)
+            shared_table.reset();
+        else if (sky_diffuse_size < sky_diffuse_limit && shared_table->emplace(key, derate).second)
+            sky_diffuse_size++;
+    }
+    derates_table[key] = derate;
+    return derate;
+}
+
+size_t sssky_diffuse_table::shared_size() {
+    std::lock_guard<std::mutex> lock(sky_diffuse_mutex);
+    return sky_diffuse_size;
+}
+
+void sssky_diffuse_table::clear_shared() {
+    std::lock_guard<std::mutex> lock(sky_diffuse_mutex);
+    sky_diffuse_tables.clear();
+    sky_diffuse_size = 0;
+    sky_diffuse_generation++;
+}
+
+size_t sssky_diffuse_table::shared_limit() {
+    std::lock_guard<std::mutex> lock(sky_diffuse_mutex);
+    return sky_diffuse_limit;
+}
+
+void sssky_diffuse_table::set_shared_limit(size_t max_derates) {
+    std::lock_guard<std::mutex> lock(sky_diffuse_mutex);
+    sky_diffuse_limit = max_derates;
 }
 
 double sssky_diffuse_table::compute(double surface_tilt) {
@@ -331,9 +410,6 @@ double sssky_diffuse_table::compute(double surface_tilt) {
         else {}
         skydiff += (Asky_shade[n] / Asky) * step;
     }
-    char buf[8];
-    sprintf(buf, "%.3f", surface_tilt);
-    derates_table[buf] = skydiff;
     return skydiff;
 }
 
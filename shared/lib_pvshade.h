@@ -35,6 +35,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #define __pvshade_h
 
 #include <string>
+#include <memory>
 #include <unordered_map>
 #include "lib_util.h"
 
@@ -71,21 +72,39 @@ struct ssoutputs	// self-shading outputs
 
 // look up table for calculating the diffuse reduction due to gcr and tilt of the panels for self-shading
 // added to removing duplicate computations for speed up (https://github.com/NREL/ssc/issues/384)
+// derates are computed at the surface tilt rounded to 0.001 degrees and by default shared by all tables with the same gcr,
+// so tracking subarrays and repeated runs of the same array geometry compute each tilt only once per process.
+// the shared derates are capped at shared_limit() entries for all gcrs; past that, or with sharing turned off in init,
+// a table keeps the derates it computes to itself
 class sssky_diffuse_table
 {
-    std::unordered_map<std::string, double> derates_table;      // stores pairs of surface tilts and derates
+public:
+    typedef std::unordered_map<long long, double> derate_map;   // surface tilt in 0.001 degrees and derates
+
+private:
+    derate_map derates_table;                                   // derates looked up by this table
+    std::shared_ptr<derate_map> shared_table;                   // derates for this gcr shared between tables, null if not sharing
+    size_t shared_generation;                                   // clear_shared() count when shared_table was taken
     double gcr;                                                 // 0.01 - 0.99
 
     double compute(double surface_tilt);
 
 public:
-    sssky_diffuse_table(): gcr(0) {}
+    sssky_diffuse_table(): shared_generation(0), gcr(0) {}
 
     // initialize with the ground coverage ratio (fixed per PV simulation) and the starting tilt
-    void init(double surface_tilt, double groundCoverageRatio) { gcr = groundCoverageRatio; compute(surface_tilt); }
+    void init(double surface_tilt, double groundCoverageRatio, bool use_shared = true);
 
     // return the sky diffuse derate for the panel at given surface_tilt
     double lookup(double surface_tilt);
+
+    // number of derates held for all gcrs, and removes them; tables sharing the removed derates stop sharing
+    static size_t shared_size();
+    static void clear_shared();
+
+    // maximum number of derates held for all gcrs, 0 turns sharing off for tables initialized afterwards
+    static size_t shared_limit();
+    static void set_shared_limit(size_t max_derates);
 };
 
 
@@ -32,9 +32,8 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 
 #include <algorithm>
-#include <functional>
+#include <cmath>
 
-#include "6par_newton.h"
 #include "lib_shared_inverter.h"
 #include "lib_util.h"
 
@@ -49,6 +48,11 @@ SharedInverter::SharedInverter(int inverterType, size_t numberOfInverters,
     m_ondInverter = ondInverter;
     m_tempEnabled = false;
     m_subhourlyClippingEnabled = false;
+    m_derateCached = false;
+    m_derateV = 0.;
+    m_derateTempC = 0.;
+    m_derateStartT = 0.;
+    m_derateSlope = 0.;
 
     if (m_inverterType == SANDIA_INVERTER || m_inverterType == DATASHEET_INVERTER || m_inverterType == COEFFICIENT_GENERATOR)
         m_nameplateAC_kW = m_numInverters * m_sandiaInverter->Paco * util::watt_to_kilowatt;
@@ -76,6 +80,11 @@ SharedInverter::SharedInverter(const SharedInverter& orig) {
     m_nameplateAC_kW = orig.m_nameplateAC_kW;
     m_tempEnabled = orig.m_tempEnabled;
     m_thermalDerateCurves = orig.m_thermalDerateCurves;
+    m_derateCached = orig.m_derateCached;
+    m_derateV = orig.m_derateV;
+    m_derateTempC = orig.m_derateTempC;
+    m_derateStartT = orig.m_derateStartT;
+    m_derateSlope = orig.m_derateSlope;
     m_sandiaInverter = orig.m_sandiaInverter;
     m_partloadInverter = orig.m_partloadInverter;
     m_ondInverter = orig.m_ondInverter;
@@ -104,6 +113,7 @@ bool sortByVoltage(std::vector<double> i, std::vector<double> j)
 int SharedInverter::setTempDerateCurves(std::vector<std::vector<double>> derateCurves)
 {
     m_thermalDerateCurves.clear();
+    m_derateCached = false;
 
     // Check derate curves have V > 0, and that for each pair T > -273, slope < 0
     for (size_t r = 0; r < derateCurves.size(); r++) {
@@ -144,6 +154,48 @@ void SharedInverter::calculateTempDerate(double V, double tempC, double& p_dc_ra
 {
     if (ratio == 0. || p_dc_rated == 0.) return;
 
+    double p_dc_max = getInverterDCMaxPower(p_dc_rated);
+
+    // The start temp and slope depend only on V and T, which stay the same across the repeated calls made in a timestep
+    double deltaT = 0.0;
+    double slopeInterpolated = 0.0;
+    double startTInterpolated = 0.0;
+    if (m_derateCached && V == m_derateV && tempC == m_derateTempC) {
+        startTInterpolated = m_derateStartT;
+        slopeInterpolated = m_derateSlope;
+    }
+    else {
+        interpolateTempDerate(V, tempC, startTInterpolated, slopeInterpolated);
+        m_derateCached = true;
+        m_derateV = V;
+        m_derateTempC = tempC;
+        m_derateStartT = startTInterpolated;
+        m_derateSlope = slopeInterpolated;
+    }
+    deltaT = tempC - startTInterpolated;
+
+    // If less than start temp, no derating
+    if (deltaT <= 0) return;
+
+    // If slope is positive, set to zero with no derating
+    if (slopeInterpolated >= 0) return;
+    if (slopeInterpolated < -1) slopeInterpolated = -1;
+
+    // Power in units of W, ratio = max output / rated output
+    ratio += deltaT * slopeInterpolated;
+    if (ratio < 0) ratio = 0.;
+    double p_dc_limit = p_dc_max * ratio;
+    if (p_dc_rated > p_dc_limit) {
+        loss = p_dc_rated - (p_dc_limit);
+        p_dc_rated = p_dc_limit;
+    }
+    else {
+        loss = 0;
+    }
+}
+
+void SharedInverter::interpolateTempDerate(double V, double tempC, double& startTInterpolated, double& slopeInterpolated)
+{
     double slope = 0.0;
     double startT = 0.0;
     double Vdc = 0.0;
@@ -151,13 +203,8 @@ void SharedInverter::calculateTempDerate(double V, double tempC, double& p_dc_ra
     double startT2 = 0.0;
     double Vdc2 = 0.0;
 
-    double p_dc_max = getInverterDCMaxPower(p_dc_rated);
-
     // Find the appropriate derate curve depending on DC voltage
     size_t idx = 0;
-    double deltaT = 0.0;
-    double slopeInterpolated = 0.0;
-    double startTInterpolated = 0.0;
 
     while (idx < m_thermalDerateCurves.size() && V > m_thermalDerateCurves[idx][0]) {
         idx++;
@@ -206,26 +253,6 @@ void SharedInverter::calculateTempDerate(double V, double tempC, double& p_dc_ra
             slopeInterpolated = (slope2 - slope) / (Vdc2 - Vdc) * (V - Vdc2) + slope2;
         }
     }
-    deltaT = tempC - startTInterpolated;
-
-    // If less than start temp, no derating
-    if (deltaT <= 0) return;
-
-    // If slope is positive, set to zero with no derating
-    if (slopeInterpolated >= 0) return;
-    if (slopeInterpolated < -1) slopeInterpolated = -1;
-
-    // Power in units of W, ratio = max output / rated output
-    ratio += deltaT * slopeInterpolated;
-    if (ratio < 0) ratio = 0.;
-    double p_dc_limit = p_dc_max * ratio;
-    if (p_dc_rated > p_dc_limit) {
-        loss = p_dc_rated - (p_dc_limit);
-        p_dc_rated = p_dc_limit;
-    }
-    else {
-        loss = 0;
-    }
 }
 
 double SharedInverter::getInverterDCMaxPower(double p_dc_rated)
@@ -385,36 +412,68 @@ void SharedInverter::calculateACPower(const std::vector<double> powerDC_kW_in, c
     convertOutputsToKWandScale(tempLoss_avg, powerAC_Watts);
 }
 
-void SharedInverter::solve_kwdc_for_kwac(const double* x, double* f) {
-    calculateACPower(x[0], StringV, Tdry_C);
-    f[0] = powerAC_kW - solver_AC;
-}
-
-using namespace std::placeholders;
 double SharedInverter::calculateRequiredDCPower(const double kwAC, const double DCStringV, double tempC) {
 
     SharedInverter clone = SharedInverter(*this);
 
-    // set up solver values
-    clone.StringV = DCStringV;
-    clone.Tdry_C = tempC;
-    clone.solver_AC = kwAC;
-
-    std::function<void(const double*, double*)> f;
-    f = std::bind(&SharedInverter::solve_kwdc_for_kwac, &clone, _1, _2);
-
-    double x[1], resid[1];
-    x[0] = kwAC * 1.04;
-    bool check = false;
-
-    newton<double, std::function<void(const double*, double*)>, 1>(x, resid, check, f,
-        100, 1e-6, 1e-6, 0.7);
-
-    // if efficiency is too low, the required DC power becomes infinite
-    if (!isfinite(x[0]))
-        x[0] = kwAC;
+    // AC output is odd in DC input on the operating part of the curve, so solve on magnitudes
+    double sign = kwAC < 0 ? -1. : 1.;
+    double target = std::abs(kwAC);
+    auto residual = [&](double kwDC) {
+        clone.calculateACPower(sign * kwDC, DCStringV, tempC);
+        return sign * clone.powerAC_kW - target;
+    };
 
-    return x[0];
+    // Start from the nominal estimate at 96% efficiency. If the output does not respond to input there, either the night
+    // tare below the operating threshold or a clipped or derated ceiling, there is no slope to solve along and the
+    // estimate is returned
+    double x0 = target * 1.04;
+    double f0 = residual(x0);
+    if (std::abs(f0) < 1e-8)
+        return kwAC * 1.04;
+    double x1 = x0 + 1e-8 * fmax(x0, 1.);
+    double f1 = residual(x1);
+    if (!std::isfinite(f0) || f1 == f0)
+        return kwAC * 1.04;
+
+    // Secant steps, held inside the bracket [lo, hi] around the root once both sides have been seen. The result meets
+    // the AC target to within 1e-6 kW, or if the target is out of reach it is the closest point found
+    double lo = 0., hi = 0.;
+    bool has_lo = false, has_hi = false;
+    double x_best = x0, f_best = f0;
+    for (size_t i = 0; i < 50; i++) {
+        if (std::abs(f1) < std::abs(f_best)) {
+            x_best = x1;
+            f_best = f1;
+        }
+        if (std::abs(f1) < 1e-6)
+            return sign * x1;
+        for (double x : {x0, x1}) {
+            double f = (x == x0) ? f0 : f1;
+            if (f < 0 && (!has_lo || x > lo)) {
+                lo = x;
+                has_lo = true;
+            }
+            else if (f > 0 && (!has_hi || x < hi)) {
+                hi = x;
+                has_hi = true;
+            }
+        }
+        double x2 = (f1 != f0) ? x1 - f1 * (x1 - x0) / (f1 - f0) : x1;
+        if (has_lo && has_hi) {
+            if (!(x2 > lo && x2 < hi))
+                x2 = 0.5 * (lo + hi);
+        }
+        else if (!(x2 > 0) || !std::isfinite(x2) || x2 == x1)
+            x2 = f1 < 0 ? x1 * 1.25 : x1 * 0.8;
+        x0 = x1;
+        f0 = f1;
+        x1 = x2;
+        f1 = residual(x1);
+    }
+    if (!std::isfinite(x_best))
+        return kwAC;
+    return sign * x_best;
 }
 
 double SharedInverter::getInverterDCNominalVoltage()
@@ -125,6 +125,16 @@ protected:
     /// Given a temp, find which slope to apply
     void findPointOnCurve(size_t idx, double T, double& startT, double& slope);
 
+    /// Start temp and slope interpolated between the derate curves for a DC voltage and ambient T
+    void interpolateTempDerate(double V, double tempC, double& startT, double& slope);
+
+    /// Interpolated start temp and slope for the most recent V and T
+    bool m_derateCached;
+    double m_derateV;
+    double m_derateTempC;
+    double m_derateStartT;
+    double m_derateSlope;
+
     // Memory managed elsewehre
     sandia_inverter_t* m_sandiaInverter;
     partload_inverter_t* m_partloadInverter;
@@ -133,11 +143,6 @@ protected:
 private:
 
     void convertOutputsToKWandScale(double tempLoss, double powerAC_watts);
-
-    // x[0] is dc power input in kW, x[1] is target ac power output in kW
-    void solve_kwdc_for_kwac(const double* x, double* f);
-
-    double solver_AC;
 };
 
 
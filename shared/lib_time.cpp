@@ -31,6 +31,8 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 */
 
 
+#include <algorithm>
+
 #include "lib_time.h"
 
 /**
@@ -52,14 +54,13 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 * \param[out] dt_hour (the time step in hours)
 */
 template <class T>
-void single_year_to_lifetime_interpolated(
+static void single_year_sampled(
 	bool is_lifetime,
-	size_t n_years,
+	size_t &n_years,
 	size_t n_rec_lifetime,
-	std::vector<T> singleyear_vector,
-	std::vector<T> scale_factor,
-    double interpolation_factor,
-	std::vector<T> &lifetime_from_singleyear_vector,
+	const std::vector<T> &singleyear_vector,
+	double interpolation_factor,
+	std::vector<T> &singleyear_sampled,
 	size_t &n_rec_single_year,
 	double &dt_hour)
 {
@@ -73,12 +74,8 @@ void single_year_to_lifetime_interpolated(
 	}
 	dt_hour = (double)(util::hours_per_year * n_years) / n_rec_lifetime;
 
-	lifetime_from_singleyear_vector.reserve(n_rec_lifetime);
-    if (singleyear_vector.empty() ) {
-        for (size_t i = 0; i < n_rec_lifetime; i++)
-            lifetime_from_singleyear_vector.emplace_back(0);
-        return;
-    }
+	if (singleyear_vector.empty())
+		return;
 
 	auto step_per_hour = (size_t)(1 / dt_hour);
 	if (step_per_hour == 0)
@@ -92,8 +89,8 @@ void single_year_to_lifetime_interpolated(
 	// Possible that there is no single year vector
 	if (singleyear_vector.size() > 1)
 	{
+		singleyear_sampled.reserve(n_rec_single_year);
 		// Interpolate single year vector to dt_hour
-		std::vector<T> singleyear_sampled;
 		if (singleyear_vector.size() <= n_rec_single_year) {
 			size_t sy_idx = 0;
 			for (size_t h = 0; h < util::hours_per_year; h++) {
@@ -116,25 +113,112 @@ void single_year_to_lifetime_interpolated(
 				}
 			}
 		}
+	}
+	// single value is applied to every step without the interpolation factor
+	else
+		singleyear_sampled.push_back(singleyear_vector[0]);
+}
 
-		// Scale single year interpolated vector to lifetime
-		for (size_t y = 0; y < n_years; y++) {
-			for (size_t i = 0; i < n_rec_single_year; i++) {
-				lifetime_from_singleyear_vector.push_back(singleyear_sampled[i] * scale_factor[y]);
-			}
+template <class T>
+void single_year_to_lifetime_interpolated(
+	bool is_lifetime,
+	size_t n_years,
+	size_t n_rec_lifetime,
+	const std::vector<T> &singleyear_vector,
+	const std::vector<T> &scale_factor,
+    double interpolation_factor,
+	std::vector<T> &lifetime_from_singleyear_vector,
+	size_t &n_rec_single_year,
+	double &dt_hour)
+{
+	std::vector<T> singleyear_sampled;
+	single_year_sampled(is_lifetime, n_years, n_rec_lifetime, singleyear_vector, interpolation_factor,
+		singleyear_sampled, n_rec_single_year, dt_hour);
+
+	lifetime_from_singleyear_vector.reserve(n_rec_lifetime);
+    if (singleyear_vector.empty() ) {
+        for (size_t i = 0; i < n_rec_lifetime; i++)
+            lifetime_from_singleyear_vector.emplace_back(0);
+        return;
+    }
+
+	// Scale single year interpolated vector to lifetime
+	bool single_value = singleyear_sampled.size() == 1;
+	for (size_t y = 0; y < n_years; y++) {
+		for (size_t i = 0; i < n_rec_single_year; i++) {
+			lifetime_from_singleyear_vector.push_back(singleyear_sampled[single_value ? 0 : i] * scale_factor[y]);
 		}
 	}
-	else if (singleyear_vector.size() == 1) {
-        for (size_t y = 0; y < n_years; y++) {
-            for (size_t i = 0; i < n_rec_single_year; i++) {
-	            lifetime_from_singleyear_vector.push_back(singleyear_vector[0] * scale_factor[y]);
-            }
-        }
+}
+
+template void single_year_to_lifetime_interpolated<double>(bool, size_t, size_t, const std::vector<double> &, const std::vector<double> &, double, std::vector<double> &, size_t &, double &);
+template void single_year_to_lifetime_interpolated<float>(bool, size_t, size_t, const std::vector<float> &, const std::vector<float> &, double, std::vector<float> &, size_t &, double &);
+
+/**
+*  \function  single_year_to_lifetime_series
+*
+*  As single_year_to_lifetime_interpolated, but keeps only the interpolated single year and the scale factors.
+*  Values are computed on access, so a 25-year subhourly load or price series costs one year of storage.
+*/
+template <class T>
+void single_year_to_lifetime_series(
+	bool is_lifetime,
+	size_t n_years,
+	size_t n_rec_lifetime,
+	const std::vector<T> &singleyear_vector,
+	const std::vector<T> &scale_factor,
+	double interpolation_factor,
+	lifetime_series<T> &lifetime_from_singleyear,
+	size_t &n_rec_single_year,
+	double &dt_hour)
+{
+	std::vector<T> singleyear_sampled;
+	single_year_sampled(is_lifetime, n_years, n_rec_lifetime, singleyear_vector, interpolation_factor,
+		singleyear_sampled, n_rec_single_year, dt_hour);
+
+	if (singleyear_sampled.empty()) {
+		lifetime_from_singleyear = lifetime_series<T>(singleyear_sampled, std::vector<T>(1, 1), n_rec_lifetime, n_rec_lifetime);
+		return;
 	}
+	std::vector<T> scale(scale_factor.begin(), scale_factor.begin() + std::min(n_years, scale_factor.size()));
+	lifetime_from_singleyear = lifetime_series<T>(singleyear_sampled, scale, n_rec_single_year, n_years * n_rec_single_year);
+}
+
+template void single_year_to_lifetime_series<double>(bool, size_t, size_t, const std::vector<double> &, const std::vector<double> &, double, lifetime_series<double> &, size_t &, double &);
+template void single_year_to_lifetime_series<float>(bool, size_t, size_t, const std::vector<float> &, const std::vector<float> &, double, lifetime_series<float> &, size_t &, double &);
+
+template <class T>
+lifetime_series<T>::lifetime_series() :
+	m_n_rec_single_year(1), m_n_rec_lifetime(0)
+{
+}
+
+template <class T>
+lifetime_series<T>::lifetime_series(const std::vector<T> &lifetime_vector) :
+	m_single_year(lifetime_vector), m_scale_factor(1, 1),
+	m_n_rec_single_year(lifetime_vector.empty() ? 1 : lifetime_vector.size()), m_n_rec_lifetime(lifetime_vector.size())
+{
+}
+
+template <class T>
+lifetime_series<T>::lifetime_series(const std::vector<T> &single_year, const std::vector<T> &scale_factor, size_t n_rec_single_year, size_t n_rec_lifetime) :
+	m_single_year(single_year), m_scale_factor(scale_factor),
+	m_n_rec_single_year(n_rec_single_year > 0 ? n_rec_single_year : 1), m_n_rec_lifetime(n_rec_lifetime)
+{
+}
+
+template <class T>
+std::vector<T> lifetime_series<T>::to_vector() const
+{
+	std::vector<T> lifetime_vector;
+	lifetime_vector.reserve(m_n_rec_lifetime);
+	for (size_t i = 0; i < m_n_rec_lifetime; i++)
+		lifetime_vector.push_back((*this)[i]);
+	return lifetime_vector;
 }
 
-template void single_year_to_lifetime_interpolated<double>(bool, size_t, size_t,std::vector<double>, std::vector<double>, double, std::vector<double> &, size_t &, double &);
-template void single_year_to_lifetime_interpolated<float>(bool, size_t, size_t, std::vector<float>, std::vector<float>, double, std::vector<float> &, size_t &, double &);
+template class lifetime_series<double>;
+template class lifetime_series<float>;
 
 
 
@@ -190,7 +274,7 @@ template std::vector<double> flatten_diurnal(util::matrix_t<size_t> weekday_sche
 * \param[out] extrapolated_vector - The 8760*steps per hour values
 */
 template <class T>
-std::vector<T> extrapolate_timeseries(std::vector<T> input_values, size_t steps_per_hour, T multiplier)
+std::vector<T> extrapolate_timeseries(const std::vector<T> &input_values, size_t steps_per_hour, T multiplier)
 {
 	std::vector<T> extrapolated_vector;
 	extrapolated_vector.reserve(8760 * steps_per_hour);
@@ -224,4 +308,4 @@ std::vector<T> extrapolate_timeseries(std::vector<T> input_values, size_t steps_
 	return extrapolated_vector;
 }
 
-template std::vector<double> extrapolate_timeseries(std::vector<double> input_values, size_t steps_per_hour, double multiplier);
+template std::vector<double> extrapolate_timeseries(const std::vector<double> &input_values, size_t steps_per_hour, double multiplier);
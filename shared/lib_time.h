@@ -49,13 +49,71 @@ void single_year_to_lifetime_interpolated(
 	bool is_lifetime,
 	size_t n_years,
 	size_t n_lifetime,
-	std::vector<T> singleyear_vector,
-    std::vector<T> scale_factor,
+	const std::vector<T> &singleyear_vector,
+    const std::vector<T> &scale_factor,
     double interpolation_factor,
 	std::vector<T> &lifetime_from_singleyear_vector,
 	size_t &n_rec_single_year,
 	double &dt_hour);
 
+/**
+Lifetime (multi-year) view of a single year vector. Holds the single year vector at the lifetime time resolution
+and the annual scale factors, and returns value(year, step) = single_year[step] * scale_factor[year] on access
+instead of storing n_years x n_rec_single_year values. Indexing matches single_year_to_lifetime_interpolated.
+*/
+template <typename T>
+class lifetime_series
+{
+public:
+	lifetime_series();
+
+	/// Wraps an already-lifetime vector, no scaling
+	explicit lifetime_series(const std::vector<T> &lifetime_vector);
+
+	/// single_year is either one value or n_rec_single_year values at the lifetime time resolution
+	lifetime_series(const std::vector<T> &single_year, const std::vector<T> &scale_factor, size_t n_rec_single_year, size_t n_rec_lifetime);
+
+	size_t size() const { return m_n_rec_lifetime; }
+	bool empty() const { return m_n_rec_lifetime == 0; }
+	size_t n_rec_single_year() const { return m_n_rec_single_year; }
+	size_t n_years() const { return m_scale_factor.size(); }
+
+	T at(size_t year, size_t step) const {
+		if (m_single_year.empty())
+			return 0;
+		return m_single_year[m_single_year.size() == 1 ? 0 : step] * m_scale_factor[year];
+	}
+	T operator[](size_t i) const {
+		size_t year = i / m_n_rec_single_year;
+		return at(year, i - year * m_n_rec_single_year);
+	}
+
+	/// Materializes the lifetime vector for consumers that need contiguous storage
+	std::vector<T> to_vector() const;
+
+private:
+	std::vector<T> m_single_year;
+	std::vector<T> m_scale_factor;
+	size_t m_n_rec_single_year;
+	size_t m_n_rec_lifetime;
+};
+
+/**
+Same inputs and outputs as single_year_to_lifetime_interpolated, but returns a lifetime_series rather than
+allocating the full lifetime vector
+*/
+template <typename T>
+void single_year_to_lifetime_series(
+	bool is_lifetime,
+	size_t n_years,
+	size_t n_lifetime,
+	const std::vector<T> &singleyear_vector,
+	const std::vector<T> &scale_factor,
+	double interpolation_factor,
+	lifetime_series<T> &lifetime_from_singleyear,
+	size_t &n_rec_single_year,
+	double &dt_hour);
+
 /**
 Function takes in a weekday and weekend schedule, plus the period values and an optional multiplier and returns
 a vector
@@ -68,7 +126,7 @@ Function takes input values, desired steps per hour, and an optional multiplier
 a vector
 */
 template<typename T>
-std::vector<T> extrapolate_timeseries(std::vector<T> input_values, size_t steps_per_hour, T multiplier = 1.0);
+std::vector<T> extrapolate_timeseries(const std::vector<T> &input_values, size_t steps_per_hour, T multiplier = 1.0);
 
 #endif // !__LIB_TIME_H__
 
@@ -1255,6 +1255,78 @@ size_t util::yearOneIndex(double dtHour, size_t lifetimeIndex)
 	return indexYearOne;
 }
 
+util::sliding_window::sliding_window(size_t width)
+	: m_width(width), m_start(0), m_end(0), m_valid(false), m_sum(0), m_steps_since_sum(0)
+{
+}
+
+void util::sliding_window::set_width(size_t width)
+{
+	m_width = width;
+	m_sorted.reserve(width);
+	reset();
+}
+
+void util::sliding_window::reset()
+{
+	m_valid = false;
+}
+
+void util::sliding_window::rebuild(const std::vector<double> &series, size_t start, size_t end)
+{
+	m_sorted.assign(series.begin() + start, series.begin() + end);
+	std::sort(m_sorted.begin(), m_sorted.end());
+	m_sum = std::accumulate(series.begin() + start, series.begin() + end, 0.0);
+	m_steps_since_sum = 0;
+	m_start = start;
+	m_end = end;
+	m_valid = true;
+}
+
+void util::sliding_window::update(const std::vector<double> &series, size_t start)
+{
+	size_t end = std::min(start + m_width, series.size());
+	start = std::min(start, end);
+
+	if (m_valid && start == m_start && end == m_end)
+		return;
+
+	// only a one step advance is incremental: drop series[m_start] and, unless clamped, take in series[m_end]
+	if (!m_valid || start != m_start + 1 || end < m_end || end > m_end + 1 || m_end <= m_start
+		|| ++m_steps_since_sum >= m_width)
+	{
+		rebuild(series, start, end);
+		return;
+	}
+
+	double out = series[m_start];
+	std::vector<double>::iterator pos = std::lower_bound(m_sorted.begin(), m_sorted.end(), out);
+	if (end == m_end)
+	{
+		m_sorted.erase(pos);
+		m_sum -= out;
+	}
+	else
+	{
+		double in = series[m_end];
+		if (in < out)
+		{
+			std::vector<double>::iterator ins = std::upper_bound(m_sorted.begin(), pos, in);
+			std::move_backward(ins, pos, pos + 1);
+			*ins = in;
+		}
+		else if (in > out)
+		{
+			std::vector<double>::iterator ins = std::lower_bound(pos + 1, m_sorted.end(), in);
+			std::move(pos + 1, ins, pos);
+			*(ins - 1) = in;
+		}
+		m_sum += in - out;
+	}
+	m_start = start;
+	m_end = end;
+}
+
 std::vector<double> util::frequency_table(double* values, size_t n_vals, double bin_width)
 {
     if (!values)
@@ -212,6 +212,39 @@ namespace util
 		FILE *p;
 	};
 
+	/* running order statistics, extremes and sum over the window [start, start + width) of a series, clamped
+	   to the series length. Advancing the window by one step keeps it sorted with O(width) moves instead of
+	   a sort; any other move rebuilds it. Call reset() whenever the series contents change. */
+	class sliding_window
+	{
+	public:
+		sliding_window(size_t width = 0);
+
+		void set_width(size_t width);
+		size_t width() const { return m_width; }
+		void reset();
+		void update(const std::vector<double> &series, size_t start);
+
+		size_t size() const { return m_sorted.size(); }
+		bool empty() const { return m_sorted.empty(); }
+		double min() const { return m_sorted.front(); }
+		double max() const { return m_sorted.back(); }
+		double nth_smallest(size_t n) const { return m_sorted[n]; } /* n = 0 is the minimum */
+		double nth_largest(size_t n) const { return m_sorted[m_sorted.size() - n - 1]; } /* n = 0 is the maximum */
+		double sum() const { return m_sum; }
+
+	private:
+		void rebuild(const std::vector<double> &series, size_t start, size_t end);
+
+		std::vector<double> m_sorted;
+		size_t m_width;
+		size_t m_start;
+		size_t m_end;
+		bool m_valid;
+		double m_sum;
+		size_t m_steps_since_sum; // the running sum is recomputed once per window turnover to bound round-off drift
+	};
+
 	template< typename T, size_t n_rows, size_t n_cols >
 	class matrix_static_t
 	{
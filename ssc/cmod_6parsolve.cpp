@@ -105,7 +105,7 @@ public:
             Tref = as_double("Tref");
 
         module6par m(tech_id, Vmp, Imp, Voc, Isc, bVoc, aIsc, gPmp, nser, Tref + 273.15);
-        int err = m.solve_with_sanity_and_heuristics<double>(300, 1e-7);
+        int err = module6par_solve_cached(m, 300, 1e-7);
 
         int err_keys[10] = { -1, -2, -3, -4, -5, -6, -7, -33, -44, -55 };
         int x;
@@ -135,3 +135,96 @@ public:
 };
 
 DEFINE_MODULE_ENTRY( 6parsolve, "Solver for CEC/6 parameter PV module coefficients", 1 )
+
+
+static var_info _cm_vtab_6parsolve_batch[] = {
+/*   VARTYPE           DATATYPE         NAME                           LABEL                                UNITS     META                      GROUP                      REQUIRED_IF                 CONSTRAINTS                      UI_HINTS*/
+	{ SSC_INPUT,         SSC_ARRAY,       "celltech",               "Cell technology type",           "",        "monoSi=0,multiSi=1,CdTe=2,CIS=3,CIGS=4,Amorphous=5","Six Parameter Solver","*",         "",      "" },
+	{ SSC_INPUT,         SSC_ARRAY,       "Vmp",                    "Maximum power point voltage",    "V",       "",                      "Six Parameter Solver",      "*",                       "LENGTH_EQUAL=celltech",      "" },
+	{ SSC_INPUT,         SSC_ARRAY,       "Imp",                    "Maximum power point current",    "A",       "",                      "Six Parameter Solver",      "*",                       "LENGTH_EQUAL=celltech",      "" },
+	{ SSC_INPUT,         SSC_ARRAY,       "Voc",                    "Open circuit voltage",           "V",       "",                      "Six Parameter Solver",      "*",                       "LENGTH_EQUAL=celltech",      "" },
+	{ SSC_INPUT,         SSC_ARRAY,       "Isc",                    "Short circuit current",          "A",       "",                      "Six Parameter Solver",      "*",                       "LENGTH_EQUAL=celltech",      "" },
+	{ SSC_INPUT,         SSC_ARRAY,       "alpha_isc",              "Temp coeff of current at SC",    "A/'C",    "",                      "Six Parameter Solver",      "*",                       "LENGTH_EQUAL=celltech",      "" },
+	{ SSC_INPUT,         SSC_ARRAY,       "beta_voc",               "Temp coeff of voltage at OC",    "V/'C",    "",                      "Six Parameter Solver",      "*",                       "LENGTH_EQUAL=celltech",      "" },
+	{ SSC_INPUT,         SSC_ARRAY,       "gamma_pmp",              "Temp coeff of power at MP",      "%/'C",    "",                      "Six Parameter Solver",      "*",                       "LENGTH_EQUAL=celltech",      "" },
+	{ SSC_INPUT,         SSC_ARRAY,       "Nser",                   "Number of cells in series",      "",        "",                      "Six Parameter Solver",      "*",                       "LENGTH_EQUAL=celltech",      "" },
+	{ SSC_INPUT,         SSC_ARRAY,       "Tref",                   "Reference cell temperature",     "'C",      "default 25",            "Six Parameter Solver",      "?",                       "LENGTH_EQUAL=celltech",      "" },
+	{ SSC_INPUT,         SSC_NUMBER,      "n_threads",              "Number of solver threads",       "",        "0=use all hardware threads","Six Parameter Solver",   "?=0",                     "MIN=0,INTEGER",      "" },
+	{ SSC_INPUT,         SSC_STRING,      "cache_file",             "Solved coefficient cache file",  "",        "coefficients are read from and new solutions added to this file","Six Parameter Solver","?","",      "" },
+
+// outputs
+	{ SSC_OUTPUT,        SSC_ARRAY,       "a",                      "Modified nonideality factor",    "1/V",    "",                      "Six Parameter Solver",      "*",                        "",                      "" },
+	{ SSC_OUTPUT,        SSC_ARRAY,       "Il",                     "Light current",                  "A",      "",                      "Six Parameter Solver",      "*",                        "",                      "" },
+	{ SSC_OUTPUT,        SSC_ARRAY,       "Io",                     "Saturation current",             "A",      "",                      "Six Parameter Solver",      "*",                        "",                      "" },
+	{ SSC_OUTPUT,        SSC_ARRAY,       "Rs",                     "Series resistance",              "ohm",    "",                      "Six Parameter Solver",      "*",                        "",                      "" },
+	{ SSC_OUTPUT,        SSC_ARRAY,       "Rsh",                    "Shunt resistance",               "ohm",    "",                      "Six Parameter Solver",      "*",                        "",                      "" },
+	{ SSC_OUTPUT,        SSC_ARRAY,       "Adj",                    "OC SC temp coeff adjustment",    "%",      "",                      "Six Parameter Solver",      "*",                        "",                      "" },
+	{ SSC_OUTPUT,        SSC_ARRAY,       "err",                    "Solver status",                  "",       "0=solved, otherwise the sanity check that failed","Six Parameter Solver","*",            "",                      "" },
+
+var_info_invalid };
+
+class cm_6parsolve_batch : public compute_module
+{
+public:
+
+	cm_6parsolve_batch()
+	{
+		add_var_info( _cm_vtab_6parsolve_batch );
+	}
+
+    void exec()
+    {
+        size_t n = 0;
+        ssc_number_t *tech = as_array("celltech", &n);
+        ssc_number_t *Vmp = as_array("Vmp", nullptr);
+        ssc_number_t *Imp = as_array("Imp", nullptr);
+        ssc_number_t *Voc = as_array("Voc", nullptr);
+        ssc_number_t *Isc = as_array("Isc", nullptr);
+        ssc_number_t *bVoc = as_array("beta_voc", nullptr);
+        ssc_number_t *aIsc = as_array("alpha_isc", nullptr);
+        ssc_number_t *gPmp = as_array("gamma_pmp", nullptr);
+        ssc_number_t *nser = as_array("Nser", nullptr);
+        ssc_number_t *Tref = is_assigned("Tref") ? as_array("Tref", nullptr) : nullptr;
+
+        std::vector<module6par> modules;
+        modules.reserve(n);
+        for (size_t i = 0; i < n; i++)
+        {
+            int tech_id = (int)tech[i];
+            if (tech_id < module6par::monoSi || tech_id > module6par::Amorphous)
+                throw exec_error("6parsolve_batch", util::format("invalid cell technology %d for module %d", tech_id, (int)i));
+            modules.push_back(module6par(tech_id, Vmp[i], Imp[i], Voc[i], Isc[i], bVoc[i], aIsc[i], gPmp[i], (int)nser[i],
+                (Tref ? Tref[i] : 25) + 273.15));
+        }
+
+        std::string cache_file = is_assigned("cache_file") ? as_string("cache_file") : "";
+        module6par_cache &cache = module6par_cache::instance();
+        if (!cache_file.empty() && !cache.load(cache_file))
+            log("could not read solved coefficients from " + cache_file, SSC_WARNING);
+
+        std::vector<int> err = module6par_solve_batch(modules, 300, 1e-7, as_integer("n_threads"), &cache);
+
+        if (!cache_file.empty() && !cache.save(cache_file))
+            log("could not write solved coefficients to " + cache_file, SSC_WARNING);
+
+        ssc_number_t *a = allocate("a", n);
+        ssc_number_t *Il = allocate("Il", n);
+        ssc_number_t *Io = allocate("Io", n);
+        ssc_number_t *Rs = allocate("Rs", n);
+        ssc_number_t *Rsh = allocate("Rsh", n);
+        ssc_number_t *Adj = allocate("Adj", n);
+        ssc_number_t *status = allocate("err", n);
+        for (size_t i = 0; i < n; i++)
+        {
+            a[i] = (ssc_number_t)modules[i].a;
+            Il[i] = (ssc_number_t)modules[i].Il;
+            Io[i] = (ssc_number_t)modules[i].Io;
+            Rs[i] = (ssc_number_t)modules[i].Rs;
+            Rsh[i] = (ssc_number_t)modules[i].Rsh;
+            Adj[i] = (ssc_number_t)modules[i].Adj;
+            status[i] = (ssc_number_t)err[i];
+        }
+	}
+};
+
+DEFINE_MODULE_ENTRY( 6parsolve_batch, "Solver for CEC/6 parameter PV module coefficients of a module library", 1 )
@@ -349,7 +349,7 @@ var_info vtab_battery_outputs[] = {
 
     var_info_invalid };
 
-battstor::battstor(var_table& vt, bool setup_model, size_t nrec, double dt_hr, const std::shared_ptr<batt_variables>& batt_vars_in)
+battstor::battstor(var_table& vt, bool setup_model, size_t nrec, double dt_hr, const std::shared_ptr<batt_variables>& batt_vars_in, compute_module *cm)
 {
     make_vars = false;
     utilityRate = NULL;
@@ -568,7 +568,7 @@ battstor::battstor(var_table& vt, bool setup_model, size_t nrec, double dt_hr, c
             if (vt.is_assigned("grid_curtailment")) {
                 curtailment_year_one = vt.as_vector_double("grid_curtailment");
                 double interpolation_factor = 1.0;
-                single_year_to_lifetime_interpolated<double>(
+                single_year_to_lifetime_series<double>(
                     batt_vars->system_use_lifetime_output,
                     (size_t)batt_vars->analysis_period,
                     total_steps,
@@ -959,39 +959,46 @@ battstor::battstor(var_table& vt, bool setup_model, size_t nrec, double dt_hr, c
     Initialize outputs
     ********************************************************************** */
 
+    // time series only written for reporting, left NULL if the output selection of cm does not request them
+    auto allocate_reported = [&](const std::string &name) {
+        if (cm)
+            return cm->allocate_if_requested(name, nrec * nyears);
+        return vt.allocate(name, nrec * nyears);
+    };
+
     // only allocate if lead-acid
     if (chem == 0)
     {
-        outAvailableCharge = vt.allocate("batt_q1", nrec * nyears);
-        outBoundCharge = vt.allocate("batt_q2", nrec * nyears);
-    }
-    outCellVoltage = vt.allocate("batt_voltage_cell", nrec * nyears);
-    outMaxCharge = vt.allocate("batt_qmax", nrec * nyears);
-    outMaxChargeThermal = vt.allocate("batt_qmax_thermal", nrec * nyears);
-    outBatteryTemperature = vt.allocate("batt_temperature", nrec * nyears);
-    outCapacityThermalPercent = vt.allocate("batt_capacity_thermal_percent", nrec * nyears);
-
-    outCurrent = vt.allocate("batt_I", nrec * nyears);
-    outBatteryVoltage = vt.allocate("batt_voltage", nrec * nyears);
-    outTotalCharge = vt.allocate("batt_q0", nrec * nyears);
-    outCycles = vt.allocate("batt_cycles", nrec * nyears);
+        outAvailableCharge = allocate_reported("batt_q1");
+        outBoundCharge = allocate_reported("batt_q2");
+    }
+    outCellVoltage = allocate_reported("batt_voltage_cell");
+    outMaxCharge = allocate_reported("batt_qmax");
+    outMaxChargeThermal = allocate_reported("batt_qmax_thermal");
+    outBatteryTemperature = allocate_reported("batt_temperature");
+    outCapacityThermalPercent = allocate_reported("batt_capacity_thermal_percent");
+
+    outCurrent = allocate_reported("batt_I");
+    outBatteryVoltage = allocate_reported("batt_voltage");
+    outTotalCharge = allocate_reported("batt_q0");
+    outCycles = allocate_reported("batt_cycles");
     outSOC = vt.allocate("batt_SOC", nrec * nyears);
-    outDOD = vt.allocate("batt_DOD", nrec * nyears);
-    outDODCycleAverage = vt.allocate("batt_DOD_cycle_average", nrec * nyears);
-    outCapacityPercent = vt.allocate("batt_capacity_percent", nrec * nyears);
+    outDOD = allocate_reported("batt_DOD");
+    outDODCycleAverage = allocate_reported("batt_DOD_cycle_average");
+    outCapacityPercent = allocate_reported("batt_capacity_percent");
     if (batt_vars->batt_life_model == lifetime_params::CALCYC || batt_vars->batt_life_model == lifetime_params::LMOLTO) {
-        outCapacityPercentCycle = vt.allocate("batt_capacity_percent_cycle", nrec * nyears);
-        outCapacityPercentCalendar = vt.allocate("batt_capacity_percent_calendar", nrec * nyears);
+        outCapacityPercentCycle = allocate_reported("batt_capacity_percent_cycle");
+        outCapacityPercentCalendar = allocate_reported("batt_capacity_percent_calendar");
     }
     outBatteryPowerAC = vt.allocate("batt_power", nrec * nyears);
-    outBatteryPowerDC = vt.allocate("batt_power_dc", nrec * nyears);
+    outBatteryPowerDC = allocate_reported("batt_power_dc");
     outGridPower = vt.allocate("grid_power", nrec * nyears); // Net grid energy required.  Positive indicates putting energy on grid.  Negative indicates pulling off grid
     outGenPower = vt.allocate("pv_batt_gen", nrec * nyears);
     outGenWithoutBattery = vt.allocate("gen_without_battery", nrec * nyears);
     outSystemToGrid = vt.allocate("system_to_grid", nrec * nyears);
     outBatteryToSystemLoad = vt.allocate("batt_to_system_load", nrec * nyears);
     outBatteryToGrid = vt.allocate("batt_to_grid", nrec * nyears);
-    outBatteryToInverterDC = vt.allocate("batt_to_inverter_dc", nrec * nyears);
+    outBatteryToInverterDC = allocate_reported("batt_to_inverter_dc");
 
     if (batt_vars->batt_meter_position == dispatch_t::BEHIND)
     {
@@ -1026,7 +1033,7 @@ battstor::battstor(var_table& vt, bool setup_model, size_t nrec, double dt_hr, c
         }
     }
     outSystemToBattAC = vt.allocate("system_to_batt", nrec * nyears);
-    outSystemToBattDC = vt.allocate("system_to_batt_dc", nrec * nyears);
+    outSystemToBattDC = allocate_reported("system_to_batt_dc");
     outGridToBatt = vt.allocate("grid_to_batt", nrec * nyears);
 
     if (batt_vars->en_fuelcell) {
@@ -1039,11 +1046,11 @@ battstor::battstor(var_table& vt, bool setup_model, size_t nrec, double dt_hr, c
     bool cycleCostRelevant = (batt_vars->batt_meter_position == dispatch_t::BEHIND && batt_vars->batt_dispatch == dispatch_t::RETAIL_RATE) ||
         (batt_vars->batt_meter_position == dispatch_t::FRONT && (batt_vars->batt_dispatch != dispatch_t::FOM_MANUAL && batt_vars->batt_dispatch != dispatch_t::FOM_CUSTOM_DISPATCH));
     if (cycleCostRelevant && batt_vars->batt_cycle_cost_choice == dispatch_t::MODEL_CYCLE_COST) {
-        outCostToCycle = vt.allocate("batt_cost_to_cycle", nrec * nyears);
+        outCostToCycle = allocate_reported("batt_cost_to_cycle");
     }
 
-    outBatteryConversionPowerLoss = vt.allocate("batt_conversion_loss", nrec * nyears);
-    outBatterySystemLoss = vt.allocate("batt_system_loss", nrec * nyears);
+    outBatteryConversionPowerLoss = allocate_reported("batt_conversion_loss");
+    outBatterySystemLoss = allocate_reported("batt_system_loss");
     outInterconnectionLoss = vt.allocate("interconnection_loss", nrec * nyears);
 
     if (analyze_outage) {
@@ -1852,32 +1859,32 @@ void battstor::outputs_fixed()
     // Capacity Output with Losses Applied
     if (chem == battery_params::LEAD_ACID)
     {
-        outAvailableCharge[index] = (ssc_number_t)(state.capacity->leadacid.q1);
-        outBoundCharge[index] = (ssc_number_t)(state.capacity->leadacid.q2);
+        if (outAvailableCharge) outAvailableCharge[index] = (ssc_number_t)(state.capacity->leadacid.q1);
+        if (outBoundCharge) outBoundCharge[index] = (ssc_number_t)(state.capacity->leadacid.q2);
     }
-    outCellVoltage[index] = (ssc_number_t)(state.voltage->cell_voltage);
-    outMaxCharge[index] = (ssc_number_t)(state.capacity->qmax_lifetime);
-    outMaxChargeThermal[index] = (ssc_number_t)(state.capacity->qmax_thermal);
+    if (outCellVoltage) outCellVoltage[index] = (ssc_number_t)(state.voltage->cell_voltage);
+    if (outMaxCharge) outMaxCharge[index] = (ssc_number_t)(state.capacity->qmax_lifetime);
+    if (outMaxChargeThermal) outMaxChargeThermal[index] = (ssc_number_t)(state.capacity->qmax_thermal);
 
-    outBatteryTemperature[index] = (ssc_number_t)state.thermal->T_batt;
-    outCapacityThermalPercent[index] = (ssc_number_t)(state.thermal->q_relative_thermal);
+    if (outBatteryTemperature) outBatteryTemperature[index] = (ssc_number_t)state.thermal->T_batt;
+    if (outCapacityThermalPercent) outCapacityThermalPercent[index] = (ssc_number_t)(state.thermal->q_relative_thermal);
     
-    outTotalCharge[index] = (ssc_number_t)(state.capacity->q0);
-    outCurrent[index] = (ssc_number_t)(state.capacity->cell_current);
-    outBatteryVoltage[index] = (ssc_number_t)(battery_model->V());
+    if (outTotalCharge) outTotalCharge[index] = (ssc_number_t)(state.capacity->q0);
+    if (outCurrent) outCurrent[index] = (ssc_number_t)(state.capacity->cell_current);
+    if (outBatteryVoltage) outBatteryVoltage[index] = (ssc_number_t)(battery_model->V());
 
-    outCycles[index] = (ssc_number_t)(state.lifetime->n_cycles);
+    if (outCycles) outCycles[index] = (ssc_number_t)(state.lifetime->n_cycles);
     outSOC[index] = (ssc_number_t)(state.capacity->SOC);
-    outDOD[index] = (ssc_number_t)(state.lifetime->cycle_range);
-    outDODCycleAverage[index] = (ssc_number_t)(state.lifetime->average_range);
-    outCapacityPercent[index] = (ssc_number_t)(state.lifetime->q_relative);
+    if (outDOD) outDOD[index] = (ssc_number_t)(state.lifetime->cycle_range);
+    if (outDODCycleAverage) outDODCycleAverage[index] = (ssc_number_t)(state.lifetime->average_range);
+    if (outCapacityPercent) outCapacityPercent[index] = (ssc_number_t)(state.lifetime->q_relative);
     if (batt_vars->batt_life_model == lifetime_params::CALCYC) {
-        outCapacityPercentCycle[index] = (ssc_number_t)(state.lifetime->cycle->q_relative_cycle);
-        outCapacityPercentCalendar[index] = (ssc_number_t)(state.lifetime->calendar->q_relative_calendar);
+        if (outCapacityPercentCycle) outCapacityPercentCycle[index] = (ssc_number_t)(state.lifetime->cycle->q_relative_cycle);
+        if (outCapacityPercentCalendar) outCapacityPercentCalendar[index] = (ssc_number_t)(state.lifetime->calendar->q_relative_calendar);
     }
     else if (batt_vars->batt_life_model == lifetime_params::LMOLTO) {
-        outCapacityPercentCycle[index] = (ssc_number_t)(100. - state.lifetime->lmo_lto->dq_relative_cyc);
-        outCapacityPercentCalendar[index] = (ssc_number_t)(100. - state.lifetime->lmo_lto->dq_relative_cal);
+        if (outCapacityPercentCycle) outCapacityPercentCycle[index] = (ssc_number_t)(100. - state.lifetime->lmo_lto->dq_relative_cyc);
+        if (outCapacityPercentCalendar) outCapacityPercentCalendar[index] = (ssc_number_t)(100. - state.lifetime->lmo_lto->dq_relative_cal);
     }
 }
 
@@ -1885,11 +1892,11 @@ void battstor::outputs_topology_dependent()
 {
     // Power output (all Powers in kWac)
     outBatteryPowerAC[index] = (ssc_number_t)(dispatch_model->power_tofrom_battery_ac());
-    outBatteryPowerDC[index] = (ssc_number_t)(dispatch_model->power_tofrom_battery_dc());
+    if (outBatteryPowerDC) outBatteryPowerDC[index] = (ssc_number_t)(dispatch_model->power_tofrom_battery_dc());
     outGridPower[index] = (ssc_number_t)(dispatch_model->power_tofrom_grid());
     outGenPower[index] = (ssc_number_t)(dispatch_model->power_gen());
     outSystemToBattAC[index] = (ssc_number_t)(dispatch_model->power_pv_to_batt_ac());
-    outSystemToBattDC[index] = (ssc_number_t)(dispatch_model->power_pv_to_batt_dc());
+    if (outSystemToBattDC) outSystemToBattDC[index] = (ssc_number_t)(dispatch_model->power_pv_to_batt_dc());
     outGridToBatt[index] = (ssc_number_t)(dispatch_model->power_grid_to_batt());
     outBatteryToGrid[index] = (ssc_number_t)(dispatch_model->power_battery_to_grid());
 
@@ -1899,11 +1906,11 @@ void battstor::outputs_topology_dependent()
         outFuelCellToBatt[index] = (ssc_number_t)(dispatch_model->power_fuelcell_to_batt());
         outFuelCellToGrid[index] = (ssc_number_t)(dispatch_model->power_fuelcell_to_grid());
     }
-    outBatteryConversionPowerLoss[index] = (ssc_number_t)(dispatch_model->power_conversion_loss());
-    outBatterySystemLoss[index] = (ssc_number_t)(dispatch_model->power_system_loss());
+    if (outBatteryConversionPowerLoss) outBatteryConversionPowerLoss[index] = (ssc_number_t)(dispatch_model->power_conversion_loss());
+    if (outBatterySystemLoss) outBatterySystemLoss[index] = (ssc_number_t)(dispatch_model->power_system_loss());
     outSystemToGrid[index] = (ssc_number_t)(dispatch_model->power_pv_to_grid());
     outBatteryToSystemLoad[index] = (ssc_number_t)(dispatch_model->power_battery_to_system_load());
-    outBatteryToInverterDC[index] = (ssc_number_t)(dispatch_model->power_battery_to_inverter_dc());
+    if (outBatteryToInverterDC) outBatteryToInverterDC[index] = (ssc_number_t)(dispatch_model->power_battery_to_inverter_dc());
     outInterconnectionLoss[index] = (ssc_number_t)(dispatch_model->power_interconnection_loss());
 
     if (batt_vars->batt_meter_position == dispatch_t::BEHIND)
@@ -1952,7 +1959,7 @@ void battstor::outputs_topology_dependent()
     bool cycleCostRelevant = (batt_vars->batt_meter_position == dispatch_t::BEHIND && batt_vars->batt_dispatch == dispatch_t::RETAIL_RATE) ||
         (batt_vars->batt_meter_position == dispatch_t::FRONT && (batt_vars->batt_dispatch != dispatch_t::FOM_MANUAL && batt_vars->batt_dispatch != dispatch_t::FOM_CUSTOM_DISPATCH));
     if (cycleCostRelevant && batt_vars->batt_cycle_cost_choice == dispatch_t::MODEL_CYCLE_COST) {
-        outCostToCycle[index] = (ssc_number_t)(dispatch_model->cost_to_cycle_per_kwh());
+        if (outCostToCycle) outCostToCycle[index] = (ssc_number_t)(dispatch_model->cost_to_cycle_per_kwh());
     }
 }
 
@@ -2270,7 +2277,8 @@ public:
         if (as_boolean("en_batt") || as_boolean("en_standalone_batt") || as_boolean("en_wave_batt"))
         {
             std::vector<ssc_number_t> power_input_lifetime;
-            std::vector<ssc_number_t> load_lifetime, load_year_one;
+            std::vector<ssc_number_t> load_year_one;
+            lifetime_series<ssc_number_t> load_lifetime;
             std::vector<ssc_number_t> grid_curtailment;
             size_t nload;
             size_t ngrid;
@@ -2335,7 +2343,7 @@ public:
 
             }
 
-            auto batt = std::make_shared<battstor>(*m_vartab, true, n_rec_single_year, dt_hour_gen);
+            auto batt = std::make_shared<battstor>(*m_vartab, true, n_rec_single_year, dt_hour_gen, nullptr, this);
 
             if (is_assigned("crit_load")) {
                 bool crit_load_specified = !p_crit_load.empty() && *std::max_element(p_crit_load.begin(), p_crit_load.end()) > 0;
@@ -2361,7 +2369,7 @@ public:
             std::vector<ssc_number_t> load_scale = scale_calculator.get_factors("load_escalation");
 
             double interpolation_factor = 1.0;
-            single_year_to_lifetime_interpolated<ssc_number_t>(
+            single_year_to_lifetime_series<ssc_number_t>(
                 use_lifetime,
                 analysis_period,
                 n_rec_lifetime,
@@ -2423,7 +2431,7 @@ public:
                     dt_hour_gen);
             }
             else {
-                p_load_forecast_full = load_lifetime;
+                p_load_forecast_full = load_lifetime.to_vector();
             }
 
             // Create battery structure and initialize
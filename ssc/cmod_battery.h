@@ -38,6 +38,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "core.h"
 #include "lib_battery.h"
+#include "lib_time.h"
 #include "lib_utility_rate.h"
 #include "cmod_utilityrate5.h"
 
@@ -257,14 +258,15 @@ struct batt_variables
     /* Interconnection, curtailment, and outages for dispatch */
     bool enable_interconnection_limit;
     double grid_interconnection_limit_kW;
-    std::vector<double> gridCurtailmentLifetime_MW;
+    lifetime_series<double> gridCurtailmentLifetime_MW;
     std::vector<bool> grid_outage_steps;
 };
 
 struct battstor
 {
-	/// Pass in the single-year number of records
-	battstor(var_table &vt, bool setup_model, size_t nrec, double dt_hr, const std::shared_ptr<batt_variables>& batt_vars_in=0);
+	/// Pass in the single-year number of records. If cm is given, time series that are only reported are not allocated
+	/// unless cm's output selection requests them
+	battstor(var_table &vt, bool setup_model, size_t nrec, double dt_hr, const std::shared_ptr<batt_variables>& batt_vars_in=0, compute_module *cm=0);
 
     battstor(const battstor& orig);
 
@@ -228,7 +228,7 @@ battwatts_create(size_t n_recs, size_t n_years, int chem, int meter_pos, double
     batt_vars->batt_minimum_modetime = 10;
 
     // Interconnection and curtailment
-    batt_vars->gridCurtailmentLifetime_MW = curtailment_limit;
+    batt_vars->gridCurtailmentLifetime_MW = lifetime_series<double>(curtailment_limit);
     batt_vars->grid_interconnection_limit_kW = interconnection_limit;
     if (interconnection_limit < 1e+38) {
         batt_vars->enable_interconnection_limit = true;
@@ -379,11 +379,11 @@ void cm_battwatts::exec()
         // compute load (electric demand) annual escalation multipliers
         std::vector<ssc_number_t> load_scale = scale_calculator.get_factors("load_escalation");
 
-        std::vector<ssc_number_t> load_lifetime;
+        lifetime_series<ssc_number_t> load_lifetime;
         size_t n_rec_single_year;
         double dt_hour_gen;
         double interpolation_factor = 1.0;
-        single_year_to_lifetime_interpolated<ssc_number_t>(
+        single_year_to_lifetime_series<ssc_number_t>(
                 (bool)as_integer("system_use_lifetime_output"),
                 analysis_period,
                 n_rec_lifetime,
@@ -394,7 +394,7 @@ void cm_battwatts::exec()
                 n_rec_single_year,
                 dt_hour_gen);
 
-        auto batt = std::make_shared<battstor>(*m_vartab, true, p_ac.size(), dt_hour_gen, batt_vars);
+        auto batt = std::make_shared<battstor>(*m_vartab, true, p_ac.size(), dt_hour_gen, batt_vars, this);
         batt->initialize_automated_dispatch(p_ac, p_load);
 
 
@@ -118,6 +118,7 @@ static var_info _cm_vtab_fresnel_physical[] = {
     /*X*/       /*Col & Rec*/{ SSC_INPUT,    SSC_MATRIX,         "OpticalTable",                "Values of the optical efficiency table",                                                "",                    "",                             "Col_Rec",              "*",                "",                 "" },
 
     /*X*/       /*Col & Rec*/{ SSC_INPUT,    SSC_NUMBER,         "rec_model",                   "Receiver model type (1=Polynomial ; 2=Evac tube)",                                      "",                    "",                             "Col_Rec",              "*",                "INTEGER",          "" },
+                /*Col & Rec*/{ SSC_INPUT,    SSC_NUMBER,         "use_hl_surrogate",            "Use evacuated receiver heat loss tables built at initialization",                       "",                    "",                             "Col_Rec",              "?=0",              "",                 "" },
     /*X*/       /*Col & Rec*/{ SSC_INPUT,    SSC_ARRAY,          "HCE_FieldFrac",               "The fraction of the field occupied by this HCE type",                                   "",                    "",                             "Col_Rec",              "*",                "",                 "" },
     /*X*/       /*Col & Rec*/{ SSC_INPUT,    SSC_ARRAY,          "D_abs_in",                    "The inner absorber tube diameter",                                                      "m",                   "",                             "Col_Rec",              "*",                "",                 "" },
     /*X*/       /*Col & Rec*/{ SSC_INPUT,    SSC_ARRAY,          "D_abs_out",                   "The outer absorber tube diameter",                                                      "m",                   "",                             "Col_Rec",              "*",                "",                 "" },
@@ -728,6 +729,7 @@ public:
                 c_fresnel.m_IAM_L_coefs = as_vector_double("IAM_L_coefs");
                 c_fresnel.m_OpticalTable = as_matrix("OpticalTable");
                 c_fresnel.m_rec_model = as_integer("rec_model");
+                c_fresnel.m_use_hl_surrogate = as_boolean("use_hl_surrogate");
 
                 c_fresnel.m_HCE_FieldFrac = as_vector_double("HCE_FieldFrac");
                 c_fresnel.m_D_abs_in = as_vector_double("D_abs_in");
@@ -100,12 +100,13 @@ void cm_grid::exec()
 {
     construct();
     // System generation output, which is lifetime (if system_lifetime_output == true);
-    if (is_assigned("energy_hourly_kW"))
-        gridVars->systemGenerationLifetime_kW = as_vector_double("energy_hourly_kW");
+    // 'gen' is overwritten in place, each record is written at or before the one being read, unless it is streamed
+    size_t n_rec_lifetime = 0;
+    gridVars->generationIsOutput = !is_assigned("energy_hourly_kW");
+    if (gridVars->generationIsOutput)
+        gridVars->systemGenerationLifetime_kW = as_array("gen", &n_rec_lifetime);
     else
-        gridVars->systemGenerationLifetime_kW = as_vector_double("gen");
-
-    size_t n_rec_lifetime = gridVars->systemGenerationLifetime_kW.size();
+        gridVars->systemGenerationLifetime_kW = as_array("energy_hourly_kW", &n_rec_lifetime);
     size_t n_rec_single_year;
 
     size_t analysis_period = 1;
@@ -124,7 +125,7 @@ void cm_grid::exec()
         curtailment_year_one = as_vector_double("grid_curtailment");
     }
     double interpolation_factor = 1.0;
-    single_year_to_lifetime_interpolated<double>(
+    single_year_to_lifetime_series<double>(
         system_use_lifetime_output,
         (size_t)analysis_period,
         n_rec_lifetime,
@@ -135,13 +136,12 @@ void cm_grid::exec()
         n_rec_single_year,
         gridVars->dt_hour_gen);
 
-    allocateOutputs();
     gridVars->numberOfLifetimeRecords = n_rec_lifetime;
     gridVars->numberOfSingleYearRecords = n_rec_single_year;
     gridVars->numberOfYears = n_rec_lifetime / n_rec_single_year;
-
-    gridVars->grid_kW.reserve(gridVars->numberOfLifetimeRecords);
-    gridVars->grid_kW = gridVars->systemGenerationLifetime_kW;
+    if (is_streaming() && gridVars->numberOfYears > 1)
+        log("output_stream: gen and the other time series outputs keep year 1 only, so modules that need lifetime gen cannot be run after grid on the same data", SSC_WARNING);
+    allocateOutputs();
 
     std::vector<double> load_year_one;
 
@@ -174,7 +174,7 @@ void cm_grid::exec()
     }
 
     interpolation_factor = 1.0;
-    single_year_to_lifetime_interpolated<double>(
+    single_year_to_lifetime_series<double>(
         system_use_lifetime_output,
         analysis_period,
         n_rec_lifetime,
@@ -195,41 +195,49 @@ void cm_grid::exec()
 	size_t num_steps_per_hour = size_t(1.0 / gridVars->dt_hour_gen);
 //	double annual_energy_pre_interconnect = as_double("annual_energy");
 	// compute grid export, apply limit
+	// when streaming, the outputs hold one year and are handed off at the end of each year
+	std::vector<std::string> streamed = { "gen", "system_pre_curtailment_kwac", "system_pre_interconnect_kwac" };
 	for (size_t i = 0; i < gridVars->numberOfLifetimeRecords; i++) 
 	{
+	    size_t idx = is_streaming() ? i % gridVars->numberOfSingleYearRecords : i;
 	    double gen = gridVars->systemGenerationLifetime_kW[i];
 		double gridNet = gen - gridVars->loadLifetime_kW[i];
 
         // TODO - curtail if grid outage here
 
 		if (gridVars->enable_interconnection_limit){
-		    p_genPreInterconnect_kW[i] = static_cast<ssc_number_t>(gen);
+		    p_genPreInterconnect_kW[idx] = static_cast<ssc_number_t>(gen);
             double interconnectionLimited = fmax(0., gridNet - gridVars->grid_interconnection_limit_kW);
 		    gen -= interconnectionLimited;
 		    gridNet -= interconnectionLimited;
 		}
 
 		// compute curtailment MW
-		p_genPreCurtailment_kW[i] = static_cast<ssc_number_t>(gen);
+		p_genPreCurtailment_kW[idx] = static_cast<ssc_number_t>(gen);
 		double curtailed = fmax(0., gridNet - gridVars->gridCurtailmentLifetime_MW[i]*1000.0);
         gen -= curtailed;
 
-        p_gen_kW[i] = static_cast<ssc_number_t>(gen);
+        p_gen_kW[idx] = static_cast<ssc_number_t>(gen);
 
 		if (i < gridVars->numberOfSingleYearRecords)
 		{
-			annual_energy_pre_interconnect += p_genPreInterconnect_kW[i];
-			annual_energy_pre_curtailment += p_genPreCurtailment_kW[i];
-			annual_energy += p_gen_kW[i];
+			annual_energy_pre_interconnect += p_genPreInterconnect_kW[idx];
+			annual_energy_pre_curtailment += p_genPreCurtailment_kW[idx];
+			annual_energy += p_gen_kW[idx];
 		}
 
 
 		if (((i + 1) % gridVars->numberOfSingleYearRecords) == 0)
+		{
 			hour = 0;
+			if (is_streaming())
+				stream_chunk(streamed, i / gridVars->numberOfSingleYearRecords, gridVars->numberOfSingleYearRecords);
+		}
 		else if (((i + 1) % num_steps_per_hour) == 0)
 			hour++;
 
 	}
+	stream_finish();
 
 	annual_energy_pre_curtailment *= gridVars->dt_hour_gen;
 	annual_energy_pre_interconnect *= gridVars->dt_hour_gen;
@@ -262,9 +270,21 @@ void cm_grid::exec()
 
 void cm_grid::allocateOutputs()
 {
-    p_gen_kW = allocate("gen", gridVars->systemGenerationLifetime_kW.size());
-	p_genPreCurtailment_kW = allocate("system_pre_curtailment_kwac", gridVars->systemGenerationLifetime_kW.size());
-	p_genPreInterconnect_kW = allocate("system_pre_interconnect_kwac", gridVars->systemGenerationLifetime_kW.size());
+    size_t n = is_streaming() ? gridVars->numberOfSingleYearRecords : gridVars->numberOfLifetimeRecords;
+    if (gridVars->generationIsOutput && !is_streaming())
+        p_gen_kW = gridVars->systemGenerationLifetime_kW;
+    else
+    {
+        if (gridVars->generationIsOutput)
+        {
+            // streamed 'gen' holds one year during the run, keep the lifetime input apart from it
+            gridVars->systemGenerationInput_kW.assign(gridVars->systemGenerationLifetime_kW, gridVars->systemGenerationLifetime_kW + gridVars->numberOfLifetimeRecords);
+            gridVars->systemGenerationLifetime_kW = gridVars->systemGenerationInput_kW.data();
+        }
+        p_gen_kW = allocate("gen", n);
+    }
+	p_genPreCurtailment_kW = allocate("system_pre_curtailment_kwac", n);
+	p_genPreInterconnect_kW = allocate("system_pre_interconnect_kwac", n);
 }
 
 DEFINE_MODULE_ENTRY(grid, "Grid model", 1)
@@ -50,19 +50,20 @@ public:
 	{	}
 
 	// curtailment MW input
-	std::vector<double> gridCurtailmentLifetime_MW;
+	lifetime_series<double> gridCurtailmentLifetime_MW;
 
-	// generation input with interconnection limit
-	std::vector<double> systemGenerationLifetime_kW;
+	// generation input with interconnection limit, read in place from the data container
+	ssc_number_t *systemGenerationLifetime_kW;
+	bool generationIsOutput;
+
+	// copy of the lifetime generation input when the year-long 'gen' output is streamed
+	std::vector<ssc_number_t> systemGenerationInput_kW;
 
 	// pre-interconnected limited generation output
 	std::vector<double> systemGenerationPreInterconnect_kW;
 
 	// electric load input
-	std::vector<double> loadLifetime_kW;
-
-	// grid power
-	std::vector<double> grid_kW;
+	lifetime_series<double> loadLifetime_kW;
 
 	// enable interconnection limit
 	bool enable_interconnection_limit;
@@ -163,6 +163,7 @@ static var_info _cm_vtab_mspt_iph[] = {
 { SSC_INPUT,     SSC_NUMBER, "cav_rec_span",                       "Cavity receiver span angle",                                                                                                              "deg",          "",                                  "Tower and Receiver",                       "receiver_type=1",                                                  "",              "" },
 { SSC_INPUT,     SSC_NUMBER, "cav_rec_passive_abs",                "Cavity receiver passive surface solar absorptance",                                                                                       "",             "",                                  "Tower and Receiver",                       "receiver_type=1",                                                  "",              "" },
 { SSC_INPUT,     SSC_NUMBER, "cav_rec_passive_eps",                "Cavity receiver passive surface thermal emissivity",                                                                                      "",             "",                                  "Tower and Receiver",                       "receiver_type=1",                                                  "",              "" },
+{ SSC_INPUT,     SSC_NUMBER, "cav_rec_n_threads_vf",               "Cavity receiver number of threads for the view factor calculation, 0 = use all available cores",                                          "",             "",                                  "Tower and Receiver",                       "?=1",                                                              "INTEGER,MIN=0", "" },
 
 
 // New variables replacing deprecated variable "piping_loss". Variable currently not required so exec() can check if assigned and throw a more detailed error
@@ -1291,6 +1292,7 @@ public:
                 as_double("T_htf_cold_des"), as_double("f_rec_min"), q_dot_rec_des,
                 as_double("rec_su_delay"), as_double("rec_qf_delay"), as_double("csp.pt.rec.max_oper_frac"),
                 as_double("eta_pump")));
+            c_cav_rec->set_n_threads_view_factors(as_integer("cav_rec_n_threads_vf"));
 
             receiver = std::move(c_cav_rec);
 
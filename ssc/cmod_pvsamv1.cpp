@@ -362,6 +362,7 @@ static var_info _cm_vtab_pvsamv1[] = {
         { SSC_INPUT, SSC_NUMBER,   "6par_bifaciality",                     "Bifaciality factor",                                  "%",      "",                                                                                                                                                                                      "CEC Performance Model with User Entered Specifications","module_model=2",                     "",                    "" },
         { SSC_INPUT, SSC_NUMBER,   "6par_bifacial_ground_clearance_height","Module ground clearance height",                      "m",      "",                                                                                                                                                                                      "CEC Performance Model with User Entered Specifications","module_model=2",                     "POSITIVE",                    "" },
         { SSC_INPUT, SSC_NUMBER,   "6par_transient_thermal_model_unit_mass","Module unit mass",                      "kg/m^2",      "",                                                                                                                                                                                              "CEC Performance Model with User Entered Specifications","module_model=2",                     "",                    "" },
+        { SSC_INPUT, SSC_STRING,   "6par_cache_file",                      "Solved coefficient cache file",                       "",       "coefficients are read from and new solutions added to this file",                                                                                                                       "CEC Performance Model with User Entered Specifications","?",                                  "",                    "" },
 
         // snl module model
         { SSC_INPUT, SSC_NUMBER,   "snl_module_structure",                 "Module and mounting structure configuration",         "",       "0=Use Database Values,1=glass/cell/polymer sheet-open rack,2=glass/cell/glass-open rack,3=polymer/thin film/steel-open rack,4=Insulated back BIPV,5=close roof mount,6=user-defined",   "Sandia PV Array Performance Model with Module Database","module_model=3",                     "INTEGER,MIN=0,MAX=6", "" },
@@ -1281,7 +1282,7 @@ void cm_pvsamv1::exec()
         if (!Simulation->annualSimulation)
             throw exec_error("pvsamv1", "The PV Battery configuration requires a simulation period that is continuous over one or more years.");
 
-        batt = std::make_shared<battstor>(*m_vartab, en_batt, nrec, ts_hour);
+        batt = std::make_shared<battstor>(*m_vartab, en_batt, nrec, ts_hour, nullptr, this);
         batt->setSharedInverter(sharedInverter);
         batt_topology = batt->batt_vars->batt_topology;
 
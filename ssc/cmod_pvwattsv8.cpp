@@ -810,6 +810,10 @@ public:
 
         double annual_kwh = 0;
 
+        // inputs read inside the timestep loop
+        var_handle h_albedo_default = handle("albedo_default");
+        var_handle h_albedo_default_snow = handle("albedo_default_snow");
+
         size_t idx_life = 0;
         float percent = 0;
         int n_alb_errs = 0;
@@ -873,9 +877,9 @@ public:
                 if (alb <= 0 || alb >= 1)
                 {
                     if (std::isfinite(wf.snow) && wf.snow > 0.5 && wf.snow < 999 && en_snowloss)
-                        alb = as_double("albedo_default_snow");
+                        alb = h_albedo_default_snow.as_double();
                     else
-                        alb = as_double("albedo_default");
+                        alb = h_albedo_default.as_double();
                     if (!use_wf_albedo && n_alb_errs < 5) // display warning up to 5 times
                     {
                         log(util::format("Albedo input value is not valid for time step %d. Using default albedo value of %f (snow) or %f (no snow). This warning only appears for the first five instances of this error.", idx, as_double("albedo_default_snow"), as_double("albedo_default")), SSC_NOTICE);
@@ -1155,7 +1159,7 @@ public:
 
 
                     // apply soiling loss to the total effective POA
-                    if (is_assigned("soiling"))
+                    if (soiling != nullptr)
                     {
                         double soiling_f = 0.0;
                         if (soiling_len == 1)
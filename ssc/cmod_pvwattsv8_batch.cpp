@@ -0,0 +1,254 @@
+/*
+BSD 3-Clause License
+
+Copyright (c) Alliance for Sustainable Energy, LLC. See also https://github.com/NREL/ssc/blob/develop/LICENSE
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+   contributors may be used to endorse or promote products derived from
+   this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+#include <atomic>
+#include <cstring>
+#include <exception>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+#include "core.h"
+
+extern module_entry_info cm_entry_pvwattsv8;
+
+static var_info _cm_vtab_pvwattsv8_batch[] = {
+    /*   VARTYPE           DATATYPE          NAME                              LABEL                                         UNITS        META                                            GROUP                  REQUIRED_IF                 CONSTRAINTS                      UI_HINTS*/
+        { SSC_INPUT,        SSC_TABLE,       "system_inputs",                  "PVWatts V8 system inputs shared by all sites","",         "any pvwattsv8 input except solar resource",    "Batch",               "*",                        "",                              "" },
+        { SSC_INPUT,        SSC_NUMBER,      "n_threads",                      "Number of worker threads",                   "",          "0=use all hardware threads",                   "Batch",               "?=0",                      "MIN=0,INTEGER",                 "" },
+
+        { SSC_INPUT,        SSC_ARRAY,       "site_lat",                       "Site latitude",                              "degrees",   "one value per site",                           "Solar Resource",      "*",                        "",                              "" },
+        { SSC_INPUT,        SSC_ARRAY,       "site_lon",                       "Site longitude",                             "degrees",   "one value per site",                           "Solar Resource",      "*",                        "",                              "" },
+        { SSC_INPUT,        SSC_ARRAY,       "site_tz",                        "Site time zone",                             "UTC offset","one value per site",                           "Solar Resource",      "*",                        "",                              "" },
+        { SSC_INPUT,        SSC_ARRAY,       "site_elev",                      "Site elevation",                             "m",         "one value per site",                           "Solar Resource",      "*",                        "",                              "" },
+
+        { SSC_INPUT,        SSC_ARRAY,       "year",                           "Year",                                       "",          "shared by all sites",                          "Solar Resource",      "*",                        "",                              "" },
+        { SSC_INPUT,        SSC_ARRAY,       "month",                          "Month",                                      "",          "shared by all sites",                          "Solar Resource",      "*",                        "LENGTH_EQUAL=year",             "" },
+        { SSC_INPUT,        SSC_ARRAY,       "day",                            "Day",                                        "",          "shared by all sites",                          "Solar Resource",      "*",                        "LENGTH_EQUAL=year",             "" },
+        { SSC_INPUT,        SSC_ARRAY,       "hour",                           "Hour",                                       "",          "shared by all sites",                          "Solar Resource",      "*",                        "LENGTH_EQUAL=year",             "" },
+        { SSC_INPUT,        SSC_ARRAY,       "minute",                         "Minute",                                     "",          "shared by all sites",                          "Solar Resource",      "*",                        "LENGTH_EQUAL=year",             "" },
+
+        { SSC_INPUT,        SSC_MATRIX,      "site_dn",                        "Beam irradiance",                            "W/m2",      "sites x timesteps",                            "Solar Resource",      "*",                        "",                              "" },
+        { SSC_INPUT,        SSC_MATRIX,      "site_df",                        "Diffuse irradiance",                         "W/m2",      "sites x timesteps",                            "Solar Resource",      "*",                        "",                              "" },
+        { SSC_INPUT,        SSC_MATRIX,      "site_gh",                        "Global horizontal irradiance",               "W/m2",      "sites x timesteps",                            "Solar Resource",      "?",                        "",                              "" },
+        { SSC_INPUT,        SSC_MATRIX,      "site_tdry",                      "Dry bulb temperature",                       "C",         "sites x timesteps",                            "Solar Resource",      "*",                        "",                              "" },
+        { SSC_INPUT,        SSC_MATRIX,      "site_wspd",                      "Wind speed",                                 "m/s",       "sites x timesteps",                            "Solar Resource",      "*",                        "",                              "" },
+        { SSC_INPUT,        SSC_MATRIX,      "site_alb",                       "Albedo",                                     "0..1",      "sites x timesteps",                            "Solar Resource",      "?",                        "",                              "" },
+
+        { SSC_OUTPUT,       SSC_ARRAY,       "site_status",                    "Site simulation status",                     "0/1",       "1=success,0=failed",                           "Batch",               "*",                        "",                              "" },
+        { SSC_OUTPUT,       SSC_ARRAY,       "annual_energy",                  "Annual energy",                              "kWh",       "one value per site",                           "Annual",              "*",                        "",                              "" },
+        { SSC_OUTPUT,       SSC_ARRAY,       "capacity_factor",                "Capacity factor based on nameplate DC capacity","%",      "one value per site",                           "Annual",              "*",                        "",                              "" },
+        { SSC_OUTPUT,       SSC_ARRAY,       "kwh_per_kw",                     "Energy yield",                               "kWh/kW",    "one value per site",                           "Annual",              "*",                        "",                              "" },
+        { SSC_OUTPUT,       SSC_ARRAY,       "solrad_annual",                  "Daily average solar irradiance",             "kWh/m2/day","one value per site",                           "Annual",              "*",                        "",                              "" },
+        { SSC_OUTPUT,       SSC_MATRIX,      "monthly_energy",                 "Monthly energy",                             "kWh",       "sites x 12",                                   "Monthly",             "*",                        "",                              "" },
+
+var_info_invalid };
+
+// site simulations run without progress reporting; their messages stay in the site module's log
+class batch_site_handler : public handler_interface
+{
+public:
+    batch_site_handler(compute_module *cm) : handler_interface(cm) { }
+    void on_log(const std::string &, int, float) { }
+    bool on_update(const std::string &, float, float) { return true; }
+};
+
+class cm_pvwattsv8_batch : public compute_module
+{
+    // weather columns copied from the site matrices into each worker's solar_resource_data table
+    struct site_column
+    {
+        const char *input;
+        const char *field;
+    };
+
+public:
+    cm_pvwattsv8_batch()
+    {
+        add_var_info(_cm_vtab_pvwattsv8_batch);
+    }
+
+    void exec()
+    {
+        static const site_column columns[] = {
+            { "site_dn", "dn" }, { "site_df", "df" }, { "site_gh", "gh" },
+            { "site_tdry", "tdry" }, { "site_wspd", "wspd" }, { "site_alb", "alb" } };
+        static const char *time_fields[] = { "year", "month", "day", "hour", "minute" };
+
+        size_t n_sites = 0, n = 0;
+        ssc_number_t *lat = as_array("site_lat", &n_sites);
+        ssc_number_t *lon = as_array("site_lon", &n);
+        if (n != n_sites) throw exec_error("pvwattsv8_batch", "site_lon must have one value per site");
+        ssc_number_t *tz = as_array("site_tz", &n);
+        if (n != n_sites) throw exec_error("pvwattsv8_batch", "site_tz must have one value per site");
+        ssc_number_t *elev = as_array("site_elev", &n);
+        if (n != n_sites) throw exec_error("pvwattsv8_batch", "site_elev must have one value per site");
+        if (n_sites == 0) throw exec_error("pvwattsv8_batch", "no sites specified");
+
+        size_t nrec = 0;
+        as_array("year", &nrec);
+
+        // resolved before the workers start so they only read the site matrices
+        std::vector<const site_column*> used;
+        std::vector<const util::matrix_t<ssc_number_t>*> site_data;
+        for (const site_column &c : columns)
+        {
+            var_data *mat = lookup(c.input);
+            if (!mat) continue;
+            if (mat->num.nrows() != n_sites || mat->num.ncols() != nrec)
+                throw exec_error("pvwattsv8_batch", util::format("%s must be %d sites x %d timesteps, got %d x %d",
+                    c.input, (int)n_sites, (int)nrec, (int)mat->num.nrows(), (int)mat->num.ncols()));
+            used.push_back(&c);
+            site_data.push_back(&mat->num);
+        }
+
+        // template for the per-worker tables: shared system inputs plus a weather table whose
+        // columns are overwritten in place for each site, so a site costs no table allocation
+        var_data *system = lookup("system_inputs");
+        var_table base = system->table;
+        base.unassign("solar_resource_file");
+        base.unassign("output_tier");
+
+        var_data wf;
+        wf.type = SSC_TABLE;
+        for (const char *f : time_fields)
+            wf.table.assign(f, *lookup(f));
+        for (const site_column *c : used)
+            wf.table.allocate(c->field, nrec);
+        for (const char *f : { "lat", "lon", "tz", "elev" })
+            wf.table.assign(f, var_data((ssc_number_t)0));
+        base.assign("solar_resource_data", wf);
+
+        ssc_number_t *status = allocate("site_status", n_sites);
+        ssc_number_t *annual = allocate("annual_energy", n_sites);
+        ssc_number_t *cf = allocate("capacity_factor", n_sites);
+        ssc_number_t *yield = allocate("kwh_per_kw", n_sites);
+        ssc_number_t *solrad = allocate("solrad_annual", n_sites);
+        util::matrix_t<ssc_number_t> &monthly = allocate_matrix("monthly_energy", n_sites, 12);
+
+        int n_threads = as_integer("n_threads");
+        if (n_threads <= 0)
+            n_threads = std::max(1, (int)std::thread::hardware_concurrency());
+        n_threads = std::min(n_threads, (int)n_sites);
+
+        // errors are reported after the workers join, since log() is not thread safe
+        std::vector<std::string> site_errors(n_sites);
+        std::atomic<int> next_site(0);
+        std::exception_ptr p_exception;
+        std::mutex exception_mutex;
+
+        auto run_sites = [&]()
+        {
+            try
+            {
+                var_table vt = base;
+                var_table &wt = vt.lookup("solar_resource_data")->table;
+                std::unique_ptr<compute_module> cm(cm_entry_pvwattsv8.f_create());
+                batch_site_handler handler(cm.get());
+
+                for (int i = next_site++; i < (int)n_sites; i = next_site++)
+                {
+                    wt.lookup("lat")->num = lat[i];
+                    wt.lookup("lon")->num = lon[i];
+                    wt.lookup("tz")->num = tz[i];
+                    wt.lookup("elev")->num = elev[i];
+                    for (size_t c = 0; c < used.size(); c++)
+                        std::memcpy(wt.lookup(used[c]->field)->num.data(), &site_data[c]->at(i, 0), nrec * sizeof(ssc_number_t));
+
+                    // keep annual numbers and monthly_energy only, the selection is removed after each run
+                    vt.assign("output_filter", var_data("monthly_energy"));
+                    cm->clear_log();
+                    if (cm->compute(&handler, &vt))
+                    {
+                        status[i] = 1;
+                        annual[i] = vt.as_number("annual_energy");
+                        cf[i] = vt.as_number("capacity_factor");
+                        yield[i] = vt.as_number("kwh_per_kw");
+                        solrad[i] = vt.as_number("solrad_annual");
+                        size_t nm = 0;
+                        ssc_number_t *pm = vt.as_array("monthly_energy", &nm);
+                        for (size_t m = 0; m < 12; m++)
+                            monthly.at(i, m) = m < nm ? pm[m] : std::numeric_limits<ssc_number_t>::quiet_NaN();
+                    }
+                    else
+                    {
+                        status[i] = 0;
+                        annual[i] = cf[i] = yield[i] = solrad[i] = std::numeric_limits<ssc_number_t>::quiet_NaN();
+                        for (size_t m = 0; m < 12; m++)
+                            monthly.at(i, m) = std::numeric_limits<ssc_number_t>::quiet_NaN();
+
+                        int k = 0;
+                        while (compute_module::log_item *item = cm->log(k++))
+                        {
+                            if (item->type == SSC_ERROR) { site_errors[i] = item->text; break; }
+                        }
+                        if (site_errors[i].empty()) site_errors[i] = "simulation failed";
+                    }
+                }
+            }
+            catch (...)
+            {
+                std::lock_guard<std::mutex> lock(exception_mutex);
+                if (!p_exception)
+                    p_exception = std::current_exception();
+            }
+        };
+
+        if (n_threads == 1)
+            run_sites();
+        else
+        {
+            std::vector<std::thread> workers;
+            for (int t = 0; t < n_threads; t++)
+                workers.emplace_back(run_sites);
+            for (std::thread &w : workers)
+                w.join();
+        }
+
+        if (p_exception)
+            std::rethrow_exception(p_exception);
+
+        size_t n_failed = 0;
+        for (size_t i = 0; i < n_sites; i++)
+        {
+            if (status[i] != 0) continue;
+            n_failed++;
+            log(util::format("site %d: %s", (int)i, site_errors[i].c_str()), SSC_WARNING);
+        }
+        if (n_failed == n_sites)
+            throw exec_error("pvwattsv8_batch", "all sites failed to simulate");
+    }
+};
+
+DEFINE_MODULE_ENTRY(pvwattsv8_batch, "PVWatts V8 - shared system simulated over many sites' weather in parallel.", 1)
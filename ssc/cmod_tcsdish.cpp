@@ -40,6 +40,7 @@ static var_info _cm_vtab_tcsdish[] = {
 //   weather reader inputs
 //   VARTYPE            DATATYPE          NAME                      LABEL                                                                             UNITS           META            GROUP            REQUIRED_IF                CONSTRAINTS              UI_HINTS
     { SSC_INPUT,        SSC_STRING,      "file_name",               "local weather file path",                                                        "",             "",             "weather",       "*",                       "LOCAL_FILE",            "" },
+    { SSC_INPUT,        SSC_NUMBER,      "tcs_solve_mode",          "TCS solve mode: 0=iterate all units, 1=dependency ordered",                      "",             "",             "tcs",           "?=0",                     "INTEGER,MIN=0,MAX=1",   "" },
     //{ SSC_INPUT,        SSC_NUMBER,      "track_mode",              "Tracking mode",                                                                  "",             "",             "weather",       "*",                       "",                      "" },
     //{ SSC_INPUT,        SSC_NUMBER,      "tilt",                    "Tilt angle of surface/axis",                                                     "",             "",             "weather",       "*",                       "",                      "" },
     //{ SSC_INPUT,        SSC_NUMBER,      "azimuth",                 "Azimuth angle of surface/axis",                                                  "",             "",             "weather",       "*",                       "",                      "" },
@@ -258,6 +259,7 @@ static var_info _cm_vtab_tcsdish[] = {
 	{ SSC_OUTPUT, SSC_NUMBER, "conversion_factor", "Gross to Net Conversion Factor", "%", "", "Calculated", "*", "", "" },
 	{ SSC_OUTPUT, SSC_NUMBER, "capacity_factor", "Capacity factor", "%", "", "", "*", "", "" },
 	{ SSC_OUTPUT, SSC_NUMBER, "kwh_per_kw", "First year kWh/kW", "kWh/kW", "", "", "*", "", "" },
+	{ SSC_OUTPUT, SSC_NUMBER, "tcs_unit_invocations", "Number of TCS unit calls", "", "", "", "*", "", "" },
 
 
 	var_info_invalid };
@@ -473,8 +475,10 @@ public:
 
 		// Run simulation
 		size_t hours = 8760;
+		set_solve_mode( as_integer("tcs_solve_mode") );
 		if (0 > simulate(3600.0, hours*3600.0, 3600) )
 			throw exec_error( "tcsdish", util::format("there was a problem simulating in tcsdish.") );
+		assign( "tcs_unit_invocations", (ssc_number_t)unit_invocations() );
 
 		// get the outputs
 		if (!set_all_output_arrays() )
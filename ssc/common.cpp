@@ -1483,7 +1483,7 @@ bool weatherdata::check_continuous_single_year(bool leapyear)
     //next, check if the data has leap day (feb 29). need to do this because some tools pass in 8760 data that contains feb 29 and not dec 31
     bool has_leapday = false;
     int leapDayNoon = 1429 * ts_per_hour; //look for the index of noon on leap day. noon on leap day is hour 1429 of the year
-    if (this->m_data[leapDayNoon]->month == 2 && this->m_data[leapDayNoon]->day == 29) //check noon on what would be feb 29 if it's in the data
+    if (int_at(MONTH, leapDayNoon) == 2 && int_at(DAY, leapDayNoon) == 29) //check noon on what would be feb 29 if it's in the data
         has_leapday = true;
 
     //last, go through each index in order and make sure that the timestamps all correspond to a single, serially complete year with even timesteps
@@ -1497,15 +1497,15 @@ bool weatherdata::check_continuous_single_year(bool leapyear)
 		{
 			for (int h = 0; h < 24; h++)
 			{
-				double min = this->m_data[idx]->minute;
+				double min = number_at(MINUTE, idx);
 				for (int tsph = 0; tsph < ts_per_hour; tsph++)
 				{
                     //first check that the index isn't out of bounds
                     if (idx > (int)m_nRecords - 1)
                         return false;
                     //if any of the month, day, hour, or minute don't line up with what we've calculated, then it doesn't fit our criteria for a continuous year
-					if (this->m_data[idx]->month != m || this->m_data[idx]->day != d || this->m_data[idx]->hour != h
-					    || this->m_data[idx]->minute != min)
+					if (int_at(MONTH, idx) != m || int_at(DAY, idx) != d || int_at(HOUR, idx) != h
+					    || number_at(MINUTE, idx) != min)
 						return false;
 					else
 						idx++;
@@ -1520,8 +1520,14 @@ bool weatherdata::check_continuous_single_year(bool leapyear)
 weatherdata::weatherdata( var_data *data_table )
 {
 	m_startSec = m_stepSec = m_nRecords = 0;
+	m_nData = 0;
 	m_index = 0;
 	m_ok = true;
+	for (size_t id = 0; id < _MAXCOL_; id++)
+	{
+		m_cols[id].p = 0;
+		m_cols[id].len = 0;
+	}
 
 	if ( data_table->type != SSC_TABLE )
 	{
@@ -1614,59 +1620,53 @@ weatherdata::weatherdata( var_data *data_table )
 
 	if ( nrec > 0)
 	{
-		m_data.resize( nrec );
-		for( size_t i=0;i<nrec;i++ )
+		// minute column must go from 0-59, NOT 1-60!
+		for (size_t i = 0; i < minute.len; i++)
 		{
-			weather_record *r = new weather_record;
-
-			if ( i < year.len ) r->year = (int)year.p[i];
-			if ( i < month.len ) r->month = (int)month.p[i];
-			if ( i < day.len ) r->day = (int)day.p[i];
-			if ( i < hour.len ) r->hour = (int)hour.p[i];
-			if ( i < minute.len ) r->minute = minute.p[i];
-
-			// minute column must go from 0-59, NOT 1-60!
 			if (minute.p[i] > 60)
 			{
 				m_message = "minute column must contain integers from 0-59";
 				m_ok = false;
 				return;
 			}
+		}
 
-			r->gh = r->dn = r->df = r->poa = r->wspd = r->wdir = r->tdry = r->twet = r->tdew
-				= r->rhum = r->pres = r->snow = r->alb = r->aod = std::numeric_limits<double>::quiet_NaN();
-			if ( i < gh.len ) r->gh = gh.p[i];
-			if ( i < dn.len ) r->dn = dn.p[i];
-			if ( i < df.len ) r->df = df.p[i];
-			if (i < poa.len ) r->poa = poa.p[i];
-
-			if ( i < wspd.len ) r->wspd = wspd.p[i];
-			if ( i < wdir.len ) r->wdir = wdir.p[i];
-
-			if ( i < tdry.len ) r->tdry = tdry.p[i];
-			if ( i < twet.len ) r->twet = twet.p[i];
-			else{
-				// calculate twet using calc_twet if tdry & rh & pres are available
-				if ((i < tdry.len) && (i < rhum.len) && (i < pres.len)){
-					r->twet = (float)calc_twet(tdry.p[i], rhum.p[i], pres.p[i]);
-				}
-			}
-			if ( i < tdew.len ) r->tdew = tdew.p[i];
-			else{
-				// calculate tdew using wiki_dew_calc if tdry & rh are available
-				if ((i < tdry.len) && (i < rhum.len)){
-					r->tdew = (float)wiki_dew_calc(tdry.p[i], rhum.p[i]);
-				}
-			}
-
-			if ( i < rhum.len ) r->rhum = rhum.p[i];
-			if ( i < pres.len ) r->pres = pres.p[i];
-
-			if ( i < snow.len ) r->snow = snow.p[i];
-			if ( i < alb.len ) r->alb = alb.p[i];
-			if ( i < aod.len ) r->aod = aod.p[i];
-
-			m_data[i] = r;
+		set_column(YEAR, year);
+		set_column(MONTH, month);
+		set_column(DAY, day);
+		set_column(HOUR, hour);
+		set_column(MINUTE, minute);
+		set_column(GHI, gh);
+		set_column(DNI, dn);
+		set_column(DHI, df);
+		set_column(POA, poa);
+		set_column(WSPD, wspd);
+		set_column(WDIR, wdir);
+		set_column(TDRY, tdry);
+		set_column(TWET, twet);
+		set_column(TDEW, tdew);
+		set_column(RH, rhum);
+		set_column(PRES, pres);
+		set_column(SNOW, snow);
+		set_column(ALB, alb);
+		set_column(AOD, aod);
+		m_nData = nrec;
+
+		// calculate twet using calc_twet if tdry & rh & pres are available
+		if (twet.len == 0 && tdry.len > 0 && rhum.len > 0 && pres.len > 0)
+		{
+			std::vector<ssc_number_t> calc(nrec);
+			for (size_t i = 0; i < nrec; i++)
+				calc[i] = (float)calc_twet(tdry.p[i], rhum.p[i], pres.p[i]);
+			own_column(TWET, calc);
+		}
+		// calculate tdew using wiki_dew_calc if tdry & rh are available
+		if (tdew.len == 0 && tdry.len > 0 && rhum.len > 0)
+		{
+			std::vector<ssc_number_t> calc(nrec);
+			for (size_t i = 0; i < nrec; i++)
+				calc[i] = (float)wiki_dew_calc(tdry.p[i], rhum.p[i]);
+			own_column(TDEW, calc);
 		}
 
         start_hours_at_0();
@@ -1701,11 +1701,53 @@ weatherdata::weatherdata( var_data *data_table )
 
 weatherdata::~weatherdata()
 {
-    if (m_data.size() > 0) {
-        for (size_t i = 0; i< m_data.size(); i++)
-            delete m_data[i];
-    }
-    m_data.clear();
+	// columns are either borrowed from the data table or held by value
+}
+
+void weatherdata::set_column(size_t id, const vec &v)
+{
+	m_cols[id].p = v.p;
+	m_cols[id].len = v.len;
+}
+
+void weatherdata::own_column(size_t id, std::vector<ssc_number_t> &data)
+{
+	m_cols[id].owned.swap(data);
+	m_cols[id].p = m_cols[id].owned.data();
+	m_cols[id].len = m_cols[id].owned.size();
+}
+
+int weatherdata::int_at(size_t id, size_t i) const
+{
+	return i < m_cols[id].len ? (int)m_cols[id].p[i] : 0;
+}
+
+double weatherdata::number_at(size_t id, size_t i) const
+{
+	return i < m_cols[id].len ? m_cols[id].p[i] : std::numeric_limits<double>::quiet_NaN();
+}
+
+void weatherdata::get_record(size_t i, weather_record *r) const
+{
+	r->year = int_at(YEAR, i);
+	r->month = int_at(MONTH, i);
+	r->day = int_at(DAY, i);
+	r->hour = int_at(HOUR, i);
+	r->minute = number_at(MINUTE, i);
+	r->gh = number_at(GHI, i);
+	r->dn = number_at(DNI, i);
+	r->df = number_at(DHI, i);
+	r->poa = number_at(POA, i);
+	r->wspd = number_at(WSPD, i);
+	r->wdir = number_at(WDIR, i);
+	r->tdry = number_at(TDRY, i);
+	r->twet = number_at(TWET, i);
+	r->tdew = number_at(TDEW, i);
+	r->rhum = number_at(RH, i);
+	r->pres = number_at(PRES, i);
+	r->snow = number_at(SNOW, i);
+	r->alb = number_at(ALB, i);
+	r->aod = number_at(AOD, i);
 }
 
 
@@ -1775,28 +1817,34 @@ ssc_number_t weatherdata::get_number( var_data *v, const char *name )
 }
 
 void weatherdata::start_hours_at_0() {
-    std::vector<int> hours;
-    for (weather_record *i : m_data)
-        hours.push_back(i->hour);
-    double max_hr = *std::max_element(hours.begin(), hours.end());
-    double min_hr = *std::min_element(hours.begin(), hours.end());
+    int max_hr = int_at(HOUR, 0);
+    int min_hr = max_hr;
+    for (size_t i = 1; i < m_nData; i++) {
+        int hr = int_at(HOUR, i);
+        if (hr > max_hr) max_hr = hr;
+        if (hr < min_hr) min_hr = hr;
+    }
     if (max_hr - min_hr != 23)
         m_message = "Weather data range was not (0-23) or (1-24)";
-    else if (max_hr == 24)
-        for (weather_record *i : m_data) i->hour -= 1;
+    else if (max_hr == 24) {
+        std::vector<ssc_number_t> hours(m_nData);
+        for (size_t i = 0; i < m_nData; i++)
+            hours[i] = (ssc_number_t)(int_at(HOUR, i) - 1);
+        own_column(HOUR, hours);
+    }
 }
 
 void weatherdata::set_counter_to(size_t cur_index){
-	if (cur_index < m_data.size()) {
+	if (cur_index < m_nData) {
 		m_index = cur_index;
 	}
 }
 
 bool weatherdata::read( weather_record *r )
 {
-	if (m_index < m_data.size())
+	if (m_index < m_nData)
 	{
-		*r = *m_data[m_index++];
+		get_record(m_index++, r);
 		return true;
 	}
 	else
@@ -1806,9 +1854,9 @@ bool weatherdata::read( weather_record *r )
 bool weatherdata::read_average(weather_record *r, std::vector<int> &, size_t &)
 {
 	// finish per bool weatherfile::read_average(weather_record *r, std::vector<int> &cols, size_t &num_timesteps)
-	if (m_index < m_data.size())
+	if (m_index < m_nData)
 	{
-		*r = *m_data[m_index++];
+		get_record(m_index++, r);
 		return true;
 	}
 	else
@@ -1816,7 +1864,26 @@ bool weatherdata::read_average(weather_record *r, std::vector<int> &, size_t &)
 
 }
 
+size_t weatherdata::read_block(weather_record *r, size_t count)
+{
+	size_t n = 0;
+	while (n < count && m_index < m_nData)
+		get_record(m_index++, &r[n++]);
+	return n;
+}
 
+weatherdata::span weatherdata::column_span(size_t id, size_t start, size_t count) const
+{
+	span x;
+	x.p = 0;
+	x.len = 0;
+	if (id < _MAXCOL_ && start < m_cols[id].len)
+	{
+		x.p = m_cols[id].p + start;
+		x.len = std::min(count, m_cols[id].len - start);
+	}
+	return x;
+}
 
 bool weatherdata::has_data_column( size_t id )
 {
@@ -147,7 +147,22 @@ public:
 
 class weatherdata : public weather_data_provider
 {
-	std::vector< weather_record* > m_data;
+public:
+	struct span {
+		const ssc_number_t *p;
+		size_t len;
+	};
+
+private:
+	/* One contiguous array per field. Input arrays are borrowed from the data table,
+	which must outlive this object; derived fields (twet, tdew, shifted hours) are owned. */
+	struct column {
+		const ssc_number_t *p;
+		size_t len;
+		std::vector<ssc_number_t> owned;
+	};
+	column m_cols[_MAXCOL_];
+	size_t m_nData;
 	std::vector<size_t> m_columns;
 
 	struct vec {
@@ -160,6 +175,12 @@ class weatherdata : public weather_data_provider
 
 	int name_to_id(const char *name);
 
+	void set_column(size_t id, const vec &v);
+	void own_column(size_t id, std::vector<ssc_number_t> &data);
+	int int_at(size_t id, size_t i) const;
+	double number_at(size_t id, size_t i) const;
+	void get_record(size_t i, weather_record *r) const;
+
     void start_hours_at_0();
 
 public:
@@ -174,6 +195,8 @@ public:
 	void set_counter_to(size_t cur_index);
 	bool read(weather_record *r) override; // reads one more record
 	bool read_average(weather_record *r, std::vector<int> &cols, size_t &num_timesteps); // reads one more record
+	size_t read_block(weather_record *r, size_t count); // reads up to count records, returns number read
+	span column_span(size_t id, size_t start, size_t count) const; // contiguous view of one field, empty if not available
 	bool has_data_column(size_t id) override;
 	bool check_continuous_single_year(bool leapyear);
 };
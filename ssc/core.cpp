@@ -36,6 +36,9 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <cstring>
 #include <algorithm>
 #include <functional>
+#include <map>
+#include <mutex>
+#include <unordered_set>
 
 #include "core.h"
 #include "ssc_equations.h"
@@ -44,13 +47,254 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 const var_info var_info_invalid = {0, 0, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL};
 
+/* var_info list with its required_if and constraints strings parsed once. Instances of a module type
+   share one compiled_var_info through the registry below, so verify() only evaluates the parsed terms.
+   Syntax errors found while parsing are kept and thrown when the term is evaluated, as before. */
+struct compiled_var_info
+{
+    enum { REQUIRED_NO, REQUIRED_ALWAYS, REQUIRED_DEFAULT, REQUIRED_EXPR };
+
+    struct operand {
+        std::string text;
+        bool is_var; // variable name, otherwise a number
+        bool valid;  // number parsed
+        ssc_number_t value;
+    };
+
+    struct required_term {
+        enum { AND, OR, ERROR, NA, A, ABT, ABF, NAOF, COMPARE };
+        int kind;
+        char op;
+        std::string expr;
+        std::string error;
+        operand lhs, rhs;
+    };
+
+    struct constraint_test {
+        enum { TMYEPW, LOCAL_FILE, MXH_SCHEDULE, BOOLEAN, INTEGER, TOUSCHED, POSITIVE, PERCENT, FACTOR, TS_M,
+               MIN, MAX, LENGTH, LENGTH_EQUAL, LENGTH_MULTIPLE_OF, ROWS, COLS, INVALID };
+        int kind;
+        std::string expr;
+        std::string rhs;
+        bool valid;
+        double num;
+        int ival;
+    };
+
+    struct entry {
+        var_info *vi;
+        size_t first; // index of the first entry with this name, which lookups by name resolve to
+
+        // copies of the parsed strings, to detect a var_info whose contents changed at the same address
+        std::string name;
+        const char *required_if;
+        std::string required_if_text;
+        const char *constraints;
+        std::string constraints_text;
+        int var_type;
+        int data_type;
+
+        int required;
+        var_data default_value;
+        bool default_ok;
+        std::vector<required_term> terms;
+        std::vector<constraint_test> tests;
+    };
+
+    std::vector<entry> entries;
+    unordered_map<std::string, size_t> index;
+    std::unordered_set<std::string> array_outputs; // lower case names of array outputs
+
+    explicit compiled_var_info(const std::vector<var_info *> &list);
+    bool matches(const std::vector<var_info *> &list) const;
+
+private:
+    static void compile_required(entry &e);
+    static void compile_constraints(entry &e);
+};
+
+static bool same_text(const char *a, const char *b, const std::string &text) {
+    if (a == NULL || b == NULL) return a == b;
+    return text == b;
+}
+
+compiled_var_info::compiled_var_info(const std::vector<var_info *> &list) {
+    entries.resize(list.size());
+    for (size_t i = 0; i < list.size(); i++) {
+        var_info *vi = list[i];
+        entry &e = entries[i];
+        e.vi = vi;
+        e.name = vi->name;
+        e.required_if = vi->required_if;
+        e.required_if_text = vi->required_if ? vi->required_if : "";
+        e.constraints = vi->constraints;
+        e.constraints_text = vi->constraints ? vi->constraints : "";
+        e.var_type = vi->var_type;
+        e.data_type = vi->data_type;
+
+        e.first = index.insert(std::make_pair(e.name, i)).first->second;
+        if ((vi->var_type == SSC_OUTPUT || vi->var_type == SSC_INOUT) && vi->data_type == SSC_ARRAY)
+            array_outputs.insert(util::lower_case(e.name));
+
+        compile_required(e);
+        compile_constraints(e);
+    }
+}
+
+bool compiled_var_info::matches(const std::vector<var_info *> &list) const {
+    if (list.size() != entries.size()) return false;
+    for (size_t i = 0; i < list.size(); i++) {
+        const entry &e = entries[i];
+        const var_info *vi = list[i];
+        if (e.vi != vi || e.var_type != vi->var_type || e.data_type != vi->data_type
+            || e.name != vi->name
+            || !same_text(e.required_if, vi->required_if, e.required_if_text)
+            || !same_text(e.constraints, vi->constraints, e.constraints_text))
+            return false;
+    }
+    return true;
+}
+
+void compiled_var_info::compile_required(entry &e) {
+    e.required = REQUIRED_NO;
+    e.default_ok = false;
+
+    const std::string &reqexpr = e.required_if_text;
+    if (reqexpr.empty() || reqexpr == "?")
+        return;
+
+    if (reqexpr == "*") {
+        e.required = REQUIRED_ALWAYS;
+    } else if (reqexpr.length() > 2 && reqexpr[0] == '?' && reqexpr[1] == '=') {
+        e.required = REQUIRED_DEFAULT;
+        e.default_ok = var_data::parse(e.data_type, reqexpr.substr(2), e.default_value);
+    } else {
+        e.required = REQUIRED_EXPR;
+        std::vector<std::string> expr_list = util::split(util::lower_case(reqexpr), "&|", true, true);
+        for (size_t i = 0; i < expr_list.size(); i++) {
+            required_term t;
+            t.expr = expr_list[i];
+            t.op = 0;
+            if (t.expr == "&") t.kind = required_term::AND;
+            else if (t.expr == "|") t.kind = required_term::OR;
+            else {
+                std::string::size_type pos = std::string::npos;
+                if ((pos = t.expr.find('=')) != std::string::npos) t.op = '=';
+                else if ((pos = t.expr.find('~')) != std::string::npos) t.op = '~';
+                else if ((pos = t.expr.find('<')) != std::string::npos) t.op = '<';
+                else if ((pos = t.expr.find('>')) != std::string::npos) t.op = '>';
+                else if ((pos = t.expr.find(':')) != std::string::npos) t.op = ':';
+
+                std::string lhs, rhs;
+                if (t.op) {
+                    lhs = t.expr.substr(0, pos);
+                    rhs = t.expr.substr(pos + 1);
+                }
+
+                if (!t.op) {
+                    t.kind = required_term::ERROR;
+                    t.error = "invalid operator";
+                } else if (lhs.length() < 1 || rhs.length() < 1) {
+                    t.kind = required_term::ERROR;
+                    t.error = "null lhs or rhs in subexpr";
+                } else if (t.op == ':') {
+                    /* built-in test operators */
+                    if (lhs == "na") t.kind = required_term::NA;
+                    else if (lhs == "a") t.kind = required_term::A;
+                    else if (lhs == "abt") t.kind = required_term::ABT;
+                    else if (lhs == "abf") t.kind = required_term::ABF;
+                    else if (lhs == "naof") t.kind = required_term::NAOF;
+                    else {
+                        t.kind = required_term::ERROR;
+                        t.error = "invalid built-in test";
+                    }
+                    t.rhs.text = rhs;
+                } else {
+                    t.kind = required_term::COMPARE;
+                    operand *ops[2] = {&t.lhs, &t.rhs};
+                    std::string text[2] = {lhs, rhs};
+                    for (int k = 0; k < 2; k++) {
+                        operand &o = *ops[k];
+                        o.text = text[k];
+                        o.is_var = isalpha(o.text[0]) != 0;
+                        double x = 0;
+                        o.valid = !o.is_var && util::to_double(o.text, &x);
+                        o.value = (ssc_number_t) x;
+                    }
+                }
+            }
+            e.terms.push_back(t);
+        }
+    }
+}
+
+void compiled_var_info::compile_constraints(entry &e) {
+    if (e.constraints == NULL) return;
+
+    std::vector<std::string> exprlist = util::split(e.constraints_text, ",");
+    for (size_t i = 0; i < exprlist.size(); i++) {
+        constraint_test t;
+        t.expr = util::lower_case(exprlist[i]);
+        t.valid = false;
+        t.num = 0;
+        t.ival = 0;
+
+        std::string::size_type pos;
+        if (t.expr == "tmyepw") t.kind = constraint_test::TMYEPW;
+        else if (t.expr == "local_file") t.kind = constraint_test::LOCAL_FILE;
+        else if (t.expr == "mxh_schedule") t.kind = constraint_test::MXH_SCHEDULE;
+        else if (t.expr == "boolean") t.kind = constraint_test::BOOLEAN;
+        else if (t.expr == "integer") t.kind = constraint_test::INTEGER;
+        else if (t.expr == "tousched") t.kind = constraint_test::TOUSCHED;
+        else if (t.expr == "positive") t.kind = constraint_test::POSITIVE;
+        else if (t.expr == "percent") t.kind = constraint_test::PERCENT;
+        else if (t.expr == "factor") t.kind = constraint_test::FACTOR;
+        else if (t.expr == "ts_m") t.kind = constraint_test::TS_M;
+        else if ((pos = t.expr.find('=')) != std::string::npos) {
+            std::string test = t.expr.substr(0, pos);
+            t.rhs = t.expr.substr(pos + 1);
+
+            if (test == "min" || test == "max") {
+                t.kind = test == "min" ? constraint_test::MIN : constraint_test::MAX;
+                t.valid = util::to_double(t.rhs, &t.num);
+            } else if (test == "length") {
+                t.kind = constraint_test::LENGTH;
+                t.valid = util::to_integer(t.rhs, &t.ival);
+            } else if (test == "length_equal") {
+                t.kind = constraint_test::LENGTH_EQUAL;
+            } else if (test == "length_multiple_of" || test == "rows" || test == "cols") {
+                t.kind = test == "rows" ? constraint_test::ROWS
+                    : (test == "cols" ? constraint_test::COLS : constraint_test::LENGTH_MULTIPLE_OF);
+                t.valid = util::to_integer(t.rhs, &t.ival) && t.ival >= 1;
+            } else
+                continue; // unrecognized tests pass
+        } else
+            t.kind = constraint_test::INVALID;
+
+        e.tests.push_back(t);
+    }
+}
+
+/* registry of compiled var_info lists, keyed by the var_info pointers in module order. A stale entry left by a
+   var_info table freed and reallocated at the same address (see ssc_module_add_var_info) is recompiled. */
+static std::shared_ptr<const compiled_var_info> compiled_var_info_for(const std::vector<var_info *> &list) {
+    static std::mutex registry_mutex;
+    static std::map<std::vector<var_info *>, std::shared_ptr<const compiled_var_info> > registry;
+
+    std::lock_guard<std::mutex> lock(registry_mutex);
+    std::shared_ptr<const compiled_var_info> &c = registry[list];
+    if (!c || !c->matches(list))
+        c = std::make_shared<const compiled_var_info>(list);
+    return c;
+}
+
 compute_module::compute_module()
-        : m_handler(NULL), m_vartab(NULL), m_infomap(NULL) {
+        : m_handler(NULL), m_vartab(NULL), m_output_tier(OUTPUT_TIER_FULL), m_stream(false) {
     /* nothing to do */
 }
 
 compute_module::~compute_module() {
-    if (m_infomap) delete m_infomap;
+    /* nothing to do */
 }
 
 bool compute_module::compute(handler_interface *handler, var_table *data) {
@@ -74,22 +318,162 @@ bool compute_module::compute(handler_interface *handler, var_table *data) {
         return false;
     }
 
+    bool ok = false;
     try { // catch any 'general_error' that can be thrown during precheck, exec, and postcheck
 
-        if (!evaluate()) return false;    // This can be enabled when we want automatic updating of interdependent-inputs
-        if (!verify("precheck input", SSC_INPUT)) return false;
-        exec();
-        if (!verify("postcheck output", SSC_OUTPUT)) return false;
+        setup_output_selection();
+        if (evaluate()    // This can be enabled when we want automatic updating of interdependent-inputs
+            && verify("precheck input", SSC_INPUT)) {
+            exec();
+            remove_unrequested_outputs();
+            ok = verify("postcheck output", SSC_OUTPUT);
+        }
 
     } catch (general_error &e) {
         log(e.err_text, SSC_ERROR, e.time);
-        return false;
     } catch (std::exception &e) {
         log("compute fail(" + name + "): " + e.what(), SSC_ERROR, -1);
+    }
+
+    // outputs that were not requested are only kept for the duration of exec
+    m_unrequested.clear();
+    m_stream_first.clear();
+
+    // the selection applies to this run only: modules run after it on the same data, e.g. grid and the
+    // financial models after pvsamv1, need outputs such as 'gen' that it would drop
+    m_vartab->unassign("output_filter");
+    m_vartab->unassign("output_tier");
+    return ok;
+}
+
+void compute_module::setup_output_selection() {
+    m_output_tier = OUTPUT_TIER_FULL;
+    m_output_filter.clear();
+    m_unrequested.clear();
+
+    var_data *filter = m_vartab->lookup("output_filter");
+    if (filter && filter->type == SSC_STRING) {
+        std::stringstream list(filter->str);
+        std::string item;
+        while (std::getline(list, item, ',')) {
+            item.erase(0, item.find_first_not_of(" \t"));
+            item.erase(item.find_last_not_of(" \t") + 1);
+            if (!item.empty())
+                m_output_filter.push_back(item);
+        }
+        m_output_tier = OUTPUT_TIER_SUMMARY;
+    }
+
+    var_data *tier = m_vartab->lookup("output_tier");
+    if (tier && tier->type == SSC_NUMBER) {
+        int t = (int)tier->num;
+        if (t < OUTPUT_TIER_FULL || t > OUTPUT_TIER_SUMMARY)
+            throw general_error(util::format("output_tier must be %d (full), %d (aggregate) or %d (summary)",
+                OUTPUT_TIER_FULL, OUTPUT_TIER_AGGREGATE, OUTPUT_TIER_SUMMARY));
+        m_output_tier = t;
+    }
+
+    m_stream = false;
+    m_stream_file.clear();
+    m_stream_first.clear();
+    var_data *stream = m_vartab->lookup("output_stream");
+    if (stream && stream->type == SSC_NUMBER)
+        m_stream = stream->num != 0;
+    var_data *stream_file = m_vartab->lookup("output_stream_file");
+    if (m_stream && stream_file && stream_file->type == SSC_STRING)
+        m_stream_file = stream_file->str;
+}
+
+bool compute_module::is_output_filtered(var_info *vi) {
+    if (m_output_tier == OUTPUT_TIER_FULL
+        || vi->var_type != SSC_OUTPUT
+        || (vi->data_type != SSC_ARRAY && vi->data_type != SSC_MATRIX))
         return false;
+    return std::find(m_output_filter.begin(), m_output_filter.end(), vi->name) == m_output_filter.end();
+}
+
+bool compute_module::is_output_requested(const std::string &name, size_t length) {
+    if (m_output_tier == OUTPUT_TIER_FULL || !has_info(name))
+        return true;
+
+    var_info *vi = const_cast<var_info *>(&info(name));
+    if (!is_output_filtered(vi))
+        return true;
+
+    // aggregate tier keeps monthly and annual arrays, drops time series
+    if (m_output_tier == OUTPUT_TIER_AGGREGATE)
+        return length < util::hours_per_year;
+
+    return false;
+}
+
+void compute_module::stream_chunk(const std::vector<std::string> &names, size_t chunk, size_t n_records) {
+    if (!m_stream)
+        return;
+
+    std::vector<var_data *> values;
+    std::string list;
+    for (size_t k = 0; k < names.size(); k++) {
+        var_data *v = lookup(names[k]);
+        if (!v || v->type != SSC_ARRAY || v->num.ncells() < n_records)
+            throw general_error("streamed output '" + names[k] + "' is not an array with one chunk of records");
+        values.push_back(v);
+        if (k > 0) list += ",";
+        list += names[k];
     }
 
-    return true;
+    if (chunk == 0) {
+        for (size_t k = 0; k < names.size(); k++)
+            m_stream_first.assign(names[k], var_data(values[k]->num.data(), n_records));
+    }
+
+    if (!m_stream_file.empty()) {
+        std::ofstream out(m_stream_file.c_str(), chunk == 0 ? std::ios::out : std::ios::app);
+        if (!out)
+            throw general_error("could not open output stream file '" + m_stream_file + "'");
+        out.precision(10);
+        if (chunk == 0)
+            out << "chunk,record," << list << "\n";
+        for (size_t i = 0; i < n_records; i++) {
+            out << chunk << "," << i;
+            for (size_t k = 0; k < values.size(); k++)
+                out << "," << values[k]->num[i];
+            out << "\n";
+        }
+        if (!out)
+            throw general_error("could not write output stream file '" + m_stream_file + "'");
+    }
+
+    if (m_handler) m_handler->on_stream(list, chunk, n_records);
+}
+
+void compute_module::stream_finish() {
+    if (!m_stream)
+        return;
+
+    const char *key = m_stream_first.first();
+    while (key) {
+        var_data *v = lookup(key);
+        if (v) v->copy(*m_stream_first.lookup(key));
+        key = m_stream_first.next();
+    }
+    m_stream_first.clear();
+}
+
+void compute_module::remove_unrequested_outputs() {
+    if (m_output_tier == OUTPUT_TIER_FULL)
+        return;
+
+    std::vector<var_info *>::iterator it;
+    for (it = m_varlist.begin(); it != m_varlist.end(); ++it) {
+        var_info *vi = *it;
+        if (!is_output_filtered(vi))
+            continue;
+        var_data *v = m_vartab->lookup(vi->name);
+        if (v && (v->type == SSC_ARRAY || v->type == SSC_MATRIX)
+            && !is_output_requested(vi->name, v->num.nrows() * v->num.ncols()))
+            m_vartab->unassign(vi->name);
+    }
 }
 
 bool compute_module::evaluate() {
@@ -275,15 +659,18 @@ bool compute_module::evaluate() {
 
 bool compute_module::verify(const std::string &phase, int check_var_type) {
     bool ret = true;
-    std::vector<var_info *>::iterator it;
-    for (it = m_varlist.begin(); it != m_varlist.end(); ++it) {
-        var_info *vi = *it;
+    for (size_t i = 0; i < m_varlist.size(); i++) {
+        var_info *vi = m_varlist[i];
         if (vi->var_type == check_var_type
             || vi->var_type == SSC_INOUT) {
-            if (check_required(vi->name)) {
+            // entries with a duplicated name are checked against the first declaration, as lookups by name are
+            size_t first = compiled().entries[i].first;
+            if (check_required(first)) {
                 // if the variable is required, make sure it exists (in the var_table)
                 // and that it is of the correct data type
                 var_data *dat = lookup(vi->name);
+                if (!dat && is_output_filtered(vi))
+                    continue;
                 if (!dat) {
                     log(phase + ": variable '" + std::string(vi->name) + "' (" + std::string(vi->label) +
                         ") required but not assigned");
@@ -306,7 +693,7 @@ bool compute_module::verify(const std::string &phase, int check_var_type) {
 
                 // now check constraints on it
                 std::string fail_text;
-                if (!check_constraints(vi->name, fail_text)) {
+                if (!check_constraints(first, fail_text)) {
                     log(fail_text, SSC_ERROR);
                     ret =  false;
                 }
@@ -314,7 +701,7 @@ bool compute_module::verify(const std::string &phase, int check_var_type) {
             else { // SAM issue 1184 - if variable present check constraints even if not required - can check type. too.
                 if (var_data* dat = lookup(vi->name)) {
                     std::string fail_text;
-                    if (!check_constraints(vi->name, fail_text)) {
+                    if (!check_constraints(first, fail_text)) {
                         log(std::string(vi->name) + ":" + fail_text, SSC_ERROR);
                         ret = false;
                     }
@@ -333,6 +720,7 @@ void compute_module::add_var_info(var_info vi[]) {
         m_varlist.push_back(&vi[i]);
         i++;
     }
+    m_compiled.reset();
 }
 
 void compute_module::add_var_info(var_info* vi[]) {
@@ -342,6 +730,7 @@ void compute_module::add_var_info(var_info* vi[]) {
         m_varlist.push_back(vi[i]);
         i++;
     }
+    m_compiled.reset();
 }
 
 void compute_module::remove_var_info(var_info vi[]) {
@@ -351,16 +740,25 @@ void compute_module::remove_var_info(var_info vi[]) {
         m_varlist.erase(std::remove(m_varlist.begin(), m_varlist.end(), &vi[i]), m_varlist.end());
         i++;
     }
+    m_compiled.reset();
 }
 
 void compute_module::build_info_map() {
-    if (m_infomap) delete m_infomap;
+    compiled();
+}
 
-    m_infomap = new unordered_map<std::string, var_info *>;
+const compiled_var_info &compute_module::compiled() {
+    if (!m_compiled)
+        m_compiled = compiled_var_info_for(m_varlist);
+    return *m_compiled;
+}
 
-    std::vector<var_info *>::iterator it;
-    for (it = m_varlist.begin(); it != m_varlist.end(); ++it)
-        (*m_infomap)[(*it)->name] = *it;
+size_t compute_module::info_index(const std::string &name) {
+    const compiled_var_info &c = compiled();
+    unordered_map<std::string, size_t>::const_iterator pos = c.index.find(name);
+    if (pos == c.index.end())
+        throw general_error("variable information lookup fail: '" + name + "'");
+    return pos->second;
 }
 
 bool compute_module::update(const std::string &current_action, float percent_done, float time) {
@@ -397,20 +795,8 @@ compute_module::log_item *compute_module::log(int index) {
 }
 
 bool compute_module::has_info(const std::string &name) {
-    // if there is an info lookup table, use it
-    if (m_infomap != NULL) {
-        unordered_map<std::string, var_info *>::iterator pos = m_infomap->find(name);
-        if (pos != m_infomap->end())
-            return true;
-    }
-
-    // otherwise search
-    std::vector<var_info *>::iterator it;
-    for (it = m_varlist.begin(); it != m_varlist.end(); ++it) {
-        if ((*it)->name == name)
-            return true;
-    }
-    return false;
+    const compiled_var_info &c = compiled();
+    return c.index.find(name) != c.index.end();
 }
 
 var_info *compute_module::info(int index) {
@@ -421,48 +807,23 @@ var_info *compute_module::info(int index) {
 }
 
 const var_info &compute_module::info(const std::string &name) {
-    // if there is an info lookup table, use it
-    if (m_infomap != NULL) {
-        unordered_map<std::string, var_info *>::iterator pos = m_infomap->find(name);
-        if (pos != m_infomap->end())
-            return (*(pos->second));
-    }
-
-    // otherwise search
-    std::vector<var_info *>::iterator it;
-    for (it = m_varlist.begin(); it != m_varlist.end(); ++it) {
-        if ((*it)->name == name)
-            return *(*it);
-    }
-
-    throw general_error("variable information lookup fail: '" + name + "'");
+    return *compiled().entries[info_index(name)].vi;
 }
 
 bool compute_module::is_ssc_array_output(const std::string &name) {
-    // if there is an info lookup table, use it
-    if (m_infomap != NULL) {
-        unordered_map<std::string, var_info *>::iterator pos = m_infomap->find(name);
-        if (pos != m_infomap->end()) {
-            if ((((pos->second)->var_type == SSC_OUTPUT) || ((pos->second)->var_type == SSC_INOUT)) &&
-                (pos->second)->data_type == SSC_ARRAY)
-                return true;
-        }
-    }
-
-    // otherwise search
-    std::vector<var_info *>::iterator it;
-    for (it = m_varlist.begin(); it != m_varlist.end(); ++it) {
-        if ((((*it)->var_type == SSC_OUTPUT) || ((*it)->var_type == SSC_INOUT)) && (*it)->data_type == SSC_ARRAY)
-            if (util::lower_case((*it)->name) == util::lower_case(name)) return true;
-    }
-
-    return false;
+    const compiled_var_info &c = compiled();
+    return c.array_outputs.find(util::lower_case(name)) != c.array_outputs.end();
 }
 
 
 var_data *compute_module::lookup(const std::string &name) {
     if (!m_vartab) throw general_error("invalid data container object reference");
-    return m_vartab->lookup(name);
+    return table_for(name)->lookup(name);
+}
+
+var_handle compute_module::handle(const std::string &name) {
+    if (!m_vartab) throw general_error("invalid data container object reference");
+    return var_handle(table_for(name), name);
 }
 
 var_data *compute_module::assign(const std::string &name, const var_data &value) {
@@ -472,36 +833,50 @@ var_data *compute_module::assign(const std::string &name, const var_data &value)
 
 void compute_module::unassign(const std::string& name) {
     if (!m_vartab) throw general_error("invalid data container object reference");
+    m_unrequested.unassign(name);
     return m_vartab->unassign(name);
 }
 
+var_data *compute_module::assign_output(const std::string &name, size_t length) {
+    if (!m_vartab) throw general_error("invalid data container object reference");
+    if (is_output_requested(name, length))
+        return m_vartab->assign(name, var_data());
+    return m_unrequested.assign(name, var_data());
+}
+
 ssc_number_t *compute_module::allocate(const std::string &name, size_t length) {
-    var_data *v = assign(name, var_data());
+    var_data *v = assign_output(name, length);
     v->type = SSC_ARRAY;
     v->num.resize_fill(length, 0.0);
     return v->num.data();
 }
 
 ssc_number_t *compute_module::allocate(const std::string &name, size_t nrows, size_t ncols) {
-    var_data *v = assign(name, var_data());
+    var_data *v = assign_output(name, nrows * ncols);
     v->type = SSC_MATRIX;
     v->num.resize_fill(nrows, ncols, 0.0);
     return v->num.data();
 }
 
+ssc_number_t *compute_module::allocate_if_requested(const std::string &name, size_t length) {
+    if (!is_output_requested(name, length))
+        return NULL;
+    return allocate(name, length);
+}
+
 util::matrix_t<ssc_number_t> &compute_module::allocate_matrix(const std::string &name, size_t nrows, size_t ncols) {
-    var_data *v = assign(name, var_data());
+    var_data *v = assign_output(name, nrows * ncols);
     v->type = SSC_MATRIX;
     v->num.resize_fill(nrows, ncols, 0.0);
     return v->num;
 }
 
 ssc_number_t* compute_module::resize_array(const std::string& name, size_t length) {
-    return m_vartab->resize_array(name, length);
+    return table_for(name)->resize_array(name, length);
 }
 
 ssc_number_t* compute_module::resize_matrix(const std::string& name, size_t n_rows, size_t n_cols) {
-    return m_vartab->resize_matrix(name, n_rows, n_cols);
+    return table_for(name)->resize_matrix(name, n_rows, n_cols);
 }
 
 var_data &compute_module::value(const std::string &name) {
@@ -513,47 +888,47 @@ var_data &compute_module::value(const std::string &name) {
 }
 
 bool compute_module::is_assigned(const std::string &name) {
-    if (m_vartab) return (m_vartab->is_assigned(name));
+    if (m_vartab) return (table_for(name)->is_assigned(name));
     else return false;
 }
 
 int compute_module::as_integer(const std::string &name) {
-    if (m_vartab) return m_vartab->as_integer(name);
+    if (m_vartab) return table_for(name)->as_integer(name);
     else throw general_error("compute_module error: var_table does not exist.");
 }
 
 size_t compute_module::as_unsigned_long(const std::string &name) {
-    if (m_vartab) return m_vartab->as_unsigned_long(name);
+    if (m_vartab) return table_for(name)->as_unsigned_long(name);
     else throw general_error("compute_module error: var_table does not exist.");
 }
 
 bool compute_module::as_boolean(const std::string &name) {
-    if (m_vartab) return m_vartab->as_boolean(name);
+    if (m_vartab) return table_for(name)->as_boolean(name);
     else throw general_error("compute_module error: var_table does not exist.");
 }
 
 float compute_module::as_float(const std::string &name) {
-    if (m_vartab) return m_vartab->as_float(name);
+    if (m_vartab) return table_for(name)->as_float(name);
     else throw general_error("compute_module error: var_table does not exist.");
 }
 
 ssc_number_t compute_module::as_number(const std::string &name) {
-    if (m_vartab) return m_vartab->as_number(name);
+    if (m_vartab) return table_for(name)->as_number(name);
     else throw general_error("compute_module error: var_table does not exist.");
 }
 
 double compute_module::as_double(const std::string &name) {
-    if (m_vartab) return m_vartab->as_double(name);
+    if (m_vartab) return table_for(name)->as_double(name);
     else throw general_error("compute_module error: var_table does not exist.");
 }
 
 const char *compute_module::as_string(const std::string &name) {
-    if (m_vartab) return m_vartab->as_string(name);
+    if (m_vartab) return table_for(name)->as_string(name);
     else throw general_error("compute_module error: var_table does not exist.");
 }
 
 ssc_number_t *compute_module::as_array(const std::string &name, size_t *count) {
-    if (m_vartab) return m_vartab->as_array(name, count);
+    if (m_vartab) return table_for(name)->as_array(name, count);
     else throw general_error("compute_module error: var_table does not exist.");
 }
 
@@ -562,58 +937,58 @@ The obvious improvement would be to made this a template, but ran into trouble w
 "error: Access violation - no RTTI data!"
 */
 std::vector<int> compute_module::as_vector_integer(const std::string &name) {
-    if (m_vartab) return m_vartab->as_vector_integer(name);
+    if (m_vartab) return table_for(name)->as_vector_integer(name);
     else throw general_error("compute_module error: var_table does not exist.");
 }
 
 std::vector<ssc_number_t> compute_module::as_vector_ssc_number_t(const std::string &name) {
-    if (m_vartab) return m_vartab->as_vector_ssc_number_t(name);
+    if (m_vartab) return table_for(name)->as_vector_ssc_number_t(name);
     else throw general_error("compute_module error: var_table does not exist.");
 }
 
 std::vector<double> compute_module::as_vector_double(const std::string &name) {
-    if (m_vartab) return m_vartab->as_vector_double(name);
+    if (m_vartab) return table_for(name)->as_vector_double(name);
     else throw general_error("compute_module error: var_table does not exist.");
 }
 
 std::vector<float> compute_module::as_vector_float(const std::string &name) {
-    if (m_vartab) return m_vartab->as_vector_float(name);
+    if (m_vartab) return table_for(name)->as_vector_float(name);
     else throw general_error("compute_module error: var_table does not exist.");
 }
 
 std::vector<size_t> compute_module::as_vector_unsigned_long(const std::string &name) {
-    if (m_vartab) return m_vartab->as_vector_unsigned_long(name);
+    if (m_vartab) return table_for(name)->as_vector_unsigned_long(name);
     else throw general_error("compute_module error: var_table does not exist.");
 }
 
 std::vector<bool> compute_module::as_vector_bool(const std::string &name) {
-    if (m_vartab) return m_vartab->as_vector_bool(name);
+    if (m_vartab) return table_for(name)->as_vector_bool(name);
     else throw general_error("compute_module error: var_table does not exist.");
 }
 
 ssc_number_t *compute_module::as_matrix(const std::string &name, size_t *rows, size_t *cols) {
-    if (m_vartab) return m_vartab->as_matrix(name, rows, cols);
+    if (m_vartab) return table_for(name)->as_matrix(name, rows, cols);
     else throw general_error("compute_module error: var_table does not exist.");
 }
 
 util::matrix_t<double> compute_module::as_matrix(const std::string &name) {
-    if (m_vartab) return m_vartab->as_matrix(name);
+    if (m_vartab) return table_for(name)->as_matrix(name);
     else throw general_error("compute_module error: var_table does not exist.");
 }
 
 util::matrix_t<size_t> compute_module::as_matrix_unsigned_long(const std::string &name) {
-    if (m_vartab) return m_vartab->as_matrix_unsigned_long(name);
+    if (m_vartab) return table_for(name)->as_matrix_unsigned_long(name);
     else throw general_error("compute_module error: var_table does not exist.");
 }
 
 
 util::matrix_t<double> compute_module::as_matrix_transpose(const std::string &name) {
-    if (m_vartab) return m_vartab->as_matrix_transpose(name);
+    if (m_vartab) return table_for(name)->as_matrix_transpose(name);
     else throw general_error("compute_module error: var_table does not exist.");
 }
 
 bool compute_module::get_matrix(const std::string &name, util::matrix_t<ssc_number_t> &mat) {
-    if (m_vartab) return m_vartab->get_matrix(name, mat);
+    if (m_vartab) return table_for(name)->get_matrix(name, mat);
     else throw general_error("compute_module error: var_table does not exist.");
 }
 
@@ -635,47 +1010,47 @@ ssc_number_t compute_module::get_operand_value(const std::string &input, const s
 }
 
 bool compute_module::check_required(const std::string &name) {
+    return check_required(info_index(name));
+}
+
+bool compute_module::check_required(size_t index) {
     // only check if the variable is required as input to the simulation context
     // if it is an input or an inout variable
 
-    const var_info &inf = info(name);
-    if (inf.required_if == NULL || strlen(inf.required_if) == 0)
-        return false;
-
-    std::string reqexpr = inf.required_if;
+    const compiled_var_info::entry &e = compiled().entries[index];
+    const std::string &name = e.name;
 
-    if (reqexpr == "*") {
+    if (e.required == compiled_var_info::REQUIRED_NO) {
+        return false; // no requirement or always optional
+    } else if (e.required == compiled_var_info::REQUIRED_ALWAYS) {
         return true; // Always required
-    } else if (reqexpr == "?") {
-        return false; // Always optional
-    } else if (reqexpr.length() > 2 && reqexpr[0] == '?' && reqexpr[1] == '=') {
+    } else if (e.required == compiled_var_info::REQUIRED_DEFAULT) {
         // optional but has a default value that is assigned if variable is unassigned
-        var_data *v = lookup(name);
-        if (!v) {
-            v = assign(name, m_null_value);
-
-            if (!var_data::parse(inf.data_type, reqexpr.substr(2), *v))
+        if (!lookup(name)) {
+            if (!e.default_ok) {
+                assign(name, m_null_value);
                 throw check_error(name, "could not parse default value in required_if spec (" +
-                                        var_data::type_name(inf.data_type) + ")", reqexpr);
+                                        var_data::type_name(e.data_type) + ")", e.required_if_text);
+            }
+            assign(name, e.default_value);
         }
 
         return true; // a default value has been assigned, so this variable is effectively always required
     } else {
         // run tests
-        std::string::size_type pos = std::string::npos;
-        std::vector<std::string> expr_list = util::split(util::lower_case(reqexpr), "&|", true, true);
+        typedef compiled_var_info::required_term term;
 
         int cur_result = -1;
         char cur_cond_oper = 0;
-        for (std::vector<std::string>::iterator it = expr_list.begin(); it != expr_list.end(); ++it) {
-            std::string expr = *it;
-            if (expr == "&") {
+        for (std::vector<term>::const_iterator it = e.terms.begin(); it != e.terms.end(); ++it) {
+            const term &t = *it;
+            if (t.kind == term::AND) {
                 if (cur_result == 0) // short circuit evaluation
                     break;
 
                 cur_cond_oper = '&';
                 continue;
-            } else if (expr == "|") {
+            } else if (t.kind == term::OR) {
                 if (cur_result > 0) // short circuit evaluation
                     break;
 
@@ -683,72 +1058,52 @@ bool compute_module::check_required(const std::string &name) {
                 continue;
             } else {
                 int expr_result = 0;
-                char op = 0;
-                if ((pos = expr.find('=')) != std::string::npos) op = '=';
-                else if ((pos = expr.find('~')) != std::string::npos) op = '~';
-                else if ((pos = expr.find('<')) != std::string::npos) op = '<';
-                else if ((pos = expr.find('>')) != std::string::npos) op = '>';
-                else if ((pos = expr.find(':')) != std::string::npos) op = ':';
-
-                if (!op) throw check_error(name, "invalid operator", expr);
-
-                std::string lhs = expr.substr(0, pos);
-                std::string rhs = expr.substr(pos + 1);
-
-                if (lhs.length() < 1 || rhs.length() < 1) throw check_error(name, "null lhs or rhs in subexpr", expr);
-
-                if (op == ':') {
-                    /* handle built-in test operators */
-
-                    if (lhs == "na") // check if variable name in 'rhs' is not assigned
-                    {
-                        expr_result = lookup(rhs) == NULL ? 1 : 0;
-                    } else if (lhs == "a") // check if variable name in 'rhs' is assigned
-                    {
-                        expr_result = lookup(rhs) != NULL ? 1 : 0;
-                    } else if (lhs == "abt") // check if variable in 'rhs' is assigned, boolean type, and value true
-                    {
-                        var_data *v;
-                        if (((v = lookup(rhs)) != 0) && v->type == SSC_NUMBER && ((int) v->num) != 0)
+                var_data *v;
+                switch (t.kind) {
+                    case term::ERROR:
+                        throw check_error(name, t.error, t.expr);
+                    case term::NA: // check if variable name in 'rhs' is not assigned
+                        expr_result = lookup(t.rhs.text) == NULL ? 1 : 0;
+                        break;
+                    case term::A: // check if variable name in 'rhs' is assigned
+                        expr_result = lookup(t.rhs.text) != NULL ? 1 : 0;
+                        break;
+                    case term::ABT: // check if variable in 'rhs' is assigned, boolean type, and value true
+                        if (((v = lookup(t.rhs.text)) != 0) && v->type == SSC_NUMBER && ((int) v->num) != 0)
                             return 1;
                         else
                             return 0;
-                    } else if (lhs == "abf") // check if variable in 'rhs' is assigned, boolean type, and value false
-                    {
-                        var_data *v;
-                        if (((v = lookup(rhs)) != 0) && v->type == SSC_NUMBER && ((int) v->num) == 0)
+                    case term::ABF: // check if variable in 'rhs' is assigned, boolean type, and value false
+                        if (((v = lookup(t.rhs.text)) != 0) && v->type == SSC_NUMBER && ((int) v->num) == 0)
                             return 1;
                         else
                             return 0;
-                    } else if (lhs == "naof") // check if variable is not assigned OR boolean value is 'false'
-                    {
-                        var_data *v;
-                        if ((v = lookup(rhs)) == 0) return 1;
+                    case term::NAOF: // check if variable is not assigned OR boolean value is 'false'
+                        if ((v = lookup(t.rhs.text)) == 0) return 1;
                         if (v->type == SSC_NUMBER && ((int) v->num) == 0) return 1;
 
                         return 0;
-                    } else {
-                        throw check_error(name, "invalid built-in test", expr);
-                    }
-                } else {
-                    ssc_number_t lhs_val = get_operand_value(lhs, name);
-                    ssc_number_t rhs_val = get_operand_value(rhs, name);
-
-                    switch (op) {
-                        case '=':
-                            expr_result = lhs_val == rhs_val ? 1 : 0;
-                            break;
-                        case '~':
-                            expr_result = lhs_val != rhs_val ? 1 : 0;
-                            break;
-                        case '<':
-                            expr_result = lhs_val < rhs_val ? 1 : 0;
-                            break;
-                        case '>':
-                            expr_result = lhs_val > rhs_val ? 1 : 0;
-                            break;
-                        default:
-                            throw check_error(name, "invalid numerical operator", expr);
+                    default: {
+                        // numbers were parsed when compiled, variables and conversion errors go through get_operand_value
+                        ssc_number_t lhs_val = t.lhs.valid ? t.lhs.value : get_operand_value(t.lhs.text, name);
+                        ssc_number_t rhs_val = t.rhs.valid ? t.rhs.value : get_operand_value(t.rhs.text, name);
+
+                        switch (t.op) {
+                            case '=':
+                                expr_result = lhs_val == rhs_val ? 1 : 0;
+                                break;
+                            case '~':
+                                expr_result = lhs_val != rhs_val ? 1 : 0;
+                                break;
+                            case '<':
+                                expr_result = lhs_val < rhs_val ? 1 : 0;
+                                break;
+                            case '>':
+                                expr_result = lhs_val > rhs_val ? 1 : 0;
+                                break;
+                            default:
+                                throw check_error(name, "invalid numerical operator", t.expr);
+                        }
                     }
                 }
 
@@ -759,7 +1114,7 @@ bool compute_module::check_required(const std::string &name) {
                 } else if (cur_cond_oper == '|') {
                     cur_result = (cur_result || expr_result);
                 } else
-                    throw check_error(name, "invalid evaluation sequence", reqexpr);
+                    throw check_error(name, "invalid evaluation sequence", e.required_if_text);
             }
         }
 
@@ -770,116 +1125,130 @@ bool compute_module::check_required(const std::string &name) {
 }
 
 bool compute_module::check_constraints(const std::string &name, std::string &fail_text) {
+    return check_constraints(info_index(name), fail_text);
+}
+
+bool compute_module::check_constraints(size_t index, std::string &fail_text) {
 #define fail_constraint(str) { fail_text = "fail("+name+", "+expr+"): "+std::string(str); return false; }
 
-    const var_info &inf = info(name);
+    const compiled_var_info::entry &e = compiled().entries[index];
+    const std::string &name = e.name;
 
-    if (inf.constraints == NULL) return true; // pass if no constraints defined
+    if (e.constraints == NULL) return true; // pass if no constraints defined
 
     var_data &dat = value(name);
 
-    std::vector<std::string> exprlist = util::split(inf.constraints, ",");
-    for (std::vector<std::string>::iterator it = exprlist.begin(); it != exprlist.end(); ++it) {
-        std::string::size_type pos;
-        std::string expr = util::lower_case(*it);
-        if (expr == "tmyepw") {
-            if (dat.type != SSC_STRING || dat.str.length() <= 4) fail_constraint(
-                    "string data type required with length greater than 4 chars: " + dat.str);
-
-            std::string ext = util::lower_case(dat.str.substr(dat.str.length() - 3));
-            if (ext != "tm2" || ext != "tm3" || ext != "epw" || ext != "csv") fail_constraint(
-                    "file extension was not tm2,tm3,epw,csv: " + ext);
-        } else if (expr == "local_file") {
-            if (dat.type != SSC_STRING) fail_constraint("string data type required");
-
-            std::ifstream f_in(dat.str.c_str(), std::ios_base::in);
-            if (f_in.is_open())
-                f_in.close();
-            else fail_constraint("could not open for read: '" + dat.str + "'");
-        } else if (expr == "mxh_schedule") {
-            if (dat.type != SSC_STRING) fail_constraint("string data type required");
-
-            if (dat.str.length() != 288) fail_constraint(
-                    "288 characters required (24x12) but " + util::to_string((int) dat.str.length()) + " found");
-
-            for (std::string::size_type i = 0; i < dat.str.length(); i++)
-                if (dat.str[i] < '0' || dat.str[i] > '9') fail_constraint(
-                        util::format("invalid character %c at %d", (char) dat.str[i], (int) i));
-        } else if (expr == "boolean") {
-            if (dat.type != SSC_NUMBER) fail_constraint("number data type required");
-
-            int val = (int) dat.num;
-            if (val != 0 && val != 1) fail_constraint("value was not 0 nor 1");
-        } else if (expr == "integer") {
-            if (dat.type != SSC_NUMBER) fail_constraint("number data type required");
-
-            if (((ssc_number_t) ((int) dat.num)) != dat.num) fail_constraint(
-                    "number could not be interpreted as an integer: " + util::to_string((double) dat.num));
-        } else if (expr == "tousched") {
-            if (dat.type != SSC_STRING) fail_constraint("string data type required");
-
-            if (dat.str.length() != 288) fail_constraint("288 character string required (12x24 values)");
-
-            for (std::string::size_type i = 0; i < dat.str.length(); i++) {
-//				if ( dat.str[i] < '1' || dat.str[i] > '9' )
-                if (util::schedule_char_to_int(dat.str[i]) == 0) fail_constraint(
-                        "all digits must be between 1 and 9, inclusive");
+    typedef compiled_var_info::constraint_test test;
+    for (std::vector<test>::const_iterator it = e.tests.begin(); it != e.tests.end(); ++it) {
+        const test &t = *it;
+        const std::string &expr = t.expr;
+        switch (t.kind) {
+            case test::TMYEPW: {
+                if (dat.type != SSC_STRING || dat.str.length() <= 4) fail_constraint(
+                        "string data type required with length greater than 4 chars: " + dat.str);
+
+                std::string ext = util::lower_case(dat.str.substr(dat.str.length() - 3));
+                if (ext != "tm2" || ext != "tm3" || ext != "epw" || ext != "csv") fail_constraint(
+                        "file extension was not tm2,tm3,epw,csv: " + ext);
+                break;
             }
-        } else if (expr == "positive") {
-            if (dat.type != SSC_NUMBER)
-                throw constraint_error(name, "cannot test for positive with non-numeric type", expr);
-            if (dat.num <= 0.0) fail_constraint(util::to_string((double) dat.num));
-        } else if (expr == "percent") {
-            if (dat.type != SSC_NUMBER)
-                throw constraint_error(name, "cannot test for percent (%) constraint with non-numeric type", expr);
-            if (dat.num < 0.0 || dat.num > 100.0) fail_constraint(util::to_string((double) dat.num));
-        } else if (expr == "factor") {
-            if (dat.type != SSC_NUMBER)
-                throw constraint_error(name, "cannot test for factor (0..1) constraint with non-numeric type", expr);
-            if (dat.num < 0.0 || dat.num > 1.0) fail_constraint(util::to_string((double) dat.num));
-        } else if (expr == "ts_m") {
-            if (dat.type != SSC_NUMBER) fail_constraint("number data type required");
-
-            int val = (int) dat.num;
-            if (val != 1
-                && val != 5
-                && val != 10
-                && val != 15
-                && val != 30
-                && val != 60
-                    ) {
-                fail_constraint("time step must be 1,5,10,15,30,60 minutes");
+            case test::LOCAL_FILE: {
+                if (dat.type != SSC_STRING) fail_constraint("string data type required");
+
+                std::ifstream f_in(dat.str.c_str(), std::ios_base::in);
+                if (f_in.is_open())
+                    f_in.close();
+                else fail_constraint("could not open for read: '" + dat.str + "'");
+                break;
             }
-        } else if ((pos = expr.find('=')) != std::string::npos) {
-            std::string test = expr.substr(0, pos);
-            std::string rhs = expr.substr(pos + 1);
+            case test::MXH_SCHEDULE:
+                if (dat.type != SSC_STRING) fail_constraint("string data type required");
+
+                if (dat.str.length() != 288) fail_constraint(
+                        "288 characters required (24x12) but " + util::to_string((int) dat.str.length()) + " found");
+
+                for (std::string::size_type i = 0; i < dat.str.length(); i++)
+                    if (dat.str[i] < '0' || dat.str[i] > '9') fail_constraint(
+                            util::format("invalid character %c at %d", (char) dat.str[i], (int) i));
+                break;
+            case test::BOOLEAN: {
+                if (dat.type != SSC_NUMBER) fail_constraint("number data type required");
+
+                int val = (int) dat.num;
+                if (val != 0 && val != 1) fail_constraint("value was not 0 nor 1");
+                break;
+            }
+            case test::INTEGER:
+                if (dat.type != SSC_NUMBER) fail_constraint("number data type required");
+
+                if (((ssc_number_t) ((int) dat.num)) != dat.num) fail_constraint(
+                        "number could not be interpreted as an integer: " + util::to_string((double) dat.num));
+                break;
+            case test::TOUSCHED:
+                if (dat.type != SSC_STRING) fail_constraint("string data type required");
 
-            if (test == "min") {
+                if (dat.str.length() != 288) fail_constraint("288 character string required (12x24 values)");
+
+                for (std::string::size_type i = 0; i < dat.str.length(); i++) {
+                    if (util::schedule_char_to_int(dat.str[i]) == 0) fail_constraint(
+                            "all digits must be between 1 and 9, inclusive");
+                }
+                break;
+            case test::POSITIVE:
+                if (dat.type != SSC_NUMBER)
+                    throw constraint_error(name, "cannot test for positive with non-numeric type", expr);
+                if (dat.num <= 0.0) fail_constraint(util::to_string((double) dat.num));
+                break;
+            case test::PERCENT:
+                if (dat.type != SSC_NUMBER)
+                    throw constraint_error(name, "cannot test for percent (%) constraint with non-numeric type", expr);
+                if (dat.num < 0.0 || dat.num > 100.0) fail_constraint(util::to_string((double) dat.num));
+                break;
+            case test::FACTOR:
+                if (dat.type != SSC_NUMBER)
+                    throw constraint_error(name, "cannot test for factor (0..1) constraint with non-numeric type", expr);
+                if (dat.num < 0.0 || dat.num > 1.0) fail_constraint(util::to_string((double) dat.num));
+                break;
+            case test::TS_M: {
+                if (dat.type != SSC_NUMBER) fail_constraint("number data type required");
+
+                int val = (int) dat.num;
+                if (val != 1
+                    && val != 5
+                    && val != 10
+                    && val != 15
+                    && val != 30
+                    && val != 60
+                        ) {
+                    fail_constraint("time step must be 1,5,10,15,30,60 minutes");
+                }
+                break;
+            }
+            case test::MIN:
                 if (dat.type != SSC_NUMBER)
                     throw constraint_error(name, "cannot test for min with non-numeric type", expr);
-                double minval = 0;
-                if (!util::to_double(rhs, &minval))
+                if (!t.valid)
                     throw constraint_error(name, "test for min requires a number value", expr);
-                if (dat.num < (ssc_number_t) minval) fail_constraint(util::to_string((double) dat.num));
-            } else if (test == "max") {
+                if (dat.num < (ssc_number_t) t.num) fail_constraint(util::to_string((double) dat.num));
+                break;
+            case test::MAX:
                 if (dat.type != SSC_NUMBER)
                     throw constraint_error(name, "cannot test for max with non-numeric type", expr);
-                double maxval = 0;
-                if (!util::to_double(rhs, &maxval))
+                if (!t.valid)
                     throw constraint_error(name, "test for max requires a numeric value", expr);
-                if (dat.num > (ssc_number_t) maxval) fail_constraint(util::to_string((double) dat.num));
-            } else if (test == "length") {
+                if (dat.num > (ssc_number_t) t.num) fail_constraint(util::to_string((double) dat.num));
+                break;
+            case test::LENGTH:
                 if (dat.type != SSC_ARRAY)
                     throw constraint_error(name, "cannot test for length with non-array type", expr);
-                int lenval = 0;
-                if (!util::to_integer(rhs, &lenval))
+                if (!t.valid)
                     throw constraint_error(name, "test for length requires an integer value", expr);
-                size_t len = (size_t) lenval;
-                if (dat.num.length() != len) fail_constraint(util::to_string((int) dat.num.length()));
-            } else if (test == "length_equal") {
+                if (dat.num.length() != (size_t) t.ival) fail_constraint(util::to_string((int) dat.num.length()));
+                break;
+            case test::LENGTH_EQUAL: {
                 if (dat.type != SSC_ARRAY)
                     throw constraint_error(name, "cannot test for length_equal with non-array type", expr);
-                var_data *other = lookup(rhs);
+                var_data *other = lookup(t.rhs);
                 if (!other) throw constraint_error(name, "length_equal cannot find variable to test against", expr);
                 if (other->type == SSC_ARRAY) {
                     if (dat.num.length() != other->num.length()) fail_constraint(
@@ -890,35 +1259,36 @@ bool compute_module::check_constraints(const std::string &name, std::string &fai
                 } else
                     throw constraint_error(name, "length_equal must specify a number or array variable to test against",
                                            expr);
-            } else if (test == "length_multiple_of") {
+                break;
+            }
+            case test::LENGTH_MULTIPLE_OF: {
                 if (dat.type != SSC_ARRAY)
                     throw constraint_error(name, "cannot test for length_multiple_of with non-array type", expr);
-                int lenval = 0;
-                if (!util::to_integer(rhs, &lenval) || lenval < 1)
+                if (!t.valid)
                     throw constraint_error(name, "test for length_multiple_of requires a positive integer value", expr);
-                size_t len = (size_t) lenval;
+                size_t len = (size_t) t.ival;
                 size_t multiplier = dat.num.length() / len;
                 if (dat.num.length() < len || len * multiplier != dat.num.length()) fail_constraint(
                         util::to_string((int) dat.num.length()));
-            } else if (test == "rows") {
+                break;
+            }
+            case test::ROWS:
                 if (dat.type != SSC_MATRIX)
                     throw constraint_error(name, "cannot test for rows with non-matrix type", expr);
-                int nrows = 0;
-                if (!util::to_integer(rhs, &nrows) || nrows < 1)
+                if (!t.valid)
                     throw constraint_error(name, "test for rows requires a positive integer value", expr);
-                if (dat.num.nrows() != (size_t) nrows) fail_constraint(util::to_string((int) dat.num.nrows()));
-            } else if (test == "cols") {
+                if (dat.num.nrows() != (size_t) t.ival) fail_constraint(util::to_string((int) dat.num.nrows()));
+                break;
+            case test::COLS:
                 if (dat.type != SSC_MATRIX)
                     throw constraint_error(name, "cannot test for cols with non-matrix type", expr);
-                int ncols = 0;
-                if (!util::to_integer(rhs, &ncols) || ncols < 1)
+                if (!t.valid)
                     throw constraint_error(name, "test for cols requires a positive integer value", expr);
-                if (dat.num.ncols() != (size_t) ncols) fail_constraint(util::to_string((int) dat.num.ncols()));
-            }
-        } else {
-            throw constraint_error(name, "invalid test or expression", expr);
+                if (dat.num.ncols() != (size_t) t.ival) fail_constraint(util::to_string((int) dat.num.ncols()));
+                break;
+            default:
+                throw constraint_error(name, "invalid test or expression", expr);
         }
-
     }
 
     // all constraints passed fine
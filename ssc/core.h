@@ -161,6 +161,9 @@ public:
             : general_error( util::format("timestep fail(%lg %lg %lg): %s", start, end, step, reason) ) {  }
 };
 
+/* immutable parsed form of a module's var_info list, shared by all instances with the same list (see core.cpp) */
+struct compiled_var_info;
+
 class compute_module
 {
 public:
@@ -224,9 +227,10 @@ protected:
 	   note: can throw exceptions of type 'compute_module::error' */
 	virtual void exec( ) = 0;
 
-	/* can be called in constructors to build up the variable table references */
+	/* can be called in constructors to build up the variable table references.
+	   the compiled table is otherwise fetched lazily on first lookup */
 	void build_info_map();
-	bool has_info_map() { return m_infomap!=NULL; }
+	bool has_info_map() { return m_compiled.get() != NULL; }
 
 	/* can be called in exec if determine shouldn't run module */
 	void remove_var_info(var_info vi[]);
@@ -239,11 +243,39 @@ public:
 	var_data *lookup( const std::string &name );
     var_data *assign( const std::string &name, const var_data &value );
     void unassign( const std::string& name);
+
+	/* resolves 'name' once for repeated access in loops (see var_handle). outputs should be allocated
+	   before their handle is created so that it refers to the table that holds them */
+	var_handle handle( const std::string &name );
     ssc_number_t *allocate( const std::string &name, size_t length );
 	ssc_number_t *allocate( const std::string &name, size_t nrows, size_t ncols );
 	util::matrix_t<ssc_number_t>& allocate_matrix( const std::string &name, size_t nrows, size_t ncols );
     ssc_number_t* resize_array(const std::string& name, size_t length);
     ssc_number_t* resize_matrix(const std::string& name, size_t n_rows, size_t n_cols);
+
+	/* output selection: the caller may set 'output_tier' (number, see OUTPUT_TIER_*) and/or 'output_filter'
+	   (comma-separated names of array outputs to keep) in the data container. Array and matrix outputs that are
+	   not requested are allocated in a scratch table that is still visible to this module's accessors during exec,
+	   and are discarded when compute() returns. If only 'output_filter' is given, the tier is OUTPUT_TIER_SUMMARY.
+	   Both are removed from the data when compute() returns, so a selection applies to one module run */
+	enum { OUTPUT_TIER_FULL, OUTPUT_TIER_AGGREGATE, OUTPUT_TIER_SUMMARY };
+	bool is_output_requested( const std::string &name, size_t length = 0 );
+	// returns NULL without allocating if the output is not requested, for pointers only handed to a reporting sink
+	ssc_number_t *allocate_if_requested( const std::string &name, size_t length );
+
+	/* streaming: the caller may set 'output_stream' to 1 so that long lifetime runs allocate their time series
+	   outputs one chunk (year) long instead of for the whole analysis period. After filling a chunk the module calls
+	   stream_chunk, which passes it to the handler's on_stream (SSC_STREAM through the C API) and appends it to the
+	   CSV file 'output_stream_file' if given. The first chunk is kept and put back by stream_finish, so that monthly
+	   and annual aggregates for year one can be computed from the outputs as usual. Pointers to the streamed
+	   arrays should be looked up again after stream_finish.
+	   Only the grid module streams so far, other modules ignore 'output_stream'. Streamed outputs hold year one
+	   when compute() returns, including the in/out 'gen', so modules that need lifetime values of them must not
+	   run afterwards on the same data */
+	bool is_streaming() { return m_stream; }
+	void stream_chunk( const std::vector<std::string> &names, size_t chunk, size_t n_records );
+	void stream_finish();
+
 	var_data &value( const std::string &name );
 	bool is_assigned( const std::string &name );
 	size_t as_unsigned_long(const std::string &name);
@@ -285,16 +317,39 @@ private:
 
 	bool check_required( const std::string &name );
 	bool check_constraints( const std::string &name, std::string &fail_text );
+	bool check_required( size_t index );
+	bool check_constraints( size_t index, std::string &fail_text );
+
+	// name lookup, required_if predicates, defaults and constraints parsed once per var_info list
+	const compiled_var_info &compiled();
+	size_t info_index( const std::string &name );
+
+	// helper functions for output selection
+	void setup_output_selection();
+	bool is_output_filtered( var_info *vi );
+	void remove_unrequested_outputs();
+	var_data *assign_output( const std::string &name, size_t length );
+	var_table *table_for( const std::string &name ) {
+		return (m_unrequested.size() > 0 && m_unrequested.is_assigned(name)) ? &m_unrequested : m_vartab;
+	}
 
 	// helper functions for check_required
 	ssc_number_t get_operand_value( const std::string &input, const std::string &cur_var_name );
 
 	var_data m_null_value;
 
+	int m_output_tier;
+	std::vector< std::string > m_output_filter;
+	var_table m_unrequested;
+
+	bool m_stream;
+	std::string m_stream_file;
+	var_table m_stream_first;
+
 	std::vector< var_info* > m_varlist;
 	std::vector< log_item > m_loglist;
 
-	unordered_map< std::string, var_info* > *m_infomap;
+	std::shared_ptr< const compiled_var_info > m_compiled;
 };
 
 
@@ -308,6 +363,7 @@ public:
 	virtual ~handler_interface() {  /* nothing to do */ }
 	virtual void on_log( const std::string &text, int type, float time ) = 0;
 	virtual bool on_update( const std::string &text, float percent_done, float time ) = 0;
+	virtual void on_stream( const std::string &names, size_t chunk, size_t n_records ) {  }
 //	virtual bool on_exec( const std::string &command, const std::string &workdir ) = 0;
 
 	compute_module *module() { return m_cm; }
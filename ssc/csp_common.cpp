@@ -788,6 +788,7 @@ var_info vtab_sco2_design[] = {
     { SSC_INPUT,  SSC_NUMBER,  "des_objective",        "[2] = hit min phx deltat then max eta, [else] max eta",  "",           "High temperature recuperator",    "Heat Exchanger Design",      "?=0",   "",       "" },
 	{ SSC_INPUT,  SSC_NUMBER,  "min_phx_deltaT",       "Minimum design temperature difference across PHX",       "C",          "High temperature recuperator",    "Heat Exchanger Design",      "?=0",   "",       "" },
 	{ SSC_INPUT,  SSC_NUMBER,  "rel_tol",              "Baseline solver and optimization relative tolerance exponent (10^-rel_tol)", "-", "High temperature recuperator", "Heat Exchanger Design", "?=3","",       "" },
+	{ SSC_INPUT,  SSC_NUMBER,  "n_multi_start_threads","Threads for multi-start cycle design optimization, 1 = single starting point", "-", "High temperature recuperator", "Heat Exchanger Design", "?=1", "INTEGER,MIN=1", "" },
 		// Cycle Design
 	{ SSC_INPUT,  SSC_NUMBER,  "eta_isen_mc",          "Design main compressor isentropic efficiency",           "-",          "",    "",      "*",     "",       "" },
     { SSC_INPUT,  SSC_NUMBER,  "mc_comp_type",         "Main compressor compressor type 1: SNL 2: CompA",        "-",          "",    "",      "?=1",   "",       "" },
@@ -1210,6 +1211,7 @@ int sco2_design_cmod_common(compute_module *cm, C_sco2_phx_air_cooler & c_sco2_c
 	// PHX design parameters
 	s_sco2_des_par.m_des_objective_type = cm->as_integer("des_objective");		//[-] 
 	s_sco2_des_par.m_min_phx_deltaT = cm->as_double("min_phx_deltaT");			//[C]
+	s_sco2_des_par.m_n_multi_start_threads = cm->as_integer("n_multi_start_threads");	//[-]
 	s_sco2_des_par.m_phx_dt_cold_approach = cm->as_double("dT_PHX_cold_approach");  //[C]
     s_sco2_des_par.m_phx_N_sub_hx = cm->as_integer("PHX_n_sub_hx");              //[-]
     s_sco2_des_par.m_phx_od_UA_target_type = static_cast<NS_HX_counterflow_eqs::E_UA_target_type>(cm->as_integer("PHX_od_model"));   // E_calc_UA;
@@ -70,10 +70,12 @@ extern module_entry_info
 	cm_entry_iec61853par,
 	cm_entry_iec61853interp,
 	cm_entry_6parsolve,
+	cm_entry_6parsolve_batch,
 	cm_entry_pvsamv1,
 	cm_entry_pvwattsv5,
 	cm_entry_pvwattsv7,
     cm_entry_pvwattsv8,
+    cm_entry_pvwattsv8_batch,
 	cm_entry_pvwattsv5_1ts,
 	cm_entry_pv6parmod,
 	cm_entry_pvsandiainv,
@@ -178,11 +180,13 @@ static module_entry_info *module_table[] = {
 	&cm_entry_iec61853par,
 	&cm_entry_iec61853interp,
 	&cm_entry_6parsolve,
+	&cm_entry_6parsolve_batch,
 	&cm_entry_pv6parmod,
 	&cm_entry_pvsamv1,
 	&cm_entry_pvwattsv5,
 	&cm_entry_pvwattsv7,
     &cm_entry_pvwattsv8,
+    &cm_entry_pvwattsv8_batch,
 	&cm_entry_pvwattsv5_1ts,
 	&cm_entry_pvsandiainv,
 	&cm_entry_wfreader,
@@ -1286,6 +1290,14 @@ public:
 					static_cast<ssc_handler_t>( static_cast<handler_interface*>(this) ),
 					SSC_UPDATE, percent, time, text.c_str(), 0, m_hdata ) ? 1 : 0;
 	}
+
+	virtual void on_stream( const std::string &names, size_t chunk, size_t n_records )
+	{
+		if (!m_hfunc) return;
+		(*m_hfunc)( static_cast<ssc_module_t>( module() ),
+					static_cast<ssc_handler_t>( static_cast<handler_interface*>(this) ),
+					SSC_STREAM, (float)chunk, (float)n_records, names.c_str(), 0, m_hdata );
+	}
 };
 
 SSCEXPORT ssc_bool_t ssc_module_exec_with_handler(
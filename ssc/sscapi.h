@@ -411,12 +411,16 @@ SSCEXPORT const char *ssc_module_exec_simple_nothread( const char *name, ssc_dat
 /** @name Action/notification types that can be sent to a handler function:
   *	SSC_LOG: Log a message in the handler. f0: (int)message type, f1: time, s0: message text, s1: unused.
   *	SSC_UPDATE: Notify simulation progress update. f0: percent done, f1: time, s0: current action text, s1: unused.
+  *	SSC_STREAM: A chunk of time series outputs is ready when the module runs with 'output_stream' set to 1. f0: chunk (year) index, f1: number of records in the chunk, s0: comma-separated names of the streamed outputs, s1: unused. During the call the named arrays hold the chunk's values and can be read from the data container with ssc_data_get_array. Currently only the grid module streams. After the run the streamed arrays, including 'gen', hold year one only.
 */
 /**@{*/
 #define SSC_LOG 0
 #define SSC_UPDATE 1
+#define SSC_STREAM 2
 /**@}*/
 
+/** Output selection: before a module runs, 'output_tier' (0: full, 1: aggregate, drops time series, 2: summary, drops all arrays) and/or 'output_filter' (comma-separated names of the array outputs to keep) may be set in the data container to skip array outputs that are not needed. Both are removed from the data container when the module returns, so a selection applies to that one run. When several modules run in turn on one data container (e.g. pvsamv1, grid, utilityrate5 and a financial model), only set a selection before a module whose dropped outputs no later module reads: selecting outputs of pvsamv1 drops 'gen', and of battery drops 'batt_capacity_percent', which grid and the financial models require. */
+
 /** Runs an instantiated computation module over the specified data set. Returns Boolean: 1 or 0. Detailed notices, warnings, and errors can be retrieved using the ssc_module_log function. */
 SSCEXPORT ssc_bool_t ssc_module_exec( ssc_module_t p_mod, ssc_data_t p_data ); /* uses default internal built-in handler */
 
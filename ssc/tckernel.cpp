@@ -34,7 +34,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 
 tcKernel::tcKernel(tcstypeprovider *prov)
-	: tcskernel(prov), m_start(0), m_end(0), m_step(0)
+	: tcskernel(prov), m_start(0), m_end(0), m_step(0), m_dataIndex(0), m_nsteps(0)
 {
 	m_storeArrMatData = false;
 	m_storeAllParameters = false;
@@ -84,16 +84,26 @@ bool tcKernel::converged( double time )
 	std::string buf;
 	char ibuf[128];
 	size_t j,k;
+	if ( m_dataIndex >= m_nsteps )
+		return true;
+
 	for ( size_t i=0;i<m_results.size(); i++ )
 	{
 		tcsvalue &v = m_results[i].u->values[ m_results[i].idx ];
+		if ( m_results[i].column != 0 )
+		{
+			m_results[i].column[ m_dataIndex ] = (ssc_number_t)v.data.value;
+			continue;
+		}
+
 		switch( m_results[i].type )
 		{
 		case TCS_NUMBER:
 			m_results[i].values[ m_dataIndex ].dval = v.data.value;
 			break;
 		case TCS_STRING:
-			m_results[i].values[ m_dataIndex ].sval = v.data.cstr;
+			if ( m_storeArrMatData )
+				m_results[i].values[ m_dataIndex ].sval = v.data.cstr;
 			break;
 		case TCS_ARRAY:
 			if ( m_storeArrMatData )
@@ -150,6 +160,7 @@ int tcKernel::simulate( double start, double end, double step, int max_iter )
 		return -77;
 
 	int nsteps = (int)( (end-start)/step ) + 1;
+	m_nsteps = (size_t)nsteps;
 
 	size_t ndatasets = 0;
 	for (size_t i=0;i<m_units.size();i++)
@@ -188,7 +199,23 @@ int tcKernel::simulate( double start, double end, double step, int max_iter )
 				d.name = vars[idx].name;
 				d.units = vars[idx].units;
 				d.type = vars[idx].data_type;
-				d.values.resize( nsteps, dataitem(0.0) );
+				d.column = 0;
+				d.values.clear();
+				if ( d.type == TCS_NUMBER && is_ssc_array_output(d.name) )
+				{
+					// the last unit with a given name owns the output, as when outputs were assigned after the simulation
+					for (size_t j=0;j+1<idataset;j++)
+					{
+						if ( m_results[j].column != 0 && m_results[j].name == d.name )
+						{
+							m_results[j].column = 0;
+							m_results[j].values.resize( nsteps, dataitem(0.0) );
+						}
+					}
+					d.column = allocate( d.name, nsteps );
+				}
+				else if ( d.type == TCS_NUMBER || m_storeArrMatData )
+					d.values.resize( nsteps, dataitem(0.0) );
 			}
 			idx++;
 		}
@@ -312,17 +339,40 @@ bool tcKernel::set_output_array(const char *output_name, size_t len, double scal
 bool tcKernel::set_output_array(const char *ssc_output_name, const char *tcs_output_name, size_t len, double scaling)
 {
 	int idx=0;
-	ssc_number_t *output_array = allocate( ssc_output_name, len );
 	while( tcKernel::dataset *d = get_results(idx++) )
 	{
-		if ( (d->type == TCS_NUMBER) && (d->name == tcs_output_name) && (d->values.size() == len ) )
+		if ( (d->type == TCS_NUMBER) && (d->name == tcs_output_name) )
 		{
-			for (size_t i=0;i<len;i++)
-				output_array[i] = (ssc_number_t)(d->values[i].dval * scaling);
-			return true;
+			if ( d->column != 0 )
+			{
+				if ( m_nsteps != len ) return false;
+
+				if ( d->name == ssc_output_name )
+				{
+					// recorded in place, only scaling remains
+					if ( scaling != 1 )
+						for (size_t i=0;i<len;i++)
+							d->column[i] = (ssc_number_t)(d->column[i] * scaling);
+				}
+				else
+				{
+					ssc_number_t *output_array = allocate( ssc_output_name, len );
+					for (size_t i=0;i<len;i++)
+						output_array[i] = (ssc_number_t)(d->column[i] * scaling);
+				}
+				return true;
+			}
+			else if ( d->values.size() == len )
+			{
+				ssc_number_t *output_array = allocate( ssc_output_name, len );
+				for (size_t i=0;i<len;i++)
+					output_array[i] = (ssc_number_t)(d->values[i].dval * scaling);
+				return true;
+			}
 		}
 	}
 
+	allocate( ssc_output_name, len );
 	return false;
 }
 
@@ -333,8 +383,16 @@ bool tcKernel::set_all_output_arrays()
 	{	// if the TCS value is a TCS_NUMBER (so that we can put the value into a one-dimensional array - single value for 8760 hours)
 		// and
 		// if there is an SSC_OUTPUT with the same name
-		if ( (d->type == TCS_NUMBER) && ( is_ssc_array_output(d->name) ) )
+		// (numeric SSC outputs recorded into columns are already in place)
+		if ( (d->type == TCS_NUMBER) && d->column == 0 && ( is_ssc_array_output(d->name) ) )
 		{
+			bool in_place = false;
+			for (size_t j=0; j<m_results.size(); j++)
+				if ( m_results[j].column != 0 && m_results[j].name == d->name )
+					in_place = true;
+			if ( in_place )
+				continue;
+
 			ssc_number_t *output_array = allocate( d->name, d->values.size() );
 			for (size_t i=0; i<d->values.size(); i++)
 				output_array[i] = (ssc_number_t) d->values[i].dval;
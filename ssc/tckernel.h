@@ -89,17 +89,19 @@ public:
 		std::string units;
 		std::string group;
 		int type;
-		std::vector<dataitem> values;
+		ssc_number_t *column; // numeric SSC outputs are written directly into the allocated output array
+		std::vector<dataitem> values; // all other recorded values (empty when 'column' is used)
 	};
 
 	dataset *get_results(int idx);
 
 private:
-	bool m_storeArrMatData;
+	bool m_storeArrMatData; // true = string, array and matrix values are also stored (formatted as text) every time step
 	bool m_storeAllParameters; // true = all inputs/outputs for all units will be saved for every time step; false = only store values that match SSC parameters defined as SSC_OUTPUT or SSC_INOUT
 	std::vector< dataset > m_results;
 	double m_start, m_end, m_step;
 	size_t m_dataIndex;
+	size_t m_nsteps;
 };
 
 #endif
\ No newline at end of file
@@ -203,7 +203,7 @@ bool var_data::parse( unsigned char type, const std::string &buf, var_data &valu
 	return false;
 }
 
-var_table::var_table() : m_iterator(m_hash.begin())
+var_table::var_table() : m_iterator(m_hash.begin()), m_iterator_pos(-1), m_iterator_generation(0), m_generation(0)
 {
 	/* nothing to do here */
 }
@@ -239,6 +239,7 @@ void var_table::clear()
 	}
     m_hash.erase(m_hash.begin(), m_hash.end());
 	if (!m_hash.empty()) m_hash.clear();
+	m_generation++;
 }
 
 var_data *var_table::assign( const std::string &name, const var_data &val )
@@ -248,6 +249,7 @@ var_data *var_table::assign( const std::string &name, const var_data &val )
 	{
 		v = new var_data;
 		m_hash[ util::lower_case(name) ] = v;
+		m_generation++;
 	}
 
 	v->copy(val);
@@ -261,6 +263,7 @@ var_data *var_table::assign_match_case( const std::string &name, const var_data
     {
         v = new var_data;
         m_hash[ name ] = v;
+        m_generation++;
     }
 
     v->copy(val);
@@ -297,6 +300,7 @@ void var_table::unassign( const std::string &name )
 	{
 		delete (*it).second; // delete the associated data
 		m_hash.erase( it );
+		m_generation++;
 	}
 }
 
@@ -315,6 +319,7 @@ bool var_table::rename_match_case( const std::string &oldname, const std::string
 
         var_data *data = it->second; // save ptr to data
         m_hash.erase( it );
+        m_generation++;
 
         // if a variable with 'newname' already exists,
         // delete its data, and reassign the name to the new data
@@ -355,6 +360,7 @@ var_data *var_table::lookup_match_case( const std::string &name )
 
 const char *var_table::first( )
 {
+	m_iterator_pos = -1;
 	m_iterator = m_hash.begin();
 	if (m_iterator != m_hash.end())
 		return m_iterator->first.c_str();
@@ -363,15 +369,24 @@ const char *var_table::first( )
 }
 
 const char *var_table::key(int pos){
-    m_iterator = m_hash.begin();
+    // walking the keys by increasing position continues from the previous key instead of restarting
+    int n = 0;
+    if (m_iterator_pos >= 0 && pos >= m_iterator_pos && m_iterator_generation == m_generation)
+        n = m_iterator_pos;
+    else
+        m_iterator = m_hash.begin();
+
+    m_iterator_pos = -1;
     if (m_iterator == m_hash.end()) return NULL;
 
-    int n = 0;
-    for (n = 0; n < pos; n++)
+    for (; n < pos && m_iterator != m_hash.end(); n++)
         ++m_iterator;
 
-    if (m_iterator != m_hash.end())
+    if (m_iterator != m_hash.end()) {
+        m_iterator_pos = pos;
+        m_iterator_generation = m_generation;
         return m_iterator->first.c_str();
+    }
     return NULL;
 }
 
@@ -379,6 +394,7 @@ const char *var_table::next()
 {
 	if (m_iterator == m_hash.end()) return NULL;
 
+	m_iterator_pos = -1;
 	++m_iterator;
 
 	if (m_iterator != m_hash.end())	return m_iterator->first.c_str();
@@ -386,6 +402,68 @@ const char *var_table::next()
 	return NULL;
 }
 
+void var_handle::resolve()
+{
+	m_data = m_table->lookup(m_name);
+	m_generation = m_table->generation();
+}
+
+var_data *var_handle::assign( const var_data &value )
+{
+	if (!m_table) throw general_error("variable handle is not bound to a data container: " + m_name);
+	if (var_data *v = get())
+		v->copy(value);
+	else
+	{
+		m_table->assign(m_name, value);
+		resolve();
+	}
+	return m_data;
+}
+
+var_data &var_handle::value()
+{
+	var_data *x = get();
+	if (!x) throw general_error(m_name + " not assigned");
+	return *x;
+}
+
+int var_handle::as_integer()
+{
+	var_data &x = value();
+	if (x.type != SSC_NUMBER) throw cast_error("integer", x, m_name);
+	return static_cast<int>(x.num);
+}
+
+bool var_handle::as_boolean()
+{
+	var_data &x = value();
+	if (x.type != SSC_NUMBER) throw cast_error("boolean", x, m_name);
+	return static_cast<bool> ( (int)(x.num!=0) );
+}
+
+ssc_number_t var_handle::as_number()
+{
+	var_data &x = value();
+	if (x.type != SSC_NUMBER) throw cast_error("ssc_number_t", x, m_name);
+	return x.num;
+}
+
+double var_handle::as_double()
+{
+	var_data &x = value();
+	if (x.type != SSC_NUMBER) throw cast_error("double", x, m_name);
+	return static_cast<double>(x.num);
+}
+
+ssc_number_t *var_handle::as_array( size_t *count )
+{
+	var_data &x = value();
+	if (x.type != SSC_ARRAY) throw cast_error("array", x, m_name);
+	if (count) *count = x.num.length();
+	return x.num.data();
+}
+
 void vt_get_int(var_table* vt, const std::string& name, int* lvalue) {
 	if (var_data* vd = vt->lookup(name)) *lvalue = (int)vd->num;
 	else throw std::runtime_error(std::string(name) + std::string(" must be assigned."));
@@ -70,6 +70,10 @@ public:
 	const char *key(int pos);
 	unsigned int size() { return (unsigned int)m_hash.size(); }
 
+	// changes whenever a variable is added, removed or renamed. var_data pointers from lookup() and assign()
+	// stay valid while it is unchanged (see var_handle)
+	unsigned long generation() const { return m_generation; }
+
     // setters
     ssc_number_t *allocate( const std::string &name, size_t length );
     ssc_number_t *allocate( const std::string &name, size_t nrows, size_t ncols );
@@ -107,6 +111,9 @@ public:
 private:
 	var_hash m_hash;
 	var_hash::iterator m_iterator;
+	int m_iterator_pos;
+	unsigned long m_iterator_generation;
+	unsigned long m_generation;
 };
 
 
@@ -178,6 +185,41 @@ public:
 
 };
 
+/* a variable name resolved once against a var_table. the var_data pointer is cached and only looked up again
+   after variables are added, removed or renamed in the table, so timestep loops can read and write a variable
+   without constructing and hashing its name on every access */
+class var_handle
+{
+public:
+	var_handle() : m_table(NULL), m_data(NULL), m_generation(0) { }
+	var_handle( var_table *vt, const std::string &name ) : m_table(vt), m_name(name), m_data(NULL), m_generation(0) { resolve(); }
+
+	const std::string &name() const { return m_name; }
+
+	// NULL if the variable is not assigned
+	var_data *get() {
+		if (m_table && m_generation != m_table->generation()) resolve();
+		return m_data;
+	}
+	bool is_assigned() { return get() != NULL; }
+
+	var_data *assign( const var_data &value );
+	var_data &value();
+	int as_integer();
+	bool as_boolean();
+	ssc_number_t as_number();
+	double as_double();
+	ssc_number_t *as_array( size_t *count );
+
+private:
+	void resolve();
+
+	var_table *m_table;
+	std::string m_name;
+	var_data *m_data;
+	unsigned long m_generation;
+};
+
 class general_error : public std::exception
 {
 public:
@@ -39,6 +39,11 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "Ambient.h"
 #include "definitions.h"
 #include <math.h>
+#include <map>
+#include <thread>
+#include <mutex>
+#include <atomic>
+#include <exception>
 
 #include "../splinter/Core"
 #include "../splinter/LU"
@@ -109,6 +114,18 @@ C_cavity_receiver::C_cavity_receiver(double dni_des /*W/m2*/,
     m_rel_roughness = std::numeric_limits<double>::quiet_NaN();
     m_A_aper = std::numeric_limits<double>::quiet_NaN();
     m_eta_therm_des = std::numeric_limits<double>::quiet_NaN();
+
+    m_n_threads_vf = 1;
+}
+
+void C_cavity_receiver::set_n_threads_view_factors(int n_threads)
+{
+    m_n_threads_vf = std::max(0, n_threads);
+}
+
+const util::matrix_t<double>& C_cavity_receiver::get_view_factors() const
+{
+    return m_F;
 }
 
 void C_cavity_receiver::genOctCavity()
@@ -925,54 +942,142 @@ void C_cavity_receiver::VFMatrix()
         nElems += m_v_elems[i].nrows();
     }
 
+    // View factors only depend on the mesh, so check if this geometry has already been solved
+    std::vector<double> geom_key;
+    geom_key.reserve(2 * n_surfs + m_nodesGlobal.ncells() + 4 * nElems);
+    geom_key.push_back((double)n_surfs);
+    for (size_t i = 0; i < n_surfs; i++) {
+        geom_key.push_back(std::isfinite(mv_rec_surfs[i].vertices(0, 0)) ? 1.0 : 0.0);
+        geom_key.push_back((double)m_v_elems[i].ncols());
+        for (size_t j = 0; j < m_v_elems[i].ncells(); j++) {
+            geom_key.push_back((double)m_v_elems[i].data()[j]);
+        }
+    }
+    for (size_t j = 0; j < m_nodesGlobal.ncells(); j++) {
+        geom_key.push_back(m_nodesGlobal.data()[j]);
+    }
+
+    if (cavity_receiver_helpers::get_cached_view_factors(geom_key, m_F)) {
+        return;
+    }
+
     m_F.resize_fill(nElems, nElems, 0.0);
 
-    int iLast = 0; // last used row index in F matrix
+    // Each task is one element 'i' on surface 'g' that sees every element on surfaces 'h' > 'g'
+    // Tasks write disjoint entries in F (row and, via reciprocity, column of element 'i')
+    struct S_vf_task
+    {
+        size_t g_surf;
+        size_t i_gElems;
+        int iLast;
+        int jLast;
+    };
+    std::vector<S_vf_task> v_tasks;
 
-    util::matrix_t<double> ELEM_I;
-    util::matrix_t<double> ELEM_J;
+    int iLast = 0; // last used row index in F matrix
 
     for (size_t g_surf = 0; g_surf < n_surfs - 1; g_surf++) {   // loop though surfaces
         if (std::isfinite(mv_rec_surfs[g_surf].vertices(0, 0))) {   // check for empty
             int gElems = m_v_elems[g_surf].nrows();
-            int gType = m_v_elems[g_surf].ncols();
 
             int jLast = iLast + gElems; // last used column index in F matrix
-            for (size_t h_surf = g_surf + 1; h_surf < n_surfs; h_surf++) {
-                if (std::isfinite(mv_rec_surfs[h_surf].vertices(0, 0))) {   // check for empty
-                    int hElems = m_v_elems[h_surf].nrows();
-                    int hType = m_v_elems[h_surf].ncols();
-
-                    ELEM_I.resize_fill(gType, 3, std::numeric_limits<double>::quiet_NaN());
-                    for (size_t i_gElems = 0; i_gElems < gElems; i_gElems++) {
-                        
-                        for (size_t i = 0; i < gType; i++) {
-                            for (size_t j = 0; j < 3; j++) {
-                                ELEM_I(i,j) = m_nodesGlobal(m_v_elems[g_surf](i_gElems,i),j);
-                            }
-                        }
+            for (size_t i_gElems = 0; i_gElems < gElems; i_gElems++) {
+                S_vf_task task;
+                task.g_surf = g_surf;
+                task.i_gElems = i_gElems;
+                task.iLast = iLast;
+                task.jLast = jLast;
+                v_tasks.push_back(task);
+            }
 
-                        ELEM_J.resize_fill(hType, 3, std::numeric_limits<double>::quiet_NaN());
-                        for (size_t j_hElems = 0; j_hElems < hElems; j_hElems++) {
-                            for (size_t i = 0; i < hType; i++) {
-                                for (size_t j = 0; j < 3; j++) {
-                                    ELEM_J(i,j) = m_nodesGlobal(m_v_elems[h_surf](j_hElems,i),j);
-                                }
-                            }
-                            // calculate and assign view factors to F matrix
-                            // use reciprocity
-                            viewFactor(ELEM_I, ELEM_J, m_F(iLast+i_gElems,jLast+j_hElems), m_F(jLast+j_hElems,iLast+i_gElems));
+            iLast = iLast + gElems; // increment last used row index by the number of elements in the last set 'g'
+        }
+    }
+
+    auto solve_task = [&](const S_vf_task& task)
+    {
+        size_t g_surf = task.g_surf;
+        size_t i_gElems = task.i_gElems;
+        int gType = m_v_elems[g_surf].ncols();
+
+        util::matrix_t<double> ELEM_I(gType, 3, std::numeric_limits<double>::quiet_NaN());
+        for (size_t i = 0; i < gType; i++) {
+            for (size_t j = 0; j < 3; j++) {
+                ELEM_I(i, j) = m_nodesGlobal(m_v_elems[g_surf](i_gElems, i), j);
+            }
+        }
+
+        util::matrix_t<double> ELEM_J;
+        int jLast = task.jLast;
+        for (size_t h_surf = g_surf + 1; h_surf < n_surfs; h_surf++) {
+            if (std::isfinite(mv_rec_surfs[h_surf].vertices(0, 0))) {   // check for empty
+                int hElems = m_v_elems[h_surf].nrows();
+                int hType = m_v_elems[h_surf].ncols();
+
+                ELEM_J.resize_fill(hType, 3, std::numeric_limits<double>::quiet_NaN());
+                for (size_t j_hElems = 0; j_hElems < hElems; j_hElems++) {
+                    for (size_t i = 0; i < hType; i++) {
+                        for (size_t j = 0; j < 3; j++) {
+                            ELEM_J(i, j) = m_nodesGlobal(m_v_elems[h_surf](j_hElems, i), j);
                         }
                     }
+                    // calculate and assign view factors to F matrix
+                    // use reciprocity
+                    viewFactor(ELEM_I, ELEM_J, m_F(task.iLast + i_gElems, jLast + j_hElems), m_F(jLast + j_hElems, task.iLast + i_gElems));
+                }
+
+                jLast = jLast + hElems; // increment last used column index by the number of elements in the last set 'h'
+            }
+        }
+    };
 
-                    jLast = jLast + hElems; // increment last used column index by the number of elements in the last set 'h'
+    size_t n_threads = m_n_threads_vf > 0 ? (size_t)m_n_threads_vf : (size_t)std::max(1u, std::thread::hardware_concurrency());
+    n_threads = std::min(n_threads, v_tasks.size());
+
+    if (n_threads <= 1) {
+        for (size_t i = 0; i < v_tasks.size(); i++) {
+            solve_task(v_tasks[i]);
+        }
+    }
+    else {
+        std::atomic<size_t> i_next_task(0);
+        std::atomic<bool> is_abort(false);
+        std::exception_ptr p_exception = nullptr;
+        std::mutex mtx_exception;
+
+        auto run_tasks = [&]()
+        {
+            size_t i_task;
+            while (!is_abort && (i_task = i_next_task++) < v_tasks.size()) {
+                try {
+                    solve_task(v_tasks[i_task]);
+                }
+                catch (...) {
+                    std::lock_guard<std::mutex> lock(mtx_exception);
+                    if (!p_exception) {
+                        p_exception = std::current_exception();
+                    }
+                    is_abort = true;
                 }
             }
+        };
 
-            iLast = iLast + gElems; // increment last used row index by the number of elements in the last set 'g'
+        std::vector<std::thread> v_threads;
+        for (size_t i = 1; i < n_threads; i++) {
+            v_threads.push_back(std::thread(run_tasks));
+        }
+        run_tasks();
+        for (size_t i = 0; i < v_threads.size(); i++) {
+            v_threads[i].join();
+        }
+
+        if (p_exception) {
+            std::rethrow_exception(p_exception);
         }
     }
 
+    cavity_receiver_helpers::set_cached_view_factors(geom_key, m_F);
+
     return;
 }
 
@@ -2804,6 +2909,20 @@ void C_cavity_receiver::init()
     matrixt_to_eigen(m_epsilonTherm, mE_epsilonTherm);
     matrixt_to_eigen(m_areas, mE_areas);
 
+    // Terms of the steady state energy balance that only depend on geometry and emissivity
+    //   are calculated and factorized once here
+    mE_FHatS_epsSol = mE_FHatS * mE_epsilonSol;
+
+    Eigen::MatrixXd E_A_rad = Eigen::MatrixXd::Zero(m_nElems - 1, m_nElems - 1);
+    Eigen::MatrixXd E_FHatT_epsT = mE_FHatT.block(0, 0, m_nElems - 1, m_nElems) * mE_epsilonTherm;
+    for (size_t i = 0; i < m_nElems - 1; i++) {
+        for (size_t j = 0; j < m_nElems - 1; j++) {
+            E_A_rad(i, j) = -1.0 * mE_epsilonTherm(j, 0) * mE_FHatT(i, j);
+        }
+        E_A_rad(i, i) += E_FHatT_epsT(i, 0);
+    }
+    mE_rad_balance_QR.compute(E_A_rad);
+
     // ********************************************
     // ********************************************
 
@@ -3223,18 +3342,11 @@ void C_cavity_receiver::steady_state_sln(double T_salt_cold_in /*K*/, double q_d
 
     Eigen::MatrixXd EqIn = mE_areas.array() * EsolarFlux.array();
 
-    Eigen::MatrixXd eq1 = (-EsolarFlux.array() * mE_areas.array() * mE_rhoSol.array());
-    Eigen::MatrixXd eq2(eq1.rows(), eq1.rows());
-    Eigen::MatrixXd epsS_square(eq1.rows(), eq1.rows());
-    for (size_t i = 0; i < eq2.rows(); i++) {
-        for (size_t j = 0; j < eq2.cols(); j++) {
-            eq2(i, j) = eq1(i, 0);
-            epsS_square(i, j) = mE_epsilonSol(i, 0);
-        }
-    }
-    Eigen::MatrixXd eq3 = (eq2.array() * mE_FHatS.array()).matrix() * mE_epsilonSol;
+    // Reflected solar exchange terms (FHatS * epsSol is constant and calculated in init())
+    Eigen::MatrixXd E_q_refl = EsolarFlux.array() * mE_areas.array() * mE_rhoSol.array();
+    Eigen::MatrixXd eq3 = -1.0 * (E_q_refl.array() * mE_FHatS_epsSol.array()).matrix();
 
-    Eigen::MatrixXd eq4 = (epsS_square.array() * mE_FHatS.transpose().array()).matrix() * (EsolarFlux.array() * mE_areas.array() * mE_rhoSol.array()).matrix();
+    Eigen::MatrixXd eq4 = (mE_epsilonSol.array() * (mE_FHatS.transpose() * E_q_refl).array()).matrix();
 
     Eigen::MatrixXd EqSolOut = eq3 + eq4;
 
@@ -3246,27 +3358,8 @@ void C_cavity_receiver::steady_state_sln(double T_salt_cold_in /*K*/, double q_d
 
     Eigen::MatrixXd E_eye = Eigen::MatrixXd::Identity(m_nElems - 1, m_nElems - 1);
 
-    Eigen::MatrixXd E_epsT_trans = mE_epsilonTherm.transpose();
-    E_epsT_trans.conservativeResize(m_nElems - 1, m_nElems - 1);
-    for (size_t i = 0; i < m_nElems - 1; i++) {
-        for (size_t j = 0; j < m_nElems - 1; j++) {
-            E_epsT_trans(i, j) = E_epsT_trans(0, j);
-        }
-    }
-
-    Eigen::MatrixXd E_A_1 = -1.0 * E_epsT_trans.array() * mE_FHatT.block(0, 0, m_nElems - 1, m_nElems - 1).array();
-
-    Eigen::MatrixXd E_A_2 = mE_FHatT.block(0, 0, m_nElems - 1, m_nElems) * mE_epsilonTherm;
-    Eigen::MatrixXd E_A_2_square(E_A_2.rows(), E_A_2.rows());
-    for (size_t i = 0; i < E_A_2_square.rows(); i++) {
-        for (size_t j = 0; j < E_A_2_square.rows(); j++) {
-            E_A_2_square(i, j) = E_A_2(i, 0);
-        }
-    }
-    Eigen::MatrixXd E_A_3 = E_A_2_square.array() * E_eye.array();
-    Eigen::MatrixXd E_A = E_A_1 + E_A_3;
-
-    Eigen::MatrixXd E_Tmax1 = E_A.colPivHouseholderQr().solve(E_b);
+    // Radiation-only balance matrix is constant and was factorized in init()
+    Eigen::MatrixXd E_Tmax1 = mE_rad_balance_QR.solve(E_b);
     Eigen::MatrixXd E_Tmax = Eigen::pow(E_Tmax1.array(), 0.25);
 
     E_Tmax.conservativeResize(m_nElems, 1);
@@ -3594,6 +3687,65 @@ double cavity_receiver_helpers::calc_total_receiver_absorber_area(double rec_hei
     return rec_area;
 }
 
+namespace
+{
+    // Process-wide view factor cache, keyed on a hash of the meshed geometry
+    struct S_view_factor_cache_entry
+    {
+        std::vector<double> geom_key;
+        util::matrix_t<double> F;
+    };
+
+    const size_t view_factor_cache_max_entries = 8;
+    std::map<size_t, S_view_factor_cache_entry> view_factor_cache;
+    std::mutex view_factor_cache_mtx;
+
+    size_t geometry_hash(const std::vector<double>& geom_key)
+    {
+        // FNV-1a over the raw bytes of the geometry description
+        uint64_t hash = 14695981039346656037ULL;
+        const unsigned char* bytes = reinterpret_cast<const unsigned char*>(geom_key.data());
+        for (size_t i = 0; i < geom_key.size() * sizeof(double); i++) {
+            hash ^= bytes[i];
+            hash *= 1099511628211ULL;
+        }
+        return (size_t)hash;
+    }
+}
+
+bool cavity_receiver_helpers::get_cached_view_factors(const std::vector<double>& geom_key, util::matrix_t<double>& F)
+{
+    std::lock_guard<std::mutex> lock(view_factor_cache_mtx);
+
+    std::map<size_t, S_view_factor_cache_entry>::const_iterator it = view_factor_cache.find(geometry_hash(geom_key));
+    if (it == view_factor_cache.end() || it->second.geom_key != geom_key) {
+        return false;
+    }
+
+    F = it->second.F;
+    return true;
+}
+
+void cavity_receiver_helpers::set_cached_view_factors(const std::vector<double>& geom_key, const util::matrix_t<double>& F)
+{
+    std::lock_guard<std::mutex> lock(view_factor_cache_mtx);
+
+    if (view_factor_cache.size() >= view_factor_cache_max_entries) {
+        view_factor_cache.clear();
+    }
+
+    S_view_factor_cache_entry& entry = view_factor_cache[geometry_hash(geom_key)];
+    entry.geom_key = geom_key;
+    entry.F = F;
+}
+
+void cavity_receiver_helpers::clear_cached_view_factors()
+{
+    std::lock_guard<std::mutex> lock(view_factor_cache_mtx);
+
+    view_factor_cache.clear();
+}
+
 void cavity_receiver_helpers::test_cavity_case() {
 
     double dni_des = 950;           //[W/m2]
@@ -147,6 +147,9 @@ private:
     Eigen::MatrixXd mE_rhoSol;                  // global element solar reflectivity
     Eigen::MatrixXd mE_rhoTherm;                // global element thermal reflectivity
 
+    Eigen::MatrixXd mE_FHatS_epsSol;            // FHat solar times global element solar emissivity
+    Eigen::ColPivHouseholderQR<Eigen::MatrixXd> mE_rad_balance_QR;  // factorized radiation-only energy balance (excludes aperture)
+
     double m_d_in_rec_tube;             //[m]
     double m_A_cs_tube;                 //[m2]
     size_t m_Ntubes;                    //[-]
@@ -154,6 +157,8 @@ private:
     double m_A_aper;                    //[m2]
     double m_eta_therm_des;             //[-]
 
+    int m_n_threads_vf;                 //[-] Threads for the view factor calculation, 0 = all available cores
+
     // ************************************
     // Call variables
     double m_od_control;            //[-]
@@ -193,6 +198,11 @@ public:
 
 	virtual double area_proj();
 
+    // Number of threads used for the view factors in init(), 0 = use all available cores
+    void set_n_threads_view_factors(int n_threads);
+
+    const util::matrix_t<double>& get_view_factors() const;
+
     void steady_state_sln(double T_salt_cold_in /*K*/, double q_dot_inc /*Wt*/, double cp_htf /*J/kg-K*/,
         double T_amb /*K*/,
         const Eigen::MatrixXd& EsolarFlux /*W/m2*/,
@@ -356,6 +366,14 @@ namespace cavity_receiver_helpers
     double calc_total_receiver_absorber_area(double rec_height /*m*/, double rec_width /*m*/,
         double rec_span /*rad*/, size_t nPanels /*-*/);
 
+    // View factors are expensive and depend only on the meshed geometry,
+    //  so they are cached across receiver instances keyed on the geometry
+    bool get_cached_view_factors(const std::vector<double>& geom_key, util::matrix_t<double>& F);
+
+    void set_cached_view_factors(const std::vector<double>& geom_key, const util::matrix_t<double>& F);
+
+    void clear_cached_view_factors();
+
     void test_cavity_case();
 };
 
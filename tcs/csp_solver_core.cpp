@@ -601,6 +601,9 @@ void C_csp_solver::Ssimulate(C_csp_solver::S_sim_setup & sim_setup)
 
     C_system_operating_modes::E_operating_modes operating_mode = C_system_operating_modes::CR_OFF__PC_OFF__TES_OFF__AUX_OFF;
 
+    mc_op_mode_predictor.reset();
+    ms_op_mode_stats = S_op_mode_stats();
+
 	while( mc_kernel.mc_sim_info.ms_ts.m_time <= mc_kernel.get_sim_setup()->m_sim_time_end )
 	{
 		// Report simulation progress
@@ -904,6 +907,10 @@ void C_csp_solver::Ssimulate(C_csp_solver::S_sim_setup & sim_setup)
 
 		}
 
+        C_system_operating_modes::E_operating_modes operating_mode_previous = operating_mode;
+        int op_mode_context_key = -1;
+        bool is_rec_su_allowed_pre_prediction = is_rec_su_allowed;
+
 		while(!are_models_converged)		// Solve for correct operating mode and performance in following loop:
 		{
 			// Reset timestep info for iterations on the operating mode...
@@ -925,8 +932,28 @@ void C_csp_solver::Ssimulate(C_csp_solver::S_sim_setup & sim_setup)
                 is_rec_outlet_to_hottank, is_pc_sb_allowed,
                 q_dot_PAR_HTR_on, is_PAR_HTR_allowed);
 
+            // On the first pass, try the mode that has converged in this context before the hierarchy's choice
+            bool is_predicted_mode = false;
+            if (ms_system_params.m_is_op_mode_prediction && m_op_mode_tracking.size() == 0) {
+                op_mode_context_key = mc_op_mode_predictor.context_key(operating_mode, operating_mode_previous,
+                    q_dot_tes_dc, q_dot_tes_ch, is_rec_su_allowed, is_pc_su_allowed);
+
+                C_system_operating_modes::E_operating_modes operating_mode_predicted =
+                    mc_op_mode_predictor.predict(op_mode_context_key, operating_mode);
+
+                if (operating_mode_predicted != C_system_operating_modes::ITER_START &&
+                    operating_mode_predicted != operating_mode &&
+                    mc_operating_modes.is_mode_avail(operating_mode_predicted)) {
+
+                    operating_mode = operating_mode_predicted;
+                    is_predicted_mode = true;
+                    ms_op_mode_stats.m_n_predictions++;
+                }
+            }
+
 			// Store operating mode
 			m_op_mode_tracking.push_back((int)operating_mode);
+            ms_op_mode_stats.m_n_mode_solves++;
 
             double t_ts_initial = mc_kernel.mc_sim_info.ms_ts.m_step;   //[s]
             double defocus_solved = std::numeric_limits<double>::quiet_NaN();
@@ -947,13 +974,27 @@ void C_csp_solver::Ssimulate(C_csp_solver::S_sim_setup & sim_setup)
 
             if (!are_models_converged) {
                 reset_time(t_ts_initial);
-                if (is_turn_off_plant) {
+                if (is_predicted_mode) {
+                    // Discard everything the failed prediction learned so the hierarchy proceeds as if it wasn't tried
+                    mc_operating_modes.reset_all_availability();
+                    is_rec_su_allowed = is_rec_su_allowed_pre_prediction;
+                }
+                else if (is_turn_off_plant) {
                     mc_operating_modes.turn_off_plant();
                 }
             }
+            else if (is_predicted_mode) {
+                ms_op_mode_stats.m_n_predictions_converged++;
+            }
             m_defocus = defocus_solved;
 		
-		}	        
+		}
+
+        ms_op_mode_stats.m_n_timesteps++;
+        if (ms_system_params.m_is_op_mode_prediction) {
+            mc_op_mode_predictor.record(op_mode_context_key, operating_mode);
+        }
+        
         /* 
         ------------ End loop to find correct operating mode and system performance --------
         */
@@ -3060,6 +3101,66 @@ bool C_csp_solver::C_system_operating_modes::solve(C_system_operating_modes::E_o
         defocus_solved, is_op_mode_avail, is_turn_off_plant, is_turn_off_rec_su);
 }
 
+int C_csp_solver::C_op_mode_predictor::context_key(C_system_operating_modes::E_operating_modes first_choice,
+    C_system_operating_modes::E_operating_modes previous_mode,
+    double q_dot_tes_dc /*MWt*/, double q_dot_tes_ch /*MWt*/,
+    bool is_rec_su_allowed, bool is_pc_su_allowed)
+{
+    // TES state: 0 = empty, 1 = full, 2 = can charge and discharge
+    int tes_state = 2;
+    if (q_dot_tes_dc <= 0.0) {
+        tes_state = 0;
+    }
+    else if (q_dot_tes_ch <= 0.0) {
+        tes_state = 1;
+    }
+
+    int n_modes = (int)C_system_operating_modes::ITER_END;
+    int key = (int)first_choice * n_modes + (int)previous_mode;
+    key = key * 3 + tes_state;
+    key = key * 2 + (is_rec_su_allowed ? 1 : 0);
+    key = key * 2 + (is_pc_su_allowed ? 1 : 0);
+
+    return key;
+}
+
+C_csp_solver::C_system_operating_modes::E_operating_modes C_csp_solver::C_op_mode_predictor::predict(int key,
+    C_system_operating_modes::E_operating_modes first_choice)
+{
+    std::unordered_map<int, std::vector<int>>::iterator it = m_converged_counts.find(key);
+    if (it == m_converged_counts.end()) {
+        return C_system_operating_modes::ITER_START;
+    }
+
+    const std::vector<int>& counts = it->second;
+
+    // Only skip the hierarchy's first choice if it has never converged in this context
+    if (counts[first_choice] > 0) {
+        return C_system_operating_modes::ITER_START;
+    }
+
+    int n_obs = std::accumulate(counts.begin(), counts.end(), 0);
+    if (n_obs < m_n_obs_min) {
+        return C_system_operating_modes::ITER_START;
+    }
+
+    int i_max = (int)(std::max_element(counts.begin(), counts.end()) - counts.begin());
+    if (counts[i_max] < m_f_converged_min * n_obs) {
+        return C_system_operating_modes::ITER_START;
+    }
+
+    return static_cast<C_system_operating_modes::E_operating_modes>(i_max);
+}
+
+void C_csp_solver::C_op_mode_predictor::record(int key, C_system_operating_modes::E_operating_modes converged_mode)
+{
+    std::vector<int>& counts = m_converged_counts[key];
+    if (counts.size() == 0) {
+        counts.resize(C_system_operating_modes::ITER_END, 0);
+    }
+    counts[converged_mode]++;
+}
+
 void C_csp_solver::C_system_operating_modes::reset_all_availability()
 {
     for (int it = ITER_START + 1; it != E_operating_modes::ITER_END; it++) {
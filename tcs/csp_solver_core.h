@@ -952,6 +952,10 @@ public:
         //   calculate T_htf_hot_tank_in_min = f*T_hot_des + (1-f)*T_cold_des
         double f_htf_hot_des__T_htf_hot_tank_in_min;   //[-]
 
+        // True: try the operating mode that historically converged in the current controller context
+        //   before the mode hierarchy's first choice. A failed prediction falls back to the full hierarchy
+        bool m_is_op_mode_prediction;
+
 		S_csp_system_params()
 		{
 			m_pb_fixed_par =
@@ -963,9 +967,24 @@ public:
             m_is_rec_to_coldtank_allowed = false;
 
             m_is_field_freeze_protection_electric = true;
+
+            m_is_op_mode_prediction = false;
 		}
 	};
 
+    struct S_op_mode_stats
+    {
+        int m_n_timesteps;          //[-] Controller timesteps solved
+        int m_n_mode_solves;        //[-] Operating mode solves, including failed attempts
+        int m_n_predictions;        //[-] Timesteps that tried a predicted mode first
+        int m_n_predictions_converged;  //[-] Predicted modes that converged
+
+        S_op_mode_stats()
+        {
+            m_n_timesteps = m_n_mode_solves = m_n_predictions = m_n_predictions_converged = 0;
+        }
+    };
+
 private:
 	C_csp_weatherreader &mc_weather;
 	C_csp_collector_receiver &mc_collector_receiver;
@@ -1109,6 +1128,11 @@ public:
 
 	void Ssimulate(C_csp_solver::S_sim_setup & sim_setup);
 
+    S_op_mode_stats get_op_mode_stats()
+    {
+        return ms_op_mode_stats;
+    }
+
 	int steps_per_hour();
 
     void reset_time(double step /*s*/);
@@ -2246,6 +2270,44 @@ public:
 
     C_system_operating_modes mc_operating_modes;
 
+    // Counts the converged operating mode for each controller context, keyed on the hierarchy's first
+    // choice, the previous timestep's mode, TES state, and receiver/cycle startup availability
+    class C_op_mode_predictor
+    {
+    private:
+        std::unordered_map<int, std::vector<int>> m_converged_counts;
+
+        int m_n_obs_min;            //[-] Observations of a context required before predicting
+        double m_f_converged_min;   //[-] Fraction of observations the predicted mode must have converged
+
+    public:
+
+        C_op_mode_predictor()
+        {
+            m_n_obs_min = 5;
+            m_f_converged_min = 0.9;
+        }
+
+        void reset()
+        {
+            m_converged_counts.clear();
+        }
+
+        int context_key(C_system_operating_modes::E_operating_modes first_choice,
+            C_system_operating_modes::E_operating_modes previous_mode,
+            double q_dot_tes_dc /*MWt*/, double q_dot_tes_ch /*MWt*/,
+            bool is_rec_su_allowed, bool is_pc_su_allowed);
+
+        // Returns ITER_START if there is no prediction
+        C_system_operating_modes::E_operating_modes predict(int key, C_system_operating_modes::E_operating_modes first_choice);
+
+        void record(int key, C_system_operating_modes::E_operating_modes converged_mode);
+    };
+
+    C_op_mode_predictor mc_op_mode_predictor;
+
+    S_op_mode_stats ms_op_mode_stats;
+
 };
 
 
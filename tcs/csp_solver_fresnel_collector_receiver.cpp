@@ -1428,6 +1428,7 @@ C_csp_fresnel_collector_receiver::C_csp_fresnel_collector_receiver()
 
     m_T_fp = std::numeric_limits<double>::quiet_NaN();
     m_I_bn_des = std::numeric_limits<double>::quiet_NaN();
+    m_use_hl_surrogate = false;
     m_V_hdr_max = std::numeric_limits<double>::quiet_NaN();
     m_V_hdr_min = std::numeric_limits<double>::quiet_NaN();
     m_Pipe_hl_coef = std::numeric_limits<double>::quiet_NaN();
@@ -1740,6 +1741,18 @@ void C_csp_fresnel_collector_receiver::init(const C_csp_collector_receiver::S_cs
         m_evac_receiver = std::unique_ptr<EvacReceiverModel>(new EvacReceiverModel(m_D_abs_in, m_D_abs_out, m_D_glass_in, m_D_glass_out, m_D_plug, m_L_mod, m_GlazingIntact,
             m_Shadowing, m_dirt_env, m_P_a, m_alpha_abs, m_epsilon_glass, m_Tau_envelope, m_alpha_env, &m_epsilon_abs,
             m_htfProps, m_airProps, m_AnnulusGasMat, m_AbsorberPropMat, m_Flow_type, m_A_cs, m_D_h));
+
+        if (m_use_hl_surrogate)
+        {
+            double max_abs_err, max_rel_err;
+            m_evac_receiver->Build_Heat_Loss_Surrogates(m_HCE_FieldFrac, min(m_T_fp, m_T_loop_in_des) - 25.0, m_T_loop_out_des + 75.0,
+                1100.0 * m_A_aperture / m_L_mod, m_m_dot_htfmin, m_m_dot_htfmax, 101325.0 * pow(1 - 2.25577E-5 * init_inputs.m_elev, 5.25588),
+                max_abs_err, max_rel_err);
+
+            m_error_msg = util::format("Receiver heat loss tables built. The maximum heat loss error at the validation points is %.2f W/m (%.2f%% of the largest tabulated heat loss). "
+                "Conditions outside the tables use the detailed receiver model.", max_abs_err, 100.0 * max_rel_err);
+            mc_csp_messages.add_message(C_csp_messages::NOTICE, m_error_msg);
+        }
     }
 
     // Run steady state 
@@ -3503,7 +3516,7 @@ int C_csp_fresnel_collector_receiver::C_mono_eq_freeze_prot_E_bal::operator()(do
 /// <param name="D_h">Hydraulic diameter</param>
 EvacReceiverModel::EvacReceiverModel(vector<double> D_abs_in, vector<double> D_abs_out, vector<double> D_glass_in, vector<double> D_glass_out, vector<double> D_plug,
     double L_mod, vector<bool> GlazingIntact, vector<double> Shadowing, vector<double> dirt_env, vector<double> P_a, vector<double> alpha_abs,
-    vector<double> epsilon_glass, vector<double> Tau_envelope, vector<double> alpha_env, emit_table* epsilon_abs, HTFProperties htfProps, HTFProperties airProps,
+    vector<double> epsilon_glass, vector<double> Tau_envelope, vector<double> alpha_env, emit_table* epsilon_abs, const HTFProperties& htfProps, const HTFProperties& airProps,
     util::matrix_t<HTFProperties*> AnnulusGasMat, util::matrix_t<AbsorberProps*> AbsorberPropMat, vector<double> Flow_type, vector<double> A_cs, vector<double> D_h)
     :
     m_D_abs_in(D_abs_in), m_D_abs_out(D_abs_out), m_D_glass_in(D_glass_in), m_D_glass_out(D_glass_out), m_D_plug(D_plug),
@@ -3537,7 +3550,78 @@ EvacReceiverModel::EvacReceiverModel(vector<double> D_abs_in, vector<double> D_a
 /// <param name="v_reguess_args"></param>
 /// <param name="q_3reflect">Absorber reflective losses</param>
 void EvacReceiverModel::Calculate_Energy_Balance(double T_1_in, double m_dot, double T_amb, double T_sky, double v_6, double P_6, double q_i,
-    int hv /* HCE variant [0..3] */, int sca_num, bool single_point, double time, util::matrix_t<double> ColOptEff,
+    int hv /* HCE variant [0..3] */, int sca_num, bool single_point, double time, const util::matrix_t<double>& ColOptEff,
+    //outputs
+    double& q_heatloss, double& q_12conv, double& q_34tot, double& c_1ave, double& rho_1ave, std::vector<double>& v_reguess_args, double& q_3reflect)
+{
+    double colopteff_tot = ColOptEff.at(sca_num) * m_dirt_env[hv] * m_Shadowing[hv];	//The total optical efficiency
+    double q_opt = q_i * colopteff_tot;     //[W/m] Incident flux after optical losses
+
+    if (!single_point && hv < (int)mv_hl_surrogate.size() && mv_hl_surrogate[hv].is_built())
+    {
+        double q_3SolAbs;
+        if (m_GlazingIntact.at(hv)) {
+            q_3SolAbs = q_opt * m_Tau_envelope[hv] * m_alpha_abs[hv];  //[W/m]
+            q_3reflect = q_opt * m_Tau_envelope[hv] * (1.0 - m_alpha_abs[hv]); // [W/m]
+        }
+        else {
+            q_3SolAbs = q_opt * m_alpha_abs[hv];  //[W/m]
+            q_3reflect = q_opt * (1.0 - m_alpha_abs[hv]); // [W/m]
+        }
+
+        if (mv_hl_surrogate[hv].energy_balance(T_1_in, m_dot, T_amb, T_sky, v_6, q_opt, q_3SolAbs, m_L_mod, m_htfProps,
+            q_heatloss, q_12conv, q_34tot, c_1ave, rho_1ave))
+            return;
+    }
+
+    Calculate_Energy_Balance_Detailed(T_1_in, m_dot, T_amb, T_sky, v_6, P_6, q_opt, hv, single_point, time,
+        q_heatloss, q_12conv, q_34tot, c_1ave, rho_1ave, v_reguess_args, q_3reflect);
+}
+
+void EvacReceiverModel::Build_Heat_Loss_Surrogates(const vector<double>& HCE_FieldFrac, double T_htf_min /*K*/, double T_htf_max /*K*/, double q_opt_max /*W/m*/,
+    double m_dot_min /*kg/s*/, double m_dot_max /*kg/s*/, double P_amb /*Pa*/,
+    //outputs
+    double& max_abs_err /*W/m*/, double& max_rel_err /*-*/)
+{
+    // Tables are built at the site pressure
+    std::vector<double> axes[C_hce_heat_loss_surrogate::N_AXES];
+    C_hce_heat_loss_surrogate::default_axes(T_htf_min, T_htf_max, q_opt_max, m_dot_min, m_dot_max, axes);
+
+    std::vector<double> reguess_args(3, std::numeric_limits<double>::quiet_NaN());
+
+    // Build into a local copy so that the detailed model is used for every table point
+    vector<C_hce_heat_loss_surrogate> hl_surrogate(m_dirt_env.size());
+    max_abs_err = max_rel_err = 0.0;
+    for (int hv = 0; hv < (int)hl_surrogate.size() && hv < (int)HCE_FieldFrac.size(); hv++)
+    {
+        if (HCE_FieldFrac[hv] == 0.0)
+            continue;
+
+        hl_surrogate[hv].build(axes,
+            [&](const double* x, double* y)
+            {
+                double q_heatloss, q_12conv, q_34tot, c_1ave, rho_1ave, q_3reflect;
+                double q_opt = x[C_hce_heat_loss_surrogate::E_Q_OPT];
+                double T_sky = x[C_hce_heat_loss_surrogate::E_T_AMB] - x[C_hce_heat_loss_surrogate::E_DT_SKY];
+                Calculate_Energy_Balance_Detailed(x[C_hce_heat_loss_surrogate::E_T_HTF], x[C_hce_heat_loss_surrogate::E_M_DOT], x[C_hce_heat_loss_surrogate::E_T_AMB], T_sky,
+                    x[C_hce_heat_loss_surrogate::E_V_WIND], P_amb, q_opt, hv, true, 0.0,
+                    q_heatloss, q_12conv, q_34tot, c_1ave, rho_1ave, reguess_args, q_3reflect);
+
+                double q_3SolAbs = q_opt * (m_GlazingIntact.at(hv) ? m_Tau_envelope[hv] : 1.0) * m_alpha_abs[hv];
+                y[C_hce_heat_loss_surrogate::E_Q_HEATLOSS] = q_heatloss;
+                y[C_hce_heat_loss_surrogate::E_Q_34TOT] = q_34tot;
+                y[C_hce_heat_loss_surrogate::E_Q_ABS_LOSS] = q_3SolAbs - q_12conv;
+            });
+
+        max_abs_err = max(max_abs_err, hl_surrogate[hv].get_max_abs_error());
+        max_rel_err = max(max_rel_err, hl_surrogate[hv].get_max_rel_error());
+    }
+
+    mv_hl_surrogate.swap(hl_surrogate);
+}
+
+void EvacReceiverModel::Calculate_Energy_Balance_Detailed(double T_1_in, double m_dot, double T_amb, double T_sky, double v_6, double P_6, double q_opt /*W/m*/,
+    int hv /* HCE variant [0..3] */, bool single_point, double time,
     //outputs
     double& q_heatloss, double& q_12conv, double& q_34tot, double& c_1ave, double& rho_1ave, std::vector<double>& v_reguess_args, double& q_3reflect)
 {
@@ -3553,7 +3637,7 @@ void EvacReceiverModel::Calculate_Energy_Balance(double T_1_in, double m_dot, do
     bool UPFLAG, LOWFLAG, T3upflag, T3lowflag, is_e_table;
     int qq, q5_iter, T1_iter, q_conv_iter;
 
-    double T_save_tot, colopteff_tot;
+    double T_save_tot;
     //cc--> note that xx and yy have size 'nea'
 
     //---Re-guess criteria:---
@@ -3647,24 +3731,22 @@ lab_keep_guess:
     k_45 = 1.04;                             //[W/m-K]  Conductivity of glass
     R_45cond = log(m_D_glass_out[hv] / m_D_glass_in[hv]) / (2. * pi * k_45);    //[K-m/W]Equation of thermal resistance for conduction through a cylinder
 
-    colopteff_tot = ColOptEff.at(sca_num) * m_dirt_env[hv] * m_Shadowing[hv];	//The total optical efficiency
-
     if (m_GlazingIntact.at(hv)) {   //These calculations (q_3SolAbs,q_5solAbs) are not dependent on temperature, so only need to be computed once per call to subroutine
 
-        q_3SolAbs = q_i * colopteff_tot * m_Tau_envelope[hv] * m_alpha_abs[hv];  //[W/m]  
+        q_3SolAbs = q_opt * m_Tau_envelope[hv] * m_alpha_abs[hv];  //[W/m]  
         //We must account for the radiation absorbed as it passes through the envelope
-        q_5solabs = q_i * colopteff_tot * m_alpha_env[hv];   //[W/m]
+        q_5solabs = q_opt * m_alpha_env[hv];   //[W/m]
 
-        q_3reflect = q_i * colopteff_tot * m_Tau_envelope[hv] * (1.0 - m_alpha_abs[hv]); // [W/m]
+        q_3reflect = q_opt * m_Tau_envelope[hv] * (1.0 - m_alpha_abs[hv]); // [W/m]
     }
     else {
         //Calculate the absorbed energy 
-        q_3SolAbs = q_i * colopteff_tot * m_alpha_abs[hv];  //[W/m]  
+        q_3SolAbs = q_opt * m_alpha_abs[hv];  //[W/m]  
         //No envelope
         q_5solabs = 0.0;                            //[W/m]
 
 
-        q_3reflect = q_i * colopteff_tot * (1.0 - m_alpha_abs[hv]); // [W/m]
+        q_3reflect = q_opt * (1.0 - m_alpha_abs[hv]); // [W/m]
     }
 
     is_e_table = false;
@@ -80,6 +80,8 @@ private:
     const vector<double> m_A_cs;	                            //[m^2] Cross-sectional area for HTF flow for each receiver
     const vector<double> m_D_h;	                                //[m^2] Hydraulic diameters for HTF flow for each receiver and variant (why variant?)	
 
+    vector<C_hce_heat_loss_surrogate> mv_hl_surrogate;         // [-] Heat loss tables for each variant (empty unless built)
+
     // Private Methods
 private:
 
@@ -95,19 +97,30 @@ private:
 
     double FK_23_v2(double T_2, double T_3, int hv);
 
+    void Calculate_Energy_Balance_Detailed(double T_1_in, double m_dot, double T_amb, double T_sky, double v_6, double P_6, double q_opt /*W/m*/,
+        int hv /* HCE variant [0..3] */, bool single_point, double time,
+        //outputs
+        double& q_heatloss, double& q_12conv, double& q_34tot, double& c_1ave, double& rho_1ave, std::vector<double>& v_reguess_args, double& q_3reflect);
+
 public:
 
     EvacReceiverModel(vector<double> D_abs_in, vector<double> D_abs_out, vector<double> D_glass_in, vector<double> D_glass_out, vector<double> D_plug,
         double L_mod, vector<bool> GlazingIntact, vector<double> Shadowing, vector<double> dirt_env, vector<double> P_a, vector<double> alpha_abs,
-        vector<double> epsilon_glass, vector<double> Tau_envelope, vector<double> alpha_env, emit_table* epsilon_abs, HTFProperties htfProps, HTFProperties airProps,
+        vector<double> epsilon_glass, vector<double> Tau_envelope, vector<double> alpha_env, emit_table* epsilon_abs, const HTFProperties& htfProps, const HTFProperties& airProps,
         util::matrix_t<HTFProperties*> AnnulusGasMat, util::matrix_t<AbsorberProps*> AbsorberPropMat, vector<double> Flow_type, vector<double> A_cs, vector<double> D_h);
 
 
     void Calculate_Energy_Balance(double T_1_in, double m_dot, double T_amb, double T_sky, double v_6, double P_6, double q_i,
-        int hv /* HCE variant [0..3] */, int sca_num, bool single_point, double time, util::matrix_t<double> ColOptEff,
+        int hv /* HCE variant [0..3] */, int sca_num, bool single_point, double time, const util::matrix_t<double>& ColOptEff,
         //outputs
         double& q_heatloss, double& q_12conv, double& q_34tot, double& c_1ave, double& rho_1ave, std::vector<double>& v_reguess_args, double& q_3reflect);
 
+    // Tabulate the heat loss of each variant with a nonzero field fraction; Calculate_Energy_Balance then uses the tables where they apply
+    void Build_Heat_Loss_Surrogates(const vector<double>& HCE_FieldFrac, double T_htf_min /*K*/, double T_htf_max /*K*/, double q_opt_max /*W/m*/,
+        double m_dot_min /*kg/s*/, double m_dot_max /*kg/s*/, double P_amb /*Pa*/,
+        //outputs
+        double& max_abs_err /*W/m*/, double& max_rel_err /*-*/);
+
 };
 
 
@@ -434,6 +447,7 @@ public:
     vector<double> m_IAM_L_coefs;		            // Incidence angle modifier coefficients - longitudinal plane
     util::matrix_t<double> m_OpticalTable;          // Values of the optical efficiency table
     int m_rec_model;		                        // Receiver model type (1=Polynomial ; 2=Evac tube)
+    bool m_use_hl_surrogate;                        // [-] Evaluate evacuated receiver heat loss from tables built at init, falling back to the detailed model outside the tables
 
     vector<double> m_HCE_FieldFrac;                 // [-] Fraction of the field occupied by this HCE type
     vector<double> m_D_abs_in;		                // [m] The inner absorber tube diameter (m_D_2)
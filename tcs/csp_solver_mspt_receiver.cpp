@@ -319,6 +319,29 @@ void C_mspt_receiver::initialize_transient_parameters()
 	param_inputs.T_amb = param_inputs.T_sky = param_inputs.c_htf = param_inputs.rho_htf = param_inputs.mu_htf = param_inputs.k_htf = param_inputs.Pr_htf = std::numeric_limits<double>::quiet_NaN();
 	param_inputs.Tfeval.resize_fill(m_n_elem, m_n_lines, 0.0); param_inputs.Tseval.resize_fill(m_n_elem, m_n_lines, 0.0); param_inputs.qinc.resize_fill(m_n_elem, m_n_lines, 0.0);
 	param_inputs.qheattrace.resize_fill(m_n_elem, 0.0);
+
+	// Size transient solution operators and workspaces so that solve_transient_model() does not allocate
+	std::vector<double> elem_zeros(m_n_elem, 0.0);
+	trans_ops.lam1.assign(m_n_lines, elem_zeros); trans_ops.lam2.assign(m_n_lines, elem_zeros);
+	trans_ops.cval.assign(m_n_lines, elem_zeros); trans_ops.aval.assign(m_n_lines, elem_zeros);
+	trans_ops.gam.assign(m_n_lines, elem_zeros); trans_ops.exp_gam_len.assign(m_n_lines, elem_zeros);
+	trans_ops.mult.assign(m_n_lines, util::matrix_t<double>(m_n_elem, m_n_elem, 1.0));
+	trans_ops.sum1.assign(m_n_lines, util::matrix_t<double>(m_n_elem, m_n_elem, 0.0));
+	trans_ops.tinit.assign(m_n_lines, std::vector<double>(m_nz_tot, 0.0));
+	trans_ops.tint.assign(m_n_lines, std::vector<double>(m_nz_tot, 0.0));
+	trans_ops.splines.assign(m_n_lines, util::matrix_t<double>(m_nz_tot, 5, 0.0));
+	trans_ops.Rconv_mflow = trans_ops.Rconv_c_htf = trans_ops.Rconv_mu_htf = trans_ops.Rconv_k_htf = std::numeric_limits<double>::quiet_NaN();
+	trans_ops.Rconv.resize_fill(m_n_elem, m_n_lines, 0.0);
+	trans_ops.h.assign(m_nz_tot, 0.0); trans_ops.mu.assign(m_nz_tot, 0.0); trans_ops.z.assign(m_nz_tot, 0.0); trans_ops.c.assign(m_nz_tot, 0.0);
+	trans_ops.sumAconst.resize_fill(m_n_elem, m_n_elem, 0.0);
+	trans_ops.sumApos.resize_fill(m_n_elem, m_n_elem, 0.0);
+	trans_ops.sumval.resize_fill(m_n_elem, m_n_lines, 0.0);
+	trans_ops.multval.resize_fill(m_n_elem, m_n_lines, 1.0);
+	trans_ops.Tfavg.resize_fill(m_n_elem, m_n_lines, 0.0);
+	trans_ops.Tsavg.resize_fill(m_n_elem, m_n_lines, 0.0);
+	trans_ops.tinit_start.resize_fill(m_nz_tot, m_n_lines, 0.0);
+	trans_ops.textreme_d.resize_fill(2, m_n_lines, 0.0); trans_ops.tpt_d.resize_fill(2, m_n_lines, 0.0);
+	trans_ops.textreme_r.resize_fill(2, m_n_lines, 0.0); trans_ops.tpt_r.resize_fill(2, m_n_lines, 0.0);
 	return; 
 }
 
@@ -1191,56 +1214,111 @@ double C_mspt_receiver::integrate(double xlow, double xhigh, const std::vector<d
 	return inteval;
 }
 
-void C_mspt_receiver::cubic_splines(const std::vector<double> &xarray, const std::vector<double> &yarray, util::matrix_t<double> &splines)
+void C_mspt_receiver::cubic_splines(const std::vector<double> &xarray, const std::vector<double> &yarray, int klow, int khigh, util::matrix_t<double> &splines)
 {
-	// Fit cubic splines to data points in xarray, yarray
-	size_t n = xarray.size()-1;
-	splines.resize_fill(n, 5, 0.0);
-
-	vector<double> a(n + 1, 0.0);
-	vector<double> b(n, 0.0);
-	vector<double> d(n, 0.0);
-	vector<double> h(n, 0.0);
-	vector<double> alpha(n, 0.0);
-	vector<double> c(n + 1, 0.0);
-	vector<double> l(n + 1, 0.0);
-	vector<double> mu(n + 1, 0.0);
-	vector<double> z(n + 1, 0.0);
-
-	a = yarray;
-	l.at(0) = 1.0;
-	mu.at(0) = 0.0;
-	z.at(0) = 0.0;
-	for (size_t i = 0; i < n; i++)
+	// Fit cubic splines to data points in xarray, yarray between indicies klow and khigh
+	// Coefficients for the segment starting at point k are stored in row k of splines (rows klow : khigh-1), which must already be sized
+	// Uses the preallocated spline workspace in trans_ops
+	std::vector<double> &h = trans_ops.h;
+	std::vector<double> &c = trans_ops.c;
+	std::vector<double> &mu = trans_ops.mu;
+	std::vector<double> &z = trans_ops.z;
+
+	mu.at(klow) = 0.0;
+	z.at(klow) = 0.0;
+	for (int i = klow; i < khigh; i++)
 	{
 		h.at(i) = xarray.at(i + 1) - xarray.at(i);
-		if (i > 0)
+		if (i > klow)
 		{
-			alpha.at(i) = (3.0 / h.at(i)) * (a.at(i + 1) - a.at(i)) - (3.0 / h.at(i - 1))*(a.at(i) - a.at(i - 1));
-			l.at(i) = 2.0*(xarray.at(i + 1) - xarray.at(i-1)) - h.at(i - 1)*mu.at(i - 1);
-			mu.at(i) = h.at(i) / l.at(i);
-			z.at(i) = (alpha.at(i) - h.at(i - 1)*z.at(i - 1)) / l.at(i);
+			double alpha = (3.0 / h.at(i)) * (yarray.at(i + 1) - yarray.at(i)) - (3.0 / h.at(i - 1))*(yarray.at(i) - yarray.at(i - 1));
+			double l = 2.0*(xarray.at(i + 1) - xarray.at(i - 1)) - h.at(i - 1)*mu.at(i - 1);
+			mu.at(i) = h.at(i) / l;
+			z.at(i) = (alpha - h.at(i - 1)*z.at(i - 1)) / l;
 		}
 	}
 
-	l.at(n) = 1.0;
-	z.at(n) = 0.0;
-	c.at(n) = 0.0;
-	for (int i = n - 1; i >= 0; i--)
+	c.at(khigh) = 0.0;
+	for (int i = khigh - 1; i >= klow; i--)
 	{
-		size_t j = (size_t)i;
-		c.at(j) = z.at(j) - mu.at(j)*c.at(j + 1);
-		b.at(j) = (a.at(j + 1) - a.at(j)) / h.at(j) - h.at(j)*(c.at(j + 1) + 2.0*c.at(j)) / 3.0;
-		d.at(j) = (c.at(j + 1) - c.at(j)) / 3.0 / h.at(j);
+		c.at(i) = z.at(i) - mu.at(i)*c.at(i + 1);
+		splines.at(i, 0) = yarray.at(i);
+		splines.at(i, 1) = (yarray.at(i + 1) - yarray.at(i)) / h.at(i) - h.at(i)*(c.at(i + 1) + 2.0*c.at(i)) / 3.0;
+		splines.at(i, 2) = c.at(i);
+		splines.at(i, 3) = (c.at(i + 1) - c.at(i)) / 3.0 / h.at(i);
+		splines.at(i, 4) = xarray.at(i);
 	}
+}
+
+void C_mspt_receiver::update_transient_operators(const transient_inputs &tinputs)
+{
+	/*=====================================================================================
+	Update the coefficients of the closed-form transient solution that are shared by calc_timeavg_exit_temp, calc_single_pt,
+	calc_axial_profile and calc_extreme_outlet_values. Must be called whenever the PDE parameters (lam1, lam2, cval, aval) 
+	or the initial temperature profile (tinit) in tinputs change.
+
+	lam1[i](j), lam2[i](j), cval[i](j), aval[i](j) = PDE parameters for element j in flow path i
+	gam[i](j) = lam2 / lam1 for element j in flow path i
+	exp_gam_len[i](j) = exp(-gam * length) for element j in flow path i
+	mult[i](k,j) = product of exp_gam_len over elements k through j in flow path i (1 for j < k)
+	sum1[i](k,j) = sum of length/lam1 over elements k through j in flow path i (0 for j < k)
+	tinit[i](k) = initial fluid temperature at axial point k in flow path i
+	tint[i](k) = tinit * exp(gam*z) at axial point k in flow path i
+	=======================================================================================*/
 
-	for (size_t i = 0; i < n; i++)
+	size_t nelem = tinputs.nelem;
+	for (size_t i = 0; i < tinputs.npath; i++)
 	{
-		splines.at(i, 0) = a.at(i);
-		splines.at(i, 1) = b.at(i);
-		splines.at(i, 2) = c.at(i);
-		splines.at(i, 3) = d.at(i);
-		splines.at(i, 4) = xarray.at(i);
+		std::vector<double> &lam1 = trans_ops.lam1.at(i);
+		std::vector<double> &gam = trans_ops.gam.at(i);
+		std::vector<double> &exp_gam_len = trans_ops.exp_gam_len.at(i);
+		for (size_t j = 0; j < nelem; j++)
+		{
+			lam1.at(j) = tinputs.lam1.at(j, i);
+			trans_ops.lam2.at(i).at(j) = tinputs.lam2.at(j, i);
+			trans_ops.cval.at(i).at(j) = tinputs.cval.at(j, i);
+			trans_ops.aval.at(i).at(j) = tinputs.aval.at(j, i);
+			gam.at(j) = tinputs.lam2.at(j, i) / lam1.at(j);
+			exp_gam_len.at(j) = exp(-gam.at(j) * tinputs.length.at(j));
+		}
+
+		util::matrix_t<double> &mult = trans_ops.mult.at(i);
+		util::matrix_t<double> &sum1 = trans_ops.sum1.at(i);
+		for (size_t k = 0; k < nelem; k++)
+		{
+			mult.at(k, k) = exp_gam_len.at(k);
+			sum1.at(k, k) = tinputs.length.at(k) / lam1.at(k);
+			for (size_t j = k + 1; j < nelem; j++)
+			{
+				mult.at(k, j) = mult.at(k, j - 1) * exp_gam_len.at(j);
+				sum1.at(k, j) = sum1.at(k, j - 1) + tinputs.length.at(j) / lam1.at(j);
+			}
+		}
+
+		std::vector<double> &tinit = trans_ops.tinit.at(i);
+		std::vector<double> &tint = trans_ops.tint.at(i);
+		for (size_t j = 0; j < nelem; j++)
+		{
+			size_t k1 = tinputs.startpt.at(j);
+			for (size_t k = k1; k < k1 + tinputs.nz.at(j); k++)
+			{
+				tinit.at(k) = tinputs.tinit.at(k, i);
+				tint.at(k) = tinit.at(k) * exp(gam.at(j) * tinputs.zpts.at(k));
+			}
+		}
+	}
+}
+
+void C_mspt_receiver::update_transient_splines(const transient_inputs &tinputs)
+{
+	// Fit cubic splines to the initial temperature profile of each flow element for evaluation of derivatives in calc_extreme_outlet_values
+	for (size_t i = 0; i < tinputs.npath; i++)
+	{
+		for (size_t j = 0; j < tinputs.nelem; j++)
+		{
+			int k1 = tinputs.startpt.at(j);
+			cubic_splines(tinputs.zpts, trans_ops.tinit.at(i), k1, k1 + tinputs.nz.at(j) - 1, trans_ops.splines.at(i));
+		}
 	}
 }
 
@@ -1273,22 +1351,12 @@ double C_mspt_receiver::calc_timeavg_exit_temp(double tstep, int flowid, int pat
 
 	double Tavg = std::numeric_limits<double>::quiet_NaN();
 	size_t p = flowid;
-	size_t nelem = tinputs.nelem;
 	double Tfin = tinputs.inlet_temp;
 
-	vector<double> lam1, lam2, cval, aval, len, gam, Tinit;
-	lam1.resize(nelem); lam2.resize(nelem); cval.resize(nelem); aval.resize(nelem); len.resize(nelem); gam.resize(nelem), Tinit.resize(tinputs.nztot);
-	for (size_t i = 0; i < nelem; i++)
-	{
-		lam1.at(i) = tinputs.lam1.at(i, pathid);
-		lam2.at(i) = tinputs.lam2.at(i, pathid);
-		cval.at(i) = tinputs.cval.at(i, pathid);
-		aval.at(i) = tinputs.aval.at(i, pathid);
-		len.at(i) = tinputs.length.at(i);
-		gam.at(i) = lam2.at(i) / lam1.at(i);
-	}
-	for (size_t i = 0; i < tinputs.nztot; i++)
-		Tinit.at(i) = tinputs.tinit.at(i, pathid);
+	// Solution coefficients for this flow path (see update_transient_operators)
+	const vector<double> &lam1 = trans_ops.lam1.at(pathid), &lam2 = trans_ops.lam2.at(pathid), &cval = trans_ops.cval.at(pathid), &aval = trans_ops.aval.at(pathid);
+	const vector<double> &exp_gam_len = trans_ops.exp_gam_len.at(pathid), &Tinit = trans_ops.tinit.at(pathid);
+	const vector<double> &len = tinputs.length;
 
 	double T1 = Tinit.at((size_t)tinputs.startpt.at(p) + (size_t)tinputs.nz.at(p) - 1);  // Initial T at outlet
 	if (tstep < 1.e-3)		// Numerical limit for small time steps: time-average outlet temperature = initial outlet temperature
@@ -1304,25 +1372,9 @@ double C_mspt_receiver::calc_timeavg_exit_temp(double tstep, int flowid, int pat
 		}
 		else
 		{
-			util::matrix_t<double> sum1, mult;
-			vector<double> Tint;
-			sum1.resize_fill(p+1, p+1, 0.0);
-			mult.resize_fill(p+1, p+1, 1.0);
-			Tint.resize(tinputs.nztot);
-			for (size_t i = 0; i <= p; i++)
-			{
-				mult.at(i, i) = exp(-gam.at(i) * len.at(i));
-				sum1.at(i, i) = len.at(i) / lam1.at(i);
-				for (size_t j = i + 1; j <= p; j++)
-				{
-					mult.at(i, j) = mult.at(i, j - 1) * exp(-gam.at(j) * len.at(j) );
-					sum1.at(i, j) = sum1.at(i, j - 1) + len.at(j) / lam1.at(j);
-				}
-
-				size_t j = tinputs.startpt.at(i);
-				for (size_t k = 0; k < tinputs.nz.at(i); k++)
-					Tint.at(j + k) = Tinit.at(j + k) * exp(gam.at(i) * tinputs.zpts.at(j + k));
-			}
+			const util::matrix_t<double> &sum1 = trans_ops.sum1.at(pathid);
+			const util::matrix_t<double> &mult = trans_ops.mult.at(pathid);
+			const vector<double> &Tint = trans_ops.tint.at(pathid);
 
 
 			// Find largest integer for which tcritq > tstep
@@ -1347,14 +1399,14 @@ double C_mspt_receiver::calc_timeavg_exit_temp(double tstep, int flowid, int pat
 
 				double intTj = integrate(0.0, len.at(j), tinputs.zpts, Tint, tinputs.startpt.at(j), tinputs.startpt.at(j) + tinputs.nz.at(j) - 1);		// Integral of initial T*exp(lam2/lam1*z) over full axial coordinate of element j
 				double term1, term2, term3;
-				term1 = 1. / lam1.at(j) * exp(-gam.at(j)*len.at(j)) * intTj;
+				term1 = 1. / lam1.at(j) * exp_gam_len.at(j) * intTj;
 				if (lam2.at(j) != 0.0)
 				{
-					term2 = (cval.at(j) / lam2.at(j) - aval.at(j) / lam2.at(j) / lam2.at(j)) * (len.at(j) / lam1.at(j) - (1.0 - exp(-gam.at(j)*len.at(j))) / lam2.at(j)) + 
+					term2 = (cval.at(j) / lam2.at(j) - aval.at(j) / lam2.at(j) / lam2.at(j)) * (len.at(j) / lam1.at(j) - (1.0 - exp_gam_len.at(j)) / lam2.at(j)) + 
 						    aval.at(j) / 2.0 / lam2.at(j) * pow((len.at(j) / lam1.at(j)), 2);
 
-					term3 = (tstep - sum1(j, p)) * ((cval.at(j) / lam2.at(j) - aval.at(j) / lam2.at(j) / lam2.at(j))*(1.0 - exp(-gam.at(j)*len.at(j))) + 
-													(aval.at(j)*len.at(j) / lam1.at(j) / lam2.at(j)) + (aval.at(j) / 2.0 / lam2.at(j))*(1.0 - exp(-gam.at(j)*len.at(j)))*(tstep - sum1(j, p)));
+					term3 = (tstep - sum1(j, p)) * ((cval.at(j) / lam2.at(j) - aval.at(j) / lam2.at(j) / lam2.at(j))*(1.0 - exp_gam_len.at(j)) + 
+													(aval.at(j)*len.at(j) / lam1.at(j) / lam2.at(j)) + (aval.at(j) / 2.0 / lam2.at(j))*(1.0 - exp_gam_len.at(j))*(tstep - sum1(j, p)));
 				}
 				else
 				{
@@ -1384,7 +1436,7 @@ double C_mspt_receiver::calc_timeavg_exit_temp(double tstep, int flowid, int pat
 					term1 = tsub*tsub * (cval.at(q) / 2.0 + aval.at(q) / 6.0 * tsub);
 
 				double intTq = integrate(len.at(q) - lam1.at(q)*tsub, len.at(q), tinputs.zpts, Tint, tinputs.startpt.at(q), tinputs.startpt.at(q) + tinputs.nz.at(q) - 1);		// Integral of initial T*exp(lam2/lam1*z) over partial axial coordinate of element q
-				M = term1 + (1.0 / lam1.at(q)) * exp(-gam.at(q)*len.at(q)) * intTq;
+				M = term1 + (1.0 / lam1.at(q)) * exp_gam_len.at(q) * intTq;
 			}
 			Tavg = (sum + multval*M) / tstep;  // Time-average exit temperature
 		}
@@ -1423,22 +1475,12 @@ double C_mspt_receiver::calc_single_pt(double tpt, double zpt, int flowid, int p
 	int k, q;
 	double Tpt, Tval, nk, tk, tj, Ap, Aj, Dk, mult, mult2, sum;
 	size_t p = flowid;
-	size_t nelem = tinputs.nelem;
 	double Tfin = tinputs.inlet_temp;
 
-	vector<double> lam1, lam2, cval, aval, len, gam, Tinit;
-	lam1.resize(nelem); lam2.resize(nelem); cval.resize(nelem); aval.resize(nelem); len.resize(nelem); gam.resize(nelem), Tinit.resize(tinputs.nztot);
-	for (size_t i = 0; i < nelem; i++)
-	{
-		lam1.at(i) = tinputs.lam1.at(i, pathid);
-		lam2.at(i) = tinputs.lam2.at(i, pathid);
-		cval.at(i) = tinputs.cval.at(i, pathid);
-		aval.at(i) = tinputs.aval.at(i, pathid);
-		len.at(i) = tinputs.length.at(i);
-		gam.at(i) = lam2.at(i) / lam1.at(i);
-	}
-	for (size_t i = 0; i < tinputs.nztot; i++)
-		Tinit.at(i) = tinputs.tinit.at(i, pathid);
+	// Solution coefficients for this flow path (see update_transient_operators)
+	const vector<double> &lam1 = trans_ops.lam1.at(pathid), &lam2 = trans_ops.lam2.at(pathid), &cval = trans_ops.cval.at(pathid), &aval = trans_ops.aval.at(pathid);
+	const vector<double> &gam = trans_ops.gam.at(pathid), &exp_gam_len = trans_ops.exp_gam_len.at(pathid), &Tinit = trans_ops.tinit.at(pathid);
+	const vector<double> &len = tinputs.length;
 
 
 	double np = zpt - lam1.at(p) * tpt;
@@ -1486,7 +1528,7 @@ double C_mspt_receiver::calc_single_pt(double tpt, double zpt, int flowid, int p
 		{
 			int jplus1 = j + 1;
 			if (j < p-1)
-				mult2 *= exp(-gam.at(jplus1)*len.at(jplus1));
+				mult2 *= exp_gam_len.at(jplus1);
 			
 			tj = 0.0;
 			if (j == p - 1)
@@ -1495,7 +1537,7 @@ double C_mspt_receiver::calc_single_pt(double tpt, double zpt, int flowid, int p
 				tj -= len.at(jplus1) / lam1.at(jplus1);
 
 			if (lam2.at(j) != 0)
-				Aj = (cval.at(j) / lam2.at(j) - (aval.at(j) / lam2.at(j) / lam2.at(j))*(1. - lam2.at(j)*tj)) * (1. - exp(-gam.at(j)*len.at(j))) + aval.at(j)*len.at(j) / lam1.at(j) / lam2.at(j) * exp(-gam.at(j)*len.at(j));
+				Aj = (cval.at(j) / lam2.at(j) - (aval.at(j) / lam2.at(j) / lam2.at(j))*(1. - lam2.at(j)*tj)) * (1. - exp_gam_len.at(j)) + aval.at(j)*len.at(j) / lam1.at(j) / lam2.at(j) * exp_gam_len.at(j);
 			else
 				Aj = (len.at(j) / lam1.at(j)) * (cval.at(j) + aval.at(j)*tj) - (aval.at(j) / 2.0) * pow(len.at(j) / lam1.at(j), 2);
 			sum += Aj * mult2;
@@ -1504,7 +1546,7 @@ double C_mspt_receiver::calc_single_pt(double tpt, double zpt, int flowid, int p
 
 		mult = mult2;
 		if (q <= p-1)
-			mult *= exp(-gam.at(q)*len.at(q));
+			mult *= exp_gam_len.at(q);
 
 		if (nk >= 0)
 		{
@@ -1581,34 +1623,20 @@ void C_mspt_receiver::calc_axial_profile(double tpt, const transient_inputs &tin
 	else
 	{
 		double Aconst, Apos, Tval;
-		util::matrix_t<double> sumAconst, sumApos, mult;
+		util::matrix_t<double> &sumAconst = trans_ops.sumAconst;
+		util::matrix_t<double> &sumApos = trans_ops.sumApos;
 
 		for (size_t pathid = 0; pathid < tinputs.npath; pathid++)    // Flow paths
 		{
-			vector<double> lam1, lam2, cval, aval, len, gam, Tinit;
-			lam1.resize(nelem); lam2.resize(nelem); cval.resize(nelem); aval.resize(nelem); len.resize(nelem); gam.resize(nelem), Tinit.resize(tinputs.nztot);
-			for (size_t i = 0; i < nelem; i++)
-			{
-				lam1.at(i) = tinputs.lam1.at(i, pathid);
-				lam2.at(i) = tinputs.lam2.at(i, pathid);
-				cval.at(i) = tinputs.cval.at(i, pathid);
-				aval.at(i) = tinputs.aval.at(i, pathid);
-				len.at(i) = tinputs.length.at(i);
-				gam.at(i) = lam2.at(i) / lam1.at(i);
-			}
-			for (size_t i = 0; i < tinputs.nztot; i++)
-				Tinit.at(i) = tinputs.tinit.at(i, pathid);
+			// Solution coefficients for this flow path (see update_transient_operators)
+			const vector<double> &lam1 = trans_ops.lam1.at(pathid), &lam2 = trans_ops.lam2.at(pathid), &cval = trans_ops.cval.at(pathid), &aval = trans_ops.aval.at(pathid);
+			const vector<double> &gam = trans_ops.gam.at(pathid), &exp_gam_len = trans_ops.exp_gam_len.at(pathid), &Tinit = trans_ops.tinit.at(pathid);
+			const vector<double> &len = tinputs.length;
+			const util::matrix_t<double> &mult = trans_ops.mult.at(pathid);
 
 			// Calculate repetitive terms
 			sumAconst.resize_fill(nelem, nelem, 0.0);
 			sumApos.resize_fill(nelem, nelem, 0.0);
-			mult.resize_fill(nelem, nelem, 1.0);
-			for (size_t i = 0; i < nelem; i++)
-			{
-				mult.at(i, i) = exp(-gam.at(i)*len.at(i));
-				for (size_t j = i + 1; j < nelem; j++)
-					mult.at(i, j) = mult.at(i, j - 1) * exp(-gam.at(j)*len.at(j));
-			}
 
 			for (int i = nelem - 1; i >= 0; i--)
 			{
@@ -1618,8 +1646,8 @@ void C_mspt_receiver::calc_axial_profile(double tpt, const transient_inputs &tin
 
 					if (lam2.at(j) != 0)
 					{
-						Aconst = (cval.at(j) / lam2.at(j) - aval.at(j) / lam2.at(j)*(1.0 / lam2.at(j) - tpt + sum)) * (1.0 - exp(-gam.at(j)*len.at(j))) + aval.at(j)*len.at(j) / lam1.at(j) / lam2.at(j)*exp(-gam.at(j)*len.at(j));
-						Apos = -aval.at(j) / lam2.at(j) * (1.0 - exp(-gam.at(j)*len.at(j)));
+						Aconst = (cval.at(j) / lam2.at(j) - aval.at(j) / lam2.at(j)*(1.0 / lam2.at(j) - tpt + sum)) * (1.0 - exp_gam_len.at(j)) + aval.at(j)*len.at(j) / lam1.at(j) / lam2.at(j)*exp_gam_len.at(j);
+						Apos = -aval.at(j) / lam2.at(j) * (1.0 - exp_gam_len.at(j));
 					}
 					else
 					{
@@ -1774,21 +1802,9 @@ void C_mspt_receiver::calc_extreme_outlet_values(double tstep, int flowid, const
 		combine = true;
 	}
 
-	util::matrix_t<double> lam1, lam2, cval, aval, gam, Tinit;
-	lam1.resize(tinputs.nelem, m_n_lines); lam2.resize(tinputs.nelem, m_n_lines); cval.resize(tinputs.nelem, m_n_lines); aval.resize(tinputs.nelem, m_n_lines); gam.resize(tinputs.nelem, m_n_lines); Tinit.resize(tinputs.nztot, m_n_lines);
-	for (size_t j = 0; j < m_n_lines; j++)
-	{
-		for (int i = 0; i < tinputs.nelem; i++)
-		{
-			lam1.at(i, j) = tinputs.lam1.at(i, j);
-			lam2.at(i, j) = tinputs.lam2.at(i, j);
-			cval.at(i, j) = tinputs.cval.at(i, j);
-			aval.at(i, j) = tinputs.aval.at(i, j);
-			gam.at(i, j) = lam2.at(i, j) / lam1.at(i, j);
-		}
-		for (size_t i = 0; i < tinputs.nztot; i++)
-			Tinit.at(i, j) = tinputs.tinit.at(i, j);
-	}
+	// Solution coefficients and initial condition splines (see update_transient_operators and update_transient_splines)
+	const util::matrix_t<double> &lam1 = tinputs.lam1, &lam2 = tinputs.lam2, &cval = tinputs.cval, &aval = tinputs.aval, &Tinit = tinputs.tinit;
+	const std::vector<std::vector<double>> &gam = trans_ops.gam, &exp_gam_len = trans_ops.exp_gam_len;
 
 
 	//--- Set initial min/max values to values at beginning or end of time step
@@ -1823,31 +1839,31 @@ void C_mspt_receiver::calc_extreme_outlet_values(double tstep, int flowid, const
 	{
 
 		//--- Calculate useful terms
-		util::matrix_t<double> sumval;
-		util::matrix_t<double> multval;
-		sumval.resize_fill(p+1, m_n_lines, 0.0);
-		multval.resize_fill(p+1, m_n_lines, 1.0);
+		util::matrix_t<double> &sumval = trans_ops.sumval;
+		util::matrix_t<double> &multval = trans_ops.multval;
+		sumval.fill(0.0);
+		multval.fill(1.0);
 		for (size_t m = 0; m < m_n_lines; m++)
 		{
 			double term1;
 			if (lam2.at(p, m) != 0)
-				term1 = (aval.at(p, m) / lam2.at(p, m)) * (1.0 - exp(-gam.at(p, m)*zp));
+				term1 = (aval.at(p, m) / lam2.at(p, m)) * (1.0 - exp_gam_len.at(m).at(p));
 			else
 				term1 = aval.at(p, m)*zp / lam1.at(p, m);
 
 			for (size_t j = 0; j < p; j++)
 			{
 				sumval.at(j, m) = term1;
-				multval.at(j, m) *= exp(-gam.at(p, m)*zp);
+				multval.at(j, m) *= exp_gam_len.at(m).at(p);
 				for (size_t k = j + 1; k < p; k++)
 				{
-					multval.at(j, m) *= exp(-gam.at(k, m)* tinputs.length.at(k));
-					double mult2 = exp(-gam.at(p, m)*zp);
+					multval.at(j, m) *= exp_gam_len.at(m).at(k);
+					double mult2 = exp_gam_len.at(m).at(p);
 					for (int l = k + 1; l < p; l++)
-						mult2 *= exp(-gam.at(l, m)* tinputs.length.at(l));
+						mult2 *= exp_gam_len.at(m).at(l);
 
 					if (lam2.at(k, m) != 0)
-						sumval.at(j, m) += aval.at(k, m) / lam2.at(k, m) * (1.0 - exp(-gam.at(k, m) *tinputs.length.at(k))) * mult2;
+						sumval.at(j, m) += aval.at(k, m) / lam2.at(k, m) * (1.0 - exp_gam_len.at(m).at(k)) * mult2;
 					else
 						sumval.at(j, m) += aval.at(k, m)*tinputs.length.at(k) / lam1.at(k, m) * mult2;
 				}
@@ -1863,23 +1879,9 @@ void C_mspt_receiver::calc_extreme_outlet_values(double tstep, int flowid, const
 			{
 				size_t k1 = tinputs.startpt.at(j);
 
-				//--- Fit cubic splines for evaluation of derivatives of initial condition
-				vector<double> x(tinputs.nz.at(j));
-				vector<double> y(tinputs.nz.at(j));
-				util::matrix_t<double> splines, splines2;
-				for (size_t i = 0; i < tinputs.nz.at(j); i++)
-				{
-					x.at(i) = tinputs.zpts.at(k1 + i);
-					y.at(i) = Tinit.at(k1 + i, m);
-				}
-				cubic_splines(x, y, splines);
-
-				if (combine && j < p)
-				{
-					for (size_t i = 0; i < tinputs.nz.at(j); i++)
-						y.at(i) = Tinit.at(k1 + i, m + 1);
-					cubic_splines(x, y, splines2);
-				}
+				//--- Cubic splines for evaluation of derivatives of initial condition (row k1 + s = segment s of element j)
+				const util::matrix_t<double> &splines = trans_ops.splines.at(m);
+				const util::matrix_t<double> &splines2 = trans_ops.splines.at(combine ? m + 1 : m);
 
 				//--- Find time points where dT/dt = 0
 				len = tinputs.length.at(j);
@@ -1895,44 +1897,44 @@ void C_mspt_receiver::calc_extreme_outlet_values(double tstep, int flowid, const
 					{
 						q++;
 						s = (int) fmin( (int)(n / zint), tinputs.nz.at(j)-2);
-						dz = n - splines.at(s, 4);
-						Tval = splines.at(s, 0) + splines.at(s, 1)*dz + splines.at(s, 2)*dz*dz + splines.at(s, 3)*dz*dz*dz;
-						dTval = splines.at(s, 1) + 2.0 * splines.at(s, 2)*dz + 3.0 * splines.at(s, 3)*dz*dz;
-						d2Tval = 2.0 * splines.at(s, 2) + 6.0 * splines.at(s, 3)*dz;
+						dz = n - splines.at(k1 + s, 4);
+						Tval = splines.at(k1 + s, 0) + splines.at(k1 + s, 1)*dz + splines.at(k1 + s, 2)*dz*dz + splines.at(k1 + s, 3)*dz*dz*dz;
+						dTval = splines.at(k1 + s, 1) + 2.0 * splines.at(k1 + s, 2)*dz + 3.0 * splines.at(k1 + s, 3)*dz*dz;
+						d2Tval = 2.0 * splines.at(k1 + s, 2) + 6.0 * splines.at(k1 + s, 3)*dz;
 
-						term2 = cval.at(j, m) / lam1.at(j, m) - gam.at(j, m) * Tval - dTval;
-						term3 = (gam.at(j, m) * cval.at(j, m) / lam1.at(j, m) - aval.at(j, m) / lam1.at(j, m) / lam1.at(j, m) - pow(gam.at(j, m), 2)*Tval - 2.0*gam.at(j, m) * dTval - d2Tval);
+						term2 = cval.at(j, m) / lam1.at(j, m) - gam.at(m).at(j) * Tval - dTval;
+						term3 = (gam.at(m).at(j) * cval.at(j, m) / lam1.at(j, m) - aval.at(j, m) / lam1.at(j, m) / lam1.at(j, m) - pow(gam.at(m).at(j), 2)*Tval - 2.0*gam.at(m).at(j) * dTval - d2Tval);
 						if (j == p)
 						{
-							f = -exp(-gam.at(j, m) *(zp - n))*term2;
+							f = -exp(-gam.at(m).at(j) *(zp - n))*term2;
 							if (lam2.at(j, m) != 0)
-								f -= aval.at(j, m) / lam2.at(j, m) / lam1.at(j, m) * (1.0 - exp(-gam.at(j, m) * (zp - n)));
+								f -= aval.at(j, m) / lam2.at(j, m) / lam1.at(j, m) * (1.0 - exp(-gam.at(m).at(j) * (zp - n)));
 							else
 								f -= aval.at(j, m) / lam1.at(j, m) * (zp - n);
-							df = -exp(-gam.at(p, m)*(zp - n)) *term3;
+							df = -exp(-gam.at(m).at(p)*(zp - n)) *term3;
 						}
 						else
 						{
-							f = sumval.at(j, m) - multval.at(j, m) * exp(-gam.at(j, m) * (len - n)) * term2;
+							f = sumval.at(j, m) - multval.at(j, m) * exp(-gam.at(m).at(j) * (len - n)) * term2;
 							if (lam2.at(j, m) != 0)
-								f -= multval.at(j, m) * (aval.at(j, m) / lam2.at(j, m) / lam1.at(j, m)) * (1.0 - exp(-gam.at(j, m) * (len - n)));
+								f -= multval.at(j, m) * (aval.at(j, m) / lam2.at(j, m) / lam1.at(j, m)) * (1.0 - exp(-gam.at(m).at(j) * (len - n)));
 							else
 								f -= multval.at(j, m) * aval.at(j, m) / lam1.at(j, m) / lam1.at(j, m) * (len - n);
-							df = -multval.at(j, m) * exp(-gam.at(j, m)* (len - n)) *term3;
+							df = -multval.at(j, m) * exp(-gam.at(m).at(j)* (len - n)) *term3;
 
 
 							if (combine)
 							{
-								Tval = splines2.at(s, 0) + splines2.at(s, 1)*dz + splines2.at(s, 2)*dz*dz + splines2.at(s, 3)*dz*dz*dz;
-								dTval = splines2.at(s, 1) + 2.0 * splines2.at(s, 2)*dz + 3.0 * splines2.at(s, 3)*dz*dz;
-								d2Tval = 2.0 * splines2.at(s, 2) + 6.0 * splines2.at(s, 3)*dz;
-								term2 = cval.at(j, m + 1) / lam1.at(j, m + 1) - gam.at(j, m + 1) * Tval - dTval;
-								term3 = (gam.at(j, m + 1) * cval.at(j, m + 1) / lam1.at(j, m + 1) - aval.at(j, m + 1) / lam1.at(j, m + 1) / lam1.at(j, m + 1) - pow(gam.at(j, m + 1), 2)*Tval - 2.0*gam.at(j, m + 1) * dTval - d2Tval);
-								double f2 = sumval.at(j, m+1) - multval.at(j, m+1) * exp(-gam.at(j, m+1) * (len - n)) * term2;
-								double df2 = -multval.at(j, m + 1) * exp(-gam.at(j, m + 1)* (len - n)) *term3;
+								Tval = splines2.at(k1 + s, 0) + splines2.at(k1 + s, 1)*dz + splines2.at(k1 + s, 2)*dz*dz + splines2.at(k1 + s, 3)*dz*dz*dz;
+								dTval = splines2.at(k1 + s, 1) + 2.0 * splines2.at(k1 + s, 2)*dz + 3.0 * splines2.at(k1 + s, 3)*dz*dz;
+								d2Tval = 2.0 * splines2.at(k1 + s, 2) + 6.0 * splines2.at(k1 + s, 3)*dz;
+								term2 = cval.at(j, m + 1) / lam1.at(j, m + 1) - gam.at(m + 1).at(j) * Tval - dTval;
+								term3 = (gam.at(m + 1).at(j) * cval.at(j, m + 1) / lam1.at(j, m + 1) - aval.at(j, m + 1) / lam1.at(j, m + 1) / lam1.at(j, m + 1) - pow(gam.at(m + 1).at(j), 2)*Tval - 2.0*gam.at(m + 1).at(j) * dTval - d2Tval);
+								double f2 = sumval.at(j, m+1) - multval.at(j, m+1) * exp(-gam.at(m+1).at(j) * (len - n)) * term2;
+								double df2 = -multval.at(j, m + 1) * exp(-gam.at(m + 1).at(j)* (len - n)) *term3;
 								f = 0.5*(f + f2);
 								if (lam2.at(j, m + 1) != 0)
-									f -= 0.5* (multval.at(j, m + 1) * (aval.at(j, m + 1) / lam2.at(j, m + 1) / lam1.at(j, m + 1)) * (1.0 - exp(-gam.at(j, m + 1) * (len - n))));
+									f -= 0.5* (multval.at(j, m + 1) * (aval.at(j, m + 1) / lam2.at(j, m + 1) / lam1.at(j, m + 1)) * (1.0 - exp(-gam.at(m + 1).at(j) * (len - n))));
 								else
 									f -= 0.5*(multval.at(j, m + 1) * aval.at(j, m + 1) / lam1.at(j, m + 1) / lam1.at(j, m + 1) * (len - n));
 								df = 0.5*(df + df2);
@@ -2211,6 +2213,9 @@ void C_mspt_receiver::update_pde_parameters(bool use_initial_t, parameter_eval_i
 	tinputs.aval.fill(0.0);
 	tinputs.Rtube.fill(0.0);
 
+	// Convective resistance depends only on the mass flow and HTF properties, which typically do not change between calls during the transient solution
+	bool is_Rconv_current = (pinputs.mflow_tot == trans_ops.Rconv_mflow && pinputs.c_htf == trans_ops.Rconv_c_htf && pinputs.mu_htf == trans_ops.Rconv_mu_htf && pinputs.k_htf == trans_ops.Rconv_k_htf);
+
 	for (i = 0; i < m_n_lines; i++)
 	{
 		for (j = 0; j < m_n_elem; j++)			// Flow path elements in flow order
@@ -2234,11 +2239,15 @@ void C_mspt_receiver::update_pde_parameters(bool use_initial_t, parameter_eval_i
 				if (m_flowelem_type.at(j, i) == -3)		// Crossover header
 					mmult = 1.0 / (double)m_n_lines;
 
-				Reelem = 4 * mmult*pinputs.mflow_tot / (CSP::pi * m_id.at(j)*pinputs.mu_htf);			// Flow Reynolds number in element j
-				CSP::PipeFlow(Reelem, Pr_htf, tinputs.length.at(j) / m_id.at(j), (4.5e-5) / m_id.at(j), Nuelem, felem);
-				hinner = Nuelem*pinputs.k_htf / m_id.at(j);										// Tube internal heat transfer coefficient [W/m2/K]
 				tinputs.lam1.at(j, i) = mmult*pinputs.mflow_tot*pinputs.c_htf / pinputs.tm.at(j);
-				Rconv = 1.0 / (0.5*hinner* m_id.at(j));  // Convective resistance between fluid and internal tube wall
+				if (!is_Rconv_current)
+				{
+					Reelem = 4 * mmult*pinputs.mflow_tot / (CSP::pi * m_id.at(j)*pinputs.mu_htf);			// Flow Reynolds number in element j
+					CSP::PipeFlow(Reelem, Pr_htf, tinputs.length.at(j) / m_id.at(j), (4.5e-5) / m_id.at(j), Nuelem, felem);
+					hinner = Nuelem*pinputs.k_htf / m_id.at(j);										// Tube internal heat transfer coefficient [W/m2/K]
+					trans_ops.Rconv.at(j, i) = 1.0 / (0.5*hinner* m_id.at(j));  // Convective resistance between fluid and internal tube wall
+				}
+				Rconv = trans_ops.Rconv.at(j, i);
 			}
 
 			if (m_flowelem_type.at(j, i) >= 0)				// Receiver panel
@@ -2281,6 +2290,14 @@ void C_mspt_receiver::update_pde_parameters(bool use_initial_t, parameter_eval_i
 		}
 	}
 
+	if (pinputs.mflow_tot > 0.0)
+	{
+		trans_ops.Rconv_mflow = pinputs.mflow_tot;
+		trans_ops.Rconv_c_htf = pinputs.c_htf;
+		trans_ops.Rconv_mu_htf = pinputs.mu_htf;
+		trans_ops.Rconv_k_htf = pinputs.k_htf;
+	}
+
 }
 
 void C_mspt_receiver::solve_transient_model(double tstep,
@@ -2334,7 +2351,8 @@ void C_mspt_receiver::solve_transient_model(double tstep,
 	double solved_time = 0.0;
 	int qsub = 0;							// Iterations to adjust intermediate transient model time steps
 	int qmax = 50;							// Max iterations for adjustment of PDE parameters based on iterative solution of time-averaged tempeatures
-	util::matrix_t<double>tinit_start = tinputs.tinit;			// Save initial condition at start of full time step 
+	util::matrix_t<double> &tinit_start = trans_ops.tinit_start;
+	tinit_start = tinputs.tinit;			// Save initial condition at start of full time step 
 
 	// Update PDE parameters using initial temperature solution
 	update_pde_parameters(true, pinputs, tinputs);	
@@ -2357,6 +2375,7 @@ void C_mspt_receiver::solve_transient_model(double tstep,
 			// Update PDE parameters with specified Tfeval and Tseval	
 			if (q>0)
 				update_pde_parameters(false, pinputs, tinputs);			
+			update_transient_operators(tinputs);
 
 
 			// Calculate time-averaged outlet temperatures
@@ -2374,9 +2393,10 @@ void C_mspt_receiver::solve_transient_model(double tstep,
 
 
 			// Calculate time-averaged wall temperatures, convection / radiation losses, heat-trace thermal input
-			util::matrix_t<double> Tfavg, Tsavg;
-			Tfavg.resize_fill(m_n_elem, m_n_lines, 0.0);
-			Tsavg.resize_fill(m_n_elem, m_n_lines, 0.0);
+			util::matrix_t<double> &Tfavg = trans_ops.Tfavg;
+			util::matrix_t<double> &Tsavg = trans_ops.Tsavg;
+			Tfavg.fill(0.0);
+			Tsavg.fill(0.0);
 			for (size_t i = 0; i < m_n_lines; i++)
 			{
 				for (size_t j = 0; j < m_n_elem; j++)
@@ -2466,7 +2486,8 @@ void C_mspt_receiver::solve_transient_model(double tstep,
 			for (size_t j = 0; j < m_nz_tot; j++)
 				max_Trise = fmax(max_Trise, std::abs(toutputs.t_profile.at(j, i) - tinputs.tinit.at(j, i)));		// Difference between final and initial temperature at axial position j
 		}
-		util::matrix_t<double> textreme_d, tpt_d, textreme_r, tpt_r;
+		util::matrix_t<double> &textreme_d = trans_ops.textreme_d, &tpt_d = trans_ops.tpt_d, &textreme_r = trans_ops.textreme_r, &tpt_r = trans_ops.tpt_r;
+		update_transient_splines(tinputs);
 		calc_extreme_outlet_values(transmodel_step, m_n_elem - 1, tinputs, textreme_d, tpt_d);   //Extreme downcomer outlet T
 		calc_extreme_outlet_values(transmodel_step, m_n_elem - 2, tinputs, textreme_r, tpt_r);   //Extreme receiver outlet T
 		max_Trise = fmax(max_Trise, fmax(textreme_d.at(1, 0) - textreme_d.at(0, 0), textreme_r.at(1, 0) - textreme_r.at(0, 0)));
@@ -163,6 +163,35 @@ private:
 
 	} param_inputs;
 
+	struct transient_operators
+	{
+		// Solution coefficients that depend only on the PDE parameters (updated with the PDE parameters)
+		std::vector<std::vector<double>> lam1, lam2, cval, aval;	// lam1[i](j) = PDE parameters for element j in flow path i
+		std::vector<std::vector<double>> gam;			// gam[i](j) = lam2 / lam1 for element j in flow path i [1/m]
+		std::vector<std::vector<double>> exp_gam_len;	// exp_gam_len[i](j) = exp(-gam * length) for element j in flow path i [-]
+		std::vector<util::matrix_t<double>> mult;	// mult[i](k,j) = product of exp_gam_len over elements k through j in flow path i [-]
+		std::vector<util::matrix_t<double>> sum1;	// sum1[i](k,j) = fluid transit time through elements k through j in flow path i [s]
+
+		// Terms that depend on the initial temperature profile tinit
+		std::vector<std::vector<double>> tinit;		// tinit[i] = initial fluid temperature at each axial point in flow path i [K]
+		std::vector<std::vector<double>> tint;		// tint[i] = tinit[i] * exp(gam*z) at each axial point in flow path i
+		std::vector<util::matrix_t<double>> splines;	// splines[i] = cubic spline coefficients of tinit[i], one row per axial segment
+
+		// Tube-side convective resistance only depends on mass flow and HTF properties, which are fixed within a transient solution
+		double Rconv_mflow, Rconv_c_htf, Rconv_mu_htf, Rconv_k_htf;
+		util::matrix_t<double> Rconv;
+
+		// Preallocated workspaces
+		std::vector<double> h, mu, z, c;
+		util::matrix_t<double> sumAconst, sumApos, sumval, multval, Tfavg, Tsavg, tinit_start, textreme_d, tpt_d, textreme_r, tpt_r;
+
+		transient_operators()
+		{
+			Rconv_mflow = Rconv_c_htf = Rconv_mu_htf = Rconv_k_htf = std::numeric_limits<double>::quiet_NaN();
+		}
+
+	} trans_ops;
+
 
 
 	void initialize_transient_parameters();
@@ -174,7 +203,9 @@ private:
 	void calc_header_size(double pdrop, double mdot, double rhof, double muf, double Lh, double &id_calc, double &th_calc, double &od_calc);
 	double interpolate(double x, const std::vector<double> &xarray, const std::vector<double> &yarray, int klow, int khigh);
 	double integrate(double xlow, double xhigh, const std::vector<double> &xarray, const std::vector<double> &yarray, int klow, int khigh);
-	void cubic_splines(const std::vector<double> &xarray, const std::vector<double> &yarray, util::matrix_t<double> &splines);
+	void cubic_splines(const std::vector<double> &xarray, const std::vector<double> &yarray, int klow, int khigh, util::matrix_t<double> &splines);
+	void update_transient_operators(const transient_inputs &tinputs);
+	void update_transient_splines(const transient_inputs &tinputs);
 	double calc_single_pt(double tpt, double zpt, int flowid, int pathid, const transient_inputs &tinputs);
 	double calc_timeavg_exit_temp(double tstep, int flowid, int pathid, const transient_inputs &tinputs);
 
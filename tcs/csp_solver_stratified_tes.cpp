@@ -43,7 +43,7 @@ C_storage_node::C_storage_node()
 		m_T_htr = m_max_q_htr = std::numeric_limits<double>::quiet_NaN();
 }
 
-void C_storage_node::init(HTFProperties htf_class_in, double V_tank_one_temp, double h_tank, bool lid, double u_tank,
+void C_storage_node::init(const HTFProperties &htf_class_in, double V_tank_one_temp, double h_tank, bool lid, double u_tank,
 	double tank_pairs, double T_htr, double max_q_htr, double V_ini, double T_ini)
 {
 	mc_htf = htf_class_in;
@@ -74,7 +74,7 @@ private:
 
 	double get_m_m_calc();
 
-	void init(HTFProperties htf_class_in, double V_tank_one_temp, double h_tank, bool lid, double u_tank,
+	void init(const HTFProperties &htf_class_in, double V_tank_one_temp, double h_tank, bool lid, double u_tank,
 		double tank_pairs, double T_htr, double max_q_htr, double V_ini, double T_ini);
 
 	double m_dot_available(double f_unavail, double timestep);
@@ -434,6 +434,9 @@ void C_csp_trough_collector_receiver::init(const C_csp_collector_receiver::S_csp
 	init_fieldgeom();
 	// for test end
 
+	if (m_use_hl_surrogate)
+		build_hl_surrogates(init_inputs.m_elev);
+
 	// Calculate tracking parasitics for when trough is on sun
 	m_W_dot_sca_tracking_nom = m_SCA_drives_elec*(double)(m_nSCA*m_nLoops)/1.E6;	//[MWe]
 
@@ -4743,6 +4746,101 @@ void C_csp_trough_collector_receiver::EvacReceiver(double T_1_in, double m_dot,
 	//outputs
 	double &q_heatloss, double &q_12conv, double &q_34tot, double &c_1ave, double &rho_1ave, double &q_3reflect)
 {
+	double colopteff_tot = m_ColOptEff(ct, sca_num)*m_Dirt_HCE(hn, hv)*m_Shadowing(hn, hv);	//The total optical efficiency
+	double q_opt = m_q_i * colopteff_tot;	//[W/m] Incident flux after optical losses
+
+	size_t i_hl = (size_t)(hn*m_nHCEVar + hv);
+	if (m_use_hl_surrogate && !single_point && i_hl < mv_hl_surrogate.size() && mv_hl_surrogate[i_hl].is_built())
+	{
+		double q_3SolAbs;
+		if (m_GlazingIntact(hn, hv)) {
+			q_3SolAbs = q_opt * m_Tau_envelope.at(hn, hv) * m_alpha_abs.at(hn, hv);	//[W/m]
+			q_3reflect = q_opt * m_Tau_envelope.at(hn, hv) * (1.0 - m_alpha_abs.at(hn, hv));	//[W/m]
+		}
+		else {
+			q_3SolAbs = q_opt * m_alpha_abs(hn, hv);	//[W/m]
+			q_3reflect = q_opt * (1.0 - m_alpha_abs.at(hn, hv));	//[W/m]
+		}
+
+		if (mv_hl_surrogate[i_hl].energy_balance(T_1_in, m_dot, T_amb, m_T_sky, v_6, q_opt, q_3SolAbs, m_L_actSCA[ct], m_htfProps,
+			q_heatloss, q_12conv, q_34tot, c_1ave, rho_1ave))
+			return;
+	}
+
+	EvacReceiver_energy_balance(T_1_in, m_dot, T_amb, m_T_sky, v_6, P_6, q_opt, hn, hv, m_L_actSCA[ct], single_point, ncall, time,
+		q_heatloss, q_12conv, q_34tot, c_1ave, rho_1ave, q_3reflect);
+}
+
+void C_csp_trough_collector_receiver::build_hl_surrogates(double elev /*m*/)
+{
+	// Tables are built at the site pressure; the detailed model is insensitive enough to it that it is not a table dimension
+	double P_amb = 101325.0*pow(1 - 2.25577E-5*elev, 5.25588);	//[Pa]
+
+	double q_opt_max = 0.0;
+	for (size_t i = 0; i < m_W_aperture.size(); i++)
+		q_opt_max = max(q_opt_max, 1100.0*m_W_aperture[i]);	//[W/m] Upper bound on the DNI-weighted aperture width
+
+	std::vector<double> axes[C_hce_heat_loss_surrogate::N_AXES];
+	C_hce_heat_loss_surrogate::default_axes(min(m_T_fp, m_T_loop_in_des) - 25.0, m_T_loop_out_des + 75.0, q_opt_max,
+		m_m_dot_htfmin, m_m_dot_htfmax, axes);
+
+	// Table points are solved independently of the run; restore the guess values afterwards
+	double T_save_orig[5];
+	std::copy(m_T_save, m_T_save + 5, T_save_orig);
+	std::vector<double> reguess_args_orig = mv_reguess_args;
+
+	mv_hl_surrogate.clear();
+	mv_hl_surrogate.resize(m_nHCEt*m_nHCEVar);
+
+	double max_abs_err = 0.0, max_rel_err = 0.0;
+	int n_tables = 0;
+	for (int hn = 0; hn < m_nHCEt; hn++)
+	{
+		bool is_used = false;
+		for (int i = 0; i < m_nSCA; i++)
+			is_used = is_used || ((int)m_SCAInfoArray(i, 0) - 1 == hn);
+		if (!is_used)
+			continue;
+
+		for (int hv = 0; hv < m_nHCEVar; hv++)
+		{
+			if (m_HCE_FieldFrac(hn, hv) == 0.0)
+				continue;
+
+			mv_hl_surrogate[hn*m_nHCEVar + hv].build(axes,
+				[&](const double *x, double *y)
+				{
+					double q_heatloss, q_12conv, q_34tot, c_1ave, rho_1ave, q_3reflect, q_3SolAbs;
+					double T_sky = x[C_hce_heat_loss_surrogate::E_T_AMB] - x[C_hce_heat_loss_surrogate::E_DT_SKY];
+					EvacReceiver_energy_balance(x[C_hce_heat_loss_surrogate::E_T_HTF], x[C_hce_heat_loss_surrogate::E_M_DOT], x[C_hce_heat_loss_surrogate::E_T_AMB], T_sky,
+						x[C_hce_heat_loss_surrogate::E_V_WIND], P_amb, x[C_hce_heat_loss_surrogate::E_Q_OPT], hn, hv, m_L_actSCA[0], true, 10, 0.0,
+						q_heatloss, q_12conv, q_34tot, c_1ave, rho_1ave, q_3reflect);
+
+					q_3SolAbs = x[C_hce_heat_loss_surrogate::E_Q_OPT] * (m_GlazingIntact(hn, hv) ? m_Tau_envelope.at(hn, hv) : 1.0) * m_alpha_abs.at(hn, hv);
+					y[C_hce_heat_loss_surrogate::E_Q_HEATLOSS] = q_heatloss;
+					y[C_hce_heat_loss_surrogate::E_Q_34TOT] = q_34tot;
+					y[C_hce_heat_loss_surrogate::E_Q_ABS_LOSS] = q_3SolAbs - q_12conv;
+				});
+
+			max_abs_err = max(max_abs_err, mv_hl_surrogate[hn*m_nHCEVar + hv].get_max_abs_error());
+			max_rel_err = max(max_rel_err, mv_hl_surrogate[hn*m_nHCEVar + hv].get_max_rel_error());
+			n_tables++;
+		}
+	}
+
+	std::copy(T_save_orig, T_save_orig + 5, m_T_save);
+	mv_reguess_args = reguess_args_orig;
+
+	m_error_msg = util::format("Receiver heat loss tables built for %d HCE variants. The maximum heat loss error at the validation points is %.2f W/m (%.2f%% of the largest tabulated heat loss). "
+		"Conditions outside the tables use the detailed receiver model.", n_tables, max_abs_err, 100.0*max_rel_err);
+	mc_csp_messages.add_message(C_csp_messages::NOTICE, m_error_msg);
+}
+
+void C_csp_trough_collector_receiver::EvacReceiver_energy_balance(double T_1_in, double m_dot, double T_amb, double m_T_sky, double v_6, double P_6, double q_opt /*W/m*/,
+	int hn /*HCE number [0..3] */, int hv /* HCE variant [0..3] */, double L_act /*m*/, bool single_point, int ncall, double time,
+	//outputs
+	double &q_heatloss, double &q_12conv, double &q_34tot, double &c_1ave, double &rho_1ave, double &q_3reflect)
+{
 
 	//cc -- note that collector/hce geometry is part of the parent class. Only the indices specifying the
 	//		number of the HCE and collector need to be passed here.
@@ -4758,7 +4856,7 @@ void C_csp_trough_collector_receiver::EvacReceiver(double T_1_in, double m_dot,
 	bool UPFLAG, LOWFLAG, T3upflag, T3lowflag, is_e_table;
 	int m_qq, q5_iter, T1_iter, q_conv_iter;
 
-	double T_save_tot, colopteff_tot;
+	double T_save_tot;
 
 	//cc--> note that xx and yy have size 'nea'
 
@@ -4846,7 +4944,7 @@ lab_keep_guess:
 	//Decreasing the tolerance helps get out of repeating m_defocus iterations
 	if (ncall>8) {
 		T3_tol = 1.5e-4;        //1.0   
-		q5_tol = 1.0e-4;        //max(1.0, 0.001*m_q_i)
+		q5_tol = 1.0e-4;        //max(1.0, 0.001*q_opt)
 		T1_tol = 1.0e-4;        //1.0
 		T2_tol = 1.0e-4;        //1.0
 	}
@@ -4857,25 +4955,21 @@ lab_keep_guess:
 	k_45 = 1.04;                             //[W/m-K]  Conductivity of glass
 	R_45cond = log(m_D_5(hn, hv) / m_D_4(hn, hv)) / (2.*CSP::pi*k_45);    //[K-m/W]Equation of thermal resistance for conduction through a cylinder
 
-	colopteff_tot = m_ColOptEff(ct, sca_num)*m_Dirt_HCE(hn, hv)*m_Shadowing(hn, hv);	//The total optical efficiency
-
-    
-
 	if (m_GlazingIntact(hn, hv)){   //These calculations (q_3SolAbs,q_5solAbs) are not dependent on temperature, so only need to be computed once per call to subroutine
 
-		q_3SolAbs = m_q_i * colopteff_tot * m_Tau_envelope.at(hn, hv) * m_alpha_abs.at(hn, hv);  //[W/m]  
+		q_3SolAbs = q_opt * m_Tau_envelope.at(hn, hv) * m_alpha_abs.at(hn, hv);  //[W/m]  
 		//We must account for the radiation absorbed as it passes through the envelope
-		q_5solabs = m_q_i * colopteff_tot * m_alpha_env(hn, hv);   //[W/m]
+		q_5solabs = q_opt * m_alpha_env(hn, hv);   //[W/m]
 
-        q_3reflect = m_q_i * colopteff_tot * m_Tau_envelope.at(hn, hv) * (1.0 - m_alpha_abs.at(hn, hv));  //[W/m]  
+        q_3reflect = q_opt * m_Tau_envelope.at(hn, hv) * (1.0 - m_alpha_abs.at(hn, hv));  //[W/m]  
 	}
 	else{
 		//Calculate the absorbed energy 
-		q_3SolAbs = m_q_i * colopteff_tot * m_alpha_abs(hn, hv);  //[W/m]  
+		q_3SolAbs = q_opt * m_alpha_abs(hn, hv);  //[W/m]  
 		//No envelope
 		q_5solabs = 0.0;                            //[W/m]
 
-        q_3reflect = m_q_i * colopteff_tot * (1.0 - m_alpha_abs.at(hn, hv));  //[W/m]  
+        q_3reflect = q_opt * (1.0 - m_alpha_abs.at(hn, hv));  //[W/m]  
 	}
 
 	is_e_table = false;
@@ -5109,7 +5203,7 @@ lab_keep_guess:
 
 		q_12conv = q_3SolAbs - (q_34tot + q_cond_bracket);         //[W/m] Energy transfer to/from fluid based on energy balance at T_3
 
-		q_in_W = q_12conv * m_L_actSCA[ct];                           //Convert [W/m] to [W] for some calculations
+		q_in_W = q_12conv * L_act;                           //Convert [W/m] to [W] for some calculations
 
 		if (!single_point) {
 			T_1_out = max(m_T_sky, q_in_W / (m_dot*cp_1) + T_1_in);    //Estimate outlet temperature with previous cp
@@ -299,6 +299,9 @@ private:
 	// Member variables that are used to store information for the EvacReceiver method
 	double m_T_save[5];			//[K] Saved temperatures from previous call to EvacReceiver single SCA energy balance model
 	std::vector<double> mv_reguess_args;	//[-] Logic to determine whether to use previous guess values or start iteration fresh
+	std::vector<C_hce_heat_loss_surrogate> mv_hl_surrogate;	//[-] Heat loss tables for each HCE type and variant, index hn*m_nHCEVar + hv
+
+	void build_hl_surrogates(double elev /*m*/);
 	
 	// member string for exception messages
 	std::string m_error_msg;
@@ -361,6 +364,7 @@ public:
 	bool m_accept_init = std::numeric_limits<double>::quiet_NaN();		//[-] In acceptance testing mode - require steady-state startup
 	int m_accept_loc = std::numeric_limits<double>::quiet_NaN();		//[-] In acceptance testing mode - temperature sensor location (1=hx,2=loop)
 	bool m_is_using_input_gen = std::numeric_limits<double>::quiet_NaN();
+	bool m_use_hl_surrogate = false;	//[-] Evaluate HCE heat loss from tables built at init, falling back to the detailed energy balance outside the tables
 
 	
 	double m_mc_bal_hot_per_MW = std::numeric_limits<double>::quiet_NaN();		//[kWht/K-MWt] The heat capacity per MWt design of the balance of plant on the hot side
@@ -735,6 +739,10 @@ public:
 		int hn /*HCE number [0..3] */, int hv /* HCE variant [0..3] */, int ct /*Collector type*/, int sca_num, bool single_point, int ncall, double time,
 		//outputs
 		double &q_heatloss, double &q_12conv, double &q_34tot, double &c_1ave, double &rho_1ave, double &q_3reflect);
+	void EvacReceiver_energy_balance(double T_1_in, double m_dot, double T_amb, double m_T_sky, double v_6, double P_6, double q_opt /*W/m*/,
+		int hn /*HCE number [0..3] */, int hv /* HCE variant [0..3] */, double L_act /*m*/, bool single_point, int ncall, double time,
+		//outputs
+		double &q_heatloss, double &q_12conv, double &q_34tot, double &c_1ave, double &rho_1ave, double &q_3reflect);
 	double fT_2(double q_12conv, double T_1, double T_2g, double m_v_1, int hn, int hv);
 	void FQ_34CONV(double T_3, double T_4, double P_6, double v_6, double T_6, int hn, int hv, double &q_34conv, double &h_34);
 	void FQ_56CONV(double T_5, double T_6, double P_6, double v_6, int hn, int hv, double &q_56conv, double &h_6);
@@ -369,7 +369,7 @@ C_storage_tank::C_storage_tank()
 	m_T_design = m_mass_total = m_mass_inactive = m_mass_active = std::numeric_limits<double>::quiet_NaN();
 }
 
-void C_storage_tank::init(HTFProperties htf_class_in, double V_tank /*m3*/,
+void C_storage_tank::init(const HTFProperties &htf_class_in, double V_tank /*m3*/,
 	double h_tank /*m*/, double h_min /*m*/, double u_tank /*W/m2-K*/,
 	double tank_pairs /*-*/, double T_htr /*K*/, double max_q_htr /*MWt*/,
 	double V_ini /*m3*/, double T_ini /*K*/,
@@ -112,7 +112,7 @@ public:
 
     double get_m_V_calc(); //[m3]
 
-	void init(HTFProperties htf_class_in, double V_tank /*m3*/, 
+	void init(const HTFProperties &htf_class_in, double V_tank /*m3*/, 
 		double h_tank /*m*/, double h_min /*m*/, double u_tank /*W/m2-K*/, 
 		double tank_pairs /*-*/, double T_htr /*K*/, double max_q_htr /*MWt*/, 
 		double V_ini /*m3*/, double T_ini /*K*/,
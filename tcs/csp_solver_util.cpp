@@ -57,11 +57,18 @@ void C_csp_reported_outputs::C_output::assign(double *p_reporting_ts_array, size
 	mp_reporting_ts_array = p_reporting_ts_array;
 	mv_temp_outputs.reserve(10);
 
-	m_is_allocated = true;
+	// NULL = output not requested by the caller: don't store timestep values or write outputs
+	m_is_allocated = p_reporting_ts_array != 0;
 
 	m_n_reporting_ts_array = n_reporting_ts_array;
 }
 
+void C_csp_reported_outputs::C_output::assign_dependency(size_t n_reporting_ts_array)
+{
+    mv_dependency_array.resize(n_reporting_ts_array);
+    assign(mv_dependency_array.data(), n_reporting_ts_array);
+}
+
 void C_csp_reported_outputs::C_output::set_m_is_ts_weighted(int subts_weight_type)
 {
 	m_subts_weight_type = subts_weight_type;
@@ -329,6 +336,18 @@ bool C_csp_reported_outputs::assign(int index, double *p_reporting_ts_array, siz
         
     }
 
+    // Dependent outputs are calculated from the reported values of outputs A and B,
+    //    so keep those even if the caller did not request them
+    for (int i = 0; i < m_n_dependent_outputs; i++) {
+        if (!mvc_dependent_outputs[i].get_is_allocated())
+            continue;
+        int ind_AB[2] = { mvc_dependent_outputs[i].get_name_indA(), mvc_dependent_outputs[i].get_name_indB() };
+        for (int ind : ind_AB) {
+            if (!mvc_outputs[ind].get_is_allocated())
+                mvc_outputs[ind].assign_dependency(n_reporting_ts_array);
+        }
+    }
+
 	return true;
 }
 
@@ -66,6 +66,8 @@ public:
 		std::vector<double> mv_temp_outputs;
 
 		bool m_is_allocated;		// True = memory allocated for array. False = no memory allocated, won't write outputs
+
+		std::vector<double> mv_dependency_array;	// Reporting array owned here when the caller did not allocate one but a dependent output needs the values
 		
 		int m_subts_weight_type;	// 0: timestep-weighted average, 1: Take first piont in mv_temp_outputs, 2: Take final point in mv_temp_outupts
 		//bool m_is_ts_weighted;		// True = timestep-weighted average of mv_temp_outputs, False = take first point in mv_temp_outputs
@@ -94,6 +96,8 @@ public:
 
 		void assign(double *p_reporting_ts_array, size_t n_reporting_ts_array);
 
+        void assign_dependency(size_t n_reporting_ts_array);
+
 		void set_timestep_output(double output_value);
 
 		void overwrite_most_recent_timestep(double value);
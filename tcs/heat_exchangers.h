@@ -251,8 +251,8 @@ namespace NS_HX_counterflow_eqs
         double m_m_dot_hot;     //[kg/s]
 
     public:
-        C_MEQ__q_dot__target_UA__c_in_h_out__enth(int hot_fl_code /*-*/, HTFProperties hot_htf_class,
-            int cold_fl_code /*-*/, HTFProperties cold_htf_class,
+        C_MEQ__q_dot__target_UA__c_in_h_out__enth(int hot_fl_code /*-*/, const HTFProperties & hot_htf_class,
+            int cold_fl_code /*-*/, const HTFProperties & cold_htf_class,
             const S_hx_node_info s_node_info_des,
             double P_cold_out /*kPa*/, double P_hot_out /*kPa*/,
             double h_cold_in /*kJ/kg*/, double P_cold_in /*kPa*/, double m_dot_cold /*kg/s*/,
@@ -330,8 +330,8 @@ namespace NS_HX_counterflow_eqs
         double m_m_dot_h;		//[kg/s]
 
     public:
-        C_MEQ__q_dot__UA_target__enth(int hot_fl_code /*-*/, HTFProperties hot_htf_class,
-            int cold_fl_code /*-*/, HTFProperties cold_htf_class,
+        C_MEQ__q_dot__UA_target__enth(int hot_fl_code /*-*/, const HTFProperties & hot_htf_class,
+            int cold_fl_code /*-*/, const HTFProperties & cold_htf_class,
             S_hx_node_info* ps_node_info_des,
             int N_sub_hx /*-*/,
             E_UA_target_type UA_target_type, double UA_target /*kW/K*/,
@@ -404,8 +404,8 @@ namespace NS_HX_counterflow_eqs
         double m_m_dot_h;		//[kg/s]
 
     public:
-        C_MEQ__min_dT__q_dot(int hot_fl_code /*-*/, HTFProperties hot_htf_class,
-            int cold_fl_code /*-*/, HTFProperties cold_htf_class,
+        C_MEQ__min_dT__q_dot(int hot_fl_code /*-*/, const HTFProperties & hot_htf_class,
+            int cold_fl_code /*-*/, const HTFProperties & cold_htf_class,
             int N_sub_hx /*-*/,
             double P_c_out /*kPa*/, double P_h_out /*kPa*/,
             double h_c_in /*kJ/kg*/, double P_c_in /*kPa*/, double m_dot_c /*kg/s*/,
@@ -40,6 +40,9 @@ HTFProperties::HTFProperties()
 	uf_err_msg = "The user-defined htf property table is invalid (rows=%d cols=%d)";
 
 	m_is_temp_enth_avail = false;
+
+	m_cp_poly_n = 0;
+	m_cp_poly_T_ref = 0.0;
 }
 
 void HTFProperties::Initialize(int htf_code, util::matrix_t<double> ud_htf_props)
@@ -92,6 +95,7 @@ bool HTFProperties::SetUserDefinedFluid( const util::matrix_t<double> &table )
 	m_userTable = table;	
 	m_fluid = User_defined;
     m_integration_points = 100;
+	set_cp_kernel();
 
 	// Specific which columns are used as the independent variable; these must be monotonically increasing
 	int ind_var_index[2] = {0, 6};	
@@ -217,6 +221,7 @@ bool HTFProperties::SetFluid( int fluid )
 {
 	// If using stored fluid properties, set member fluid number
 	m_fluid = fluid;
+	set_cp_kernel();
 
 	if( m_is_temp_enth_avail )
 	{
@@ -250,6 +255,34 @@ double HTFProperties::Cp_ave(double T_cold_K, double T_hot_K)
 		"HTFProperties::Cp_ave",1));
 	}
 	
+	if (m_cp_poly_n > 0)
+	{
+		// Exact average of the polynomial: shift it to the interval midpoint, where the odd terms integrate to zero
+		double d[5];
+		for (int k = 0; k < m_cp_poly_n; k++)
+			d[k] = m_cp_poly[k];
+
+		double x_mid = 0.5*(T_cold_K + T_hot_K) - m_cp_poly_T_ref;
+		for (int k = 0; k < m_cp_poly_n - 1; k++)
+			for (int j = m_cp_poly_n - 2; j >= k; j--)
+				d[j] += x_mid*d[j + 1];
+
+		double h_sq = 0.25*(T_hot_K - T_cold_K)*(T_hot_K - T_cold_K);
+		double cp_ave = 0.0;
+		double h_pow = 1.0;
+		for (int k = 0; k < m_cp_poly_n; k += 2)
+		{
+			cp_ave += d[k] * h_pow / double(k + 1);
+			h_pow *= h_sq;
+		}
+		return cp_ave;
+	}
+
+	if (m_fluid == User_defined && m_userTable.nrows() > 2)
+	{
+		return Cp_ave_user_table(T_cold_K, T_hot_K);
+	}
+
     // Composite Midpoint Rule
 	double cp_sum = 0.0;
     double delta_T = (T_hot_K - T_cold_K) / double(m_integration_points);
@@ -269,6 +302,16 @@ double HTFProperties::Cp( double T_K )
 	Converted to c++ from Fortran code Type 229 in November 2012 by Ty Neises
 	Original author: Michael J. Wagner */
 
+	if (m_cp_poly_n > 0)
+	{
+		double x = T_K - m_cp_poly_T_ref;
+		double cp = m_cp_poly[m_cp_poly_n - 1];
+		for (int k = m_cp_poly_n - 2; k >= 0; k--)
+			cp = cp*x + m_cp_poly[k];
+		return cp;
+	}
+
+	// Correlations below that are polynomials are also listed in set_cp_kernel()
 	double T_C = T_K - 273.15;		// Also provide temperature in C
 
 	switch(m_fluid)
@@ -355,6 +398,121 @@ double HTFProperties::Cp( double T_K )
 	}
 }
 
+void HTFProperties::Cp(const double *T_K, double *cp, int n)
+{
+	if (m_cp_poly_n > 0)
+	{
+		for (int i = 0; i < n; i++)
+		{
+			double x = T_K[i] - m_cp_poly_T_ref;
+			double cp_i = m_cp_poly[m_cp_poly_n - 1];
+			for (int k = m_cp_poly_n - 2; k >= 0; k--)
+				cp_i = cp_i*x + m_cp_poly[k];
+			cp[i] = cp_i;
+		}
+		return;
+	}
+
+	for (int i = 0; i < n; i++)
+		cp[i] = Cp(T_K[i]);
+}
+
+void HTFProperties::Cp_ave(const double *T_cold_K, const double *T_hot_K, double *cp_ave, int n)
+{
+	for (int i = 0; i < n; i++)
+		cp_ave[i] = Cp_ave(T_cold_K[i], T_hot_K[i]);
+}
+
+void HTFProperties::set_cp_kernel()
+{
+	// Coefficients in increasing order, copied from the correlations in Cp()
+	struct S_cp_poly
+	{
+		int n;
+		double T_ref;	//[K]
+		double c[5];
+	};
+
+	const double T_ref_C = 273.15;	//[K] Reference for correlations in C
+	S_cp_poly poly = { 0, 0.0, { 0.0, 0.0, 0.0, 0.0, 0.0 } };
+
+	switch (m_fluid)
+	{
+	case Air:							poly = { 4, 0.0, { 1.03749, -0.000305497, 7.49335E-07, -3.39363E-10 } }; break;
+	case Stainless_AISI316:				poly = { 3, 0.0, { 0.368455, 0.000399548, -1.70558E-07 } }; break;
+	case Water_liquid:					poly = { 1, 0.0, { 4.181 } }; break;
+	case Salt_68_KCl_32_MgCl2:			poly = { 3, T_ref_C, { 1.0091, -1.2203E-05, 1.9700E-08 } }; break;
+	case Salt_8_NaF_92_NaBF4:			poly = { 1, 0.0, { 1.507 } }; break;
+	case Salt_25_KF_75_KBF4:			poly = { 1, 0.0, { 1.306 } }; break;
+	case Salt_31_RbF_69_RbBF4:			poly = { 1, 0.0, { 9.127 } }; break;
+	case Salt_465_LiF_115_NaF_42KF:		poly = { 1, 0.0, { 2.010 } }; break;
+	case Salt_49_LiF_29_NaF_29_ZrF4:	poly = { 1, 0.0, { 1.239 } }; break;
+	case Salt_58_KF_42_ZrF4:			poly = { 1, 0.0, { 1.051 } }; break;
+	case Salt_58_LiCl_42_RbCl:			poly = { 1, 0.0, { 8.918 } }; break;
+	case Salt_58_NaCl_42_MgCl2:			poly = { 1, 0.0, { 1.080 } }; break;
+	case Salt_595_LiCl_405_KCl:			poly = { 1, 0.0, { 1.202 } }; break;
+	case Salt_595_NaF_405_ZrF4:			poly = { 1, 0.0, { 1.172 } }; break;
+	case Salt_60_NaNO3_40_KNO3:			poly = { 4, 0.0, { 1.4387, 5E-06, 2E-07, -1E-10 } }; break;
+	case Nitrate_Salt:					poly = { 2, T_ref_C, { 1.443, 0.000172 } }; break;
+	case Caloria_HT_43:					poly = { 2, T_ref_C, { 1.606, 0.00388 } }; break;
+	case Therminol_VP1:					poly = { 3, T_ref_C, { 1.509, 0.002496, 0.0000007888 } }; break;
+	case Hitec:							poly = { 1, 0.0, { 1.560 } }; break;
+	case Dowtherm_Q:					poly = { 3, T_ref_C, { 1.5892, 0.0032028, -0.00000053943 } }; break;
+	case Dowtherm_RP:					poly = { 3, T_ref_C, { 1.5608, 0.002977, -0.0000000031915 } }; break;
+	case Argon_ideal:					poly = { 1, 0.0, { 0.5203 } }; break;
+	case T91_Steel:						poly = { 3, T_ref_C, { 450.08, 0.2473, 0.0004 } }; break;
+	case Therminol_66:					poly = { 2, T_ref_C, { 1.4801, 0.0036 } }; break;
+	case Therminol_59:					poly = { 2, T_ref_C, { 1.6132, 0.0033 } }; break;
+	case Pressurized_Water:				poly = { 3, T_ref_C, { 4.2092, -0.0014, 1.E-5 } }; break;
+	case Methanol:						poly = { 3, T_ref_C, { 2.3996, 0.0047, 3.E-5 } }; break;
+	case N06230:						poly = { 2, T_ref_C, { 397.42, 0.2888 } }; break;
+	case N07740:						poly = { 5, T_ref_C, { 434.06, 0.6218, -0.0022, 3.E-6, -1.E-9 } }; break;
+	case Salt_45MgCl2_39KCl_16NaCl:		poly = { 3, T_ref_C, { 1.661, -1.843E-3, 1.284E-6 } }; break;
+	default:
+		// Hitec_XL and Hydrogen_ideal are clipped, user-defined fluids are tabulated
+		break;
+	}
+
+	m_cp_poly_n = poly.n;
+	m_cp_poly_T_ref = poly.T_ref;
+	for (int k = 0; k < 5; k++)
+		m_cp_poly[k] = poly.c[k];
+}
+
+double HTFProperties::Cp_ave_user_table(double T_cold_K, double T_hot_K)
+{
+	// Cp is linear between table rows (and extrapolated past the end rows), so the average
+	// is exact as the sum of trapezoids over the rows spanned by the interval
+	int n_rows = (int)m_userTable.nrows();
+	double x_a = std::min(T_cold_K, T_hot_K) - 273.15;	//[C]
+	double x_b = std::max(T_cold_K, T_hot_K) - 273.15;	//[C]
+
+	int j = 0;
+	while (j < n_rows - 2 && m_userTable(j + 1, 0) <= x_a)
+		j++;
+
+	double integral = 0.0;
+	double x_lo = x_a;
+	while (true)
+	{
+		double x_j = m_userTable(j, 0);
+		double dcp_dx = (m_userTable(j + 1, 1) - m_userTable(j, 1)) / (m_userTable(j + 1, 0) - x_j);
+		double x_hi = j < n_rows - 2 ? std::min(x_b, m_userTable(j + 1, 0)) : x_b;
+
+		integral += (m_userTable(j, 1) + dcp_dx*(0.5*(x_lo + x_hi) - x_j))*(x_hi - x_lo);
+
+		if (x_hi >= x_b)
+			break;
+		x_lo = x_hi;
+		j++;
+	}
+
+	if (x_b > x_a)
+		return integral / (x_b - x_a);
+
+	return Cp(T_cold_K);
+}
+
 double HTFProperties::dens(double T_K, double P)
 {
 	/*Inputs: temperature [K] pressure [Pa]
@@ -122,6 +122,10 @@ public:
 	//               rather than at the range's midpoint
 	double Cp_ave(double T_cold_K, double T_hot_K);
 
+	// Array variants for node loops
+	void Cp(const double *T_K, double *cp, int n);		//[kJ/kg-K]
+	void Cp_ave(const double *T_cold_K, const double *T_hot_K, double *cp_ave, int n);	//[kJ/kg-K]
+
 	const util::matrix_t<double> *get_prop_table();
 	//bool equals(const util::matrix_t<double> *comp_table);
 	bool equals(HTFProperties *comp_class);
@@ -139,6 +143,14 @@ private:
 
 	std::string uf_err_msg;	//Error message when the user HTF table is invalid
     int m_integration_points = 5;
+
+	// Specific heat kernel resolved once when the fluid is set. Library correlations that are
+	// polynomials are stored as coefficients so that Cp_ave can be integrated in closed form
+	void set_cp_kernel();
+	double Cp_ave_user_table(double T_cold_K, double T_hot_K);
+	int m_cp_poly_n;			//[-] Number of Cp polynomial coefficients, 0 if Cp is not a polynomial
+	double m_cp_poly[5];		//[kJ/kg-K] Coefficients in increasing order of (T_K - m_cp_poly_T_ref)
+	double m_cp_poly_T_ref;		//[K] 0 for correlations in K, 273.15 for correlations in C
 };
 
 class AbsorberProps
@@ -2849,3 +2849,170 @@ void Evacuated_Receiver::EvacReceiver(double T_1_in, double m_dot, double T_amb,
 	m_T_save.at(4,0) = T_5;
 
 }
+
+C_hce_heat_loss_surrogate::C_hce_heat_loss_surrogate()
+{
+	for (int d = 0; d < N_AXES; d++)
+		m_stride[d] = 0;
+
+	m_max_abs_err = m_max_rel_err = std::numeric_limits<double>::quiet_NaN();
+}
+
+void C_hce_heat_loss_surrogate::default_axes(double T_htf_min /*K*/, double T_htf_max /*K*/, double q_opt_max /*W/m*/,
+	double m_dot_min /*kg/s*/, double m_dot_max /*kg/s*/, std::vector<double> (&axes)[N_AXES])
+{
+	// Heat loss is strongly nonlinear in the HTF temperature and close to linear in the remaining inputs except at low wind speed
+	int n_T = std::max(2, (int)std::ceil((T_htf_max - T_htf_min) / 25.0) + 1);
+	axes[E_T_HTF].resize(n_T);
+	for (int i = 0; i < n_T; i++)
+		axes[E_T_HTF][i] = T_htf_min + (T_htf_max - T_htf_min)*(double)i / (double)(n_T - 1);	//[K]
+
+	q_opt_max = std::max(q_opt_max, 1.0);
+	axes[E_Q_OPT] = { 0.0, q_opt_max / 3.0, 2.0*q_opt_max / 3.0, q_opt_max };	//[W/m]
+	// Convection off the envelope changes over from natural to forced in the first couple of m/s: cluster the low wind speeds
+	axes[E_V_WIND] = { 0.0, 0.5, 1.0, 2.0, 3.5, 5.0, 10.0, 20.0 };				//[m/s]
+	axes[E_T_AMB] = { 243.15, 273.15, 303.15, 333.15 };							//[K]
+	axes[E_DT_SKY] = { 0.0, 15.0, 30.0, 45.0 };									//[K]
+
+	// Mass flow sets the HTF-side film coefficient, which goes roughly as m_dot^0.8: space the points geometrically
+	m_dot_max = std::max(m_dot_max, 1.E-3);
+	if (!(m_dot_min > 0.0 && m_dot_min < m_dot_max))
+		m_dot_min = 0.1*m_dot_max;
+	int n_m_dot = 6;
+	axes[E_M_DOT].resize(n_m_dot);
+	for (int i = 0; i < n_m_dot; i++)
+		axes[E_M_DOT][i] = m_dot_min*pow(m_dot_max / m_dot_min, (double)i / (double)(n_m_dot - 1));	//[kg/s]
+	axes[E_M_DOT][n_m_dot - 1] = m_dot_max;
+}
+
+void C_hce_heat_loss_surrogate::build(const std::vector<double> (&axes)[N_AXES], const hl_model & model, int n_validate_max)
+{
+	size_t n_nodes = 1;
+	size_t n_cells = 1;
+	for (int d = 0; d < N_AXES; d++)
+	{
+		if (axes[d].size() < 2)
+			throw(C_csp_exception("Each axis of the receiver heat loss table requires at least two points", "C_hce_heat_loss_surrogate::build"));
+		mv_axes[d] = axes[d];
+		m_stride[d] = n_nodes;
+		n_nodes *= axes[d].size();
+		n_cells *= axes[d].size() - 1;
+	}
+
+	std::vector<double> values(n_nodes*N_OUTPUTS);
+	double x[N_AXES];
+	double q_heatloss_max = 0.0;
+	for (size_t node = 0; node < n_nodes; node++)
+	{
+		for (int d = 0; d < N_AXES; d++)
+			x[d] = mv_axes[d][(node / m_stride[d]) % mv_axes[d].size()];
+
+		model(x, &values[node*N_OUTPUTS]);
+		q_heatloss_max = std::max(q_heatloss_max, std::abs(values[node*N_OUTPUTS + E_Q_HEATLOSS]));
+	}
+	mv_values.swap(values);
+
+	// Multilinear error is largest near cell midpoints. Sample a scattered subset of cells
+	// (multiplicative hash of the cell index) so that every axis is covered
+	size_t n_validate = std::min(n_cells, (size_t)std::max(n_validate_max, 1));
+	double y_model[N_OUTPUTS], y_interp[N_OUTPUTS];
+	m_max_abs_err = 0.0;
+	for (size_t k = 0; k < n_validate; k++)
+	{
+		size_t cell = n_validate == n_cells ? k : (size_t)((k * 2654435761ULL) % n_cells);
+		for (int d = 0; d < N_AXES; d++)
+		{
+			size_t n_cells_d = mv_axes[d].size() - 1;
+			size_t i = cell % n_cells_d;
+			cell /= n_cells_d;
+			x[d] = 0.5*(mv_axes[d][i] + mv_axes[d][i + 1]);
+		}
+
+		model(x, y_model);
+		interpolate(x, y_interp);
+		m_max_abs_err = std::max(m_max_abs_err, std::abs(y_model[E_Q_HEATLOSS] - y_interp[E_Q_HEATLOSS]));
+	}
+	m_max_rel_err = q_heatloss_max > 0.0 ? m_max_abs_err / q_heatloss_max : 0.0;
+}
+
+bool C_hce_heat_loss_surrogate::interpolate(const double *x, double *y) const
+{
+	if (mv_values.empty())
+		return false;
+
+	size_t i_low[N_AXES];
+	double w_high[N_AXES];
+	for (int d = 0; d < N_AXES; d++)
+	{
+		const std::vector<double> & ax = mv_axes[d];
+		if (!(x[d] >= ax.front() && x[d] <= ax.back()))		// also rejects NaN
+			return false;
+
+		size_t i = std::upper_bound(ax.begin(), ax.end(), x[d]) - ax.begin();
+		i = std::min(std::max(i, (size_t)1), ax.size() - 1) - 1;
+		i_low[d] = i;
+		w_high[d] = (x[d] - ax[i]) / (ax[i + 1] - ax[i]);
+	}
+
+	for (int k = 0; k < N_OUTPUTS; k++)
+		y[k] = 0.0;
+
+	// Sum over the 2^N_AXES corners of the enclosing cell
+	for (int corner = 0; corner < (1 << N_AXES); corner++)
+	{
+		double w = 1.0;
+		size_t node = 0;
+		for (int d = 0; d < N_AXES; d++)
+		{
+			bool is_high = ((corner >> d) & 1) != 0;
+			w *= is_high ? w_high[d] : 1.0 - w_high[d];
+			node += (i_low[d] + (is_high ? 1 : 0))*m_stride[d];
+		}
+		if (w == 0.0)
+			continue;
+
+		const double *v = &mv_values[node*N_OUTPUTS];
+		for (int k = 0; k < N_OUTPUTS; k++)
+			y[k] += w*v[k];
+	}
+
+	return true;
+}
+
+bool C_hce_heat_loss_surrogate::energy_balance(double T_1_in /*K*/, double m_dot /*kg/s*/, double T_amb /*K*/, double T_sky /*K*/, double v_6 /*m/s*/,
+	double q_opt /*W/m*/, double q_3SolAbs /*W/m*/, double L /*m*/, HTFProperties & htfProps,
+	//outputs
+	double &q_heatloss, double &q_12conv, double &q_34tot, double &c_1ave, double &rho_1ave) const
+{
+	if (!(m_dot > 0.0))
+		return false;
+
+	double x[N_AXES], y[N_OUTPUTS];
+	x[E_Q_OPT] = q_opt;
+	x[E_V_WIND] = v_6;
+	x[E_T_AMB] = T_amb;
+	x[E_DT_SKY] = T_amb - T_sky;
+	x[E_M_DOT] = m_dot;
+
+	// The table is indexed by the average HTF temperature: evaluate at the inlet, estimate the outlet, and re-evaluate at the average
+	double T_1_ave = T_1_in;
+	double cp_1 = htfProps.Cp(T_1_ave)*1000.;	//[J/kg-K]
+	for (int pass = 0; pass < 2; pass++)
+	{
+		x[E_T_HTF] = T_1_ave;
+		if (!interpolate(x, y))
+			return false;
+
+		q_12conv = q_3SolAbs - y[E_Q_ABS_LOSS];		//[W/m]
+		double T_1_out = std::max(T_sky, q_12conv*L / (m_dot*cp_1) + T_1_in);
+		T_1_ave = 0.5*(T_1_out + T_1_in);
+		cp_1 = htfProps.Cp(T_1_ave)*1000.;
+	}
+
+	q_heatloss = y[E_Q_HEATLOSS];
+	q_34tot = y[E_Q_34TOT];
+	c_1ave = cp_1 / 1000.;							//[kJ/kg-K]
+	rho_1ave = htfProps.dens(T_1_ave, 0.0);			//[kg/m^3]
+
+	return true;
+}
@@ -40,6 +40,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "htf_props.h"
 
 #include <memory>
+#include <functional>
 
 using namespace std;
 
@@ -589,6 +590,69 @@ public:
 	double FK_23(double T_2, double T_3, int hn, int hv);
 };
 
+class C_hce_heat_loss_surrogate
+{
+	// Tabulated heat loss of one HCE variant, built once from the detailed receiver energy balance
+	// and evaluated with multilinear interpolation on a rectilinear grid. Queries outside the
+	// tabulated range return false so that the caller can fall back to the detailed model.
+public:
+
+	enum E_axes
+	{
+		E_T_HTF,		//[K] Average HTF temperature in the element
+		E_Q_OPT,		//[W/m] Incident flux per unit length after all optical losses
+		E_V_WIND,		//[m/s] Wind speed
+		E_T_AMB,		//[K] Ambient temperature
+		E_DT_SKY,		//[K] Sky depression: T_amb - T_sky
+		E_M_DOT,		//[kg/s] HTF mass flow rate through the receiver
+
+		N_AXES
+	};
+
+	enum E_outputs
+	{
+		E_Q_HEATLOSS,	//[W/m] Total receiver heat loss
+		E_Q_34TOT,		//[W/m] Heat loss from the absorber surface
+		E_Q_ABS_LOSS,	//[W/m] Absorbed solar energy not transferred to the HTF (q_3SolAbs - q_12conv)
+
+		N_OUTPUTS
+	};
+
+	// Detailed model: fills y[N_OUTPUTS] at x[N_AXES]
+	typedef std::function<void(const double *x, double *y)> hl_model;
+
+	C_hce_heat_loss_surrogate();
+
+	// Tabulates 'model' at every node of 'axes' and checks the interpolation error at up to 'n_validate_max' cell midpoints
+	void build(const std::vector<double> (&axes)[N_AXES], const hl_model & model, int n_validate_max = 256);
+
+	bool is_built() const { return !mv_values.empty(); }
+
+	bool interpolate(const double *x, double *y) const;
+
+	// Receiver energy balance over an element of length 'L' using the tabulated heat loss
+	bool energy_balance(double T_1_in /*K*/, double m_dot /*kg/s*/, double T_amb /*K*/, double T_sky /*K*/, double v_6 /*m/s*/,
+		double q_opt /*W/m*/, double q_3SolAbs /*W/m*/, double L /*m*/, HTFProperties & htfProps,
+		//outputs
+		double &q_heatloss, double &q_12conv, double &q_34tot, double &c_1ave, double &rho_1ave) const;
+
+	double get_max_abs_error() const { return m_max_abs_err; }	//[W/m] Largest heat loss error found at the validation points
+	double get_max_rel_error() const { return m_max_rel_err; }	//[-] Largest heat loss error relative to the largest tabulated heat loss
+	int get_n_nodes() const { return (int)(mv_values.size() / N_OUTPUTS); }
+
+	static void default_axes(double T_htf_min /*K*/, double T_htf_max /*K*/, double q_opt_max /*W/m*/,
+		double m_dot_min /*kg/s*/, double m_dot_max /*kg/s*/, std::vector<double> (&axes)[N_AXES]);
+
+private:
+
+	std::vector<double> mv_axes[N_AXES];
+	size_t m_stride[N_AXES];			//[-] Node index stride of each axis, first axis varies fastest
+	std::vector<double> mv_values;		//[W/m] N_OUTPUTS values per node
+
+	double m_max_abs_err;
+	double m_max_rel_err;
+};
+
 
 
 class C_evap_tower
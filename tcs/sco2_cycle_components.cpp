@@ -2,6 +2,10 @@
 #include "CO2_properties.h"
 #include <limits>
 #include <algorithm>
+#include <thread>
+#include <mutex>
+#include <atomic>
+#include <exception>
 
 #include "numeric_solvers.h"
 #include "csp_solver_core.h"
@@ -739,6 +743,60 @@ int Ts_full_dome(double T_cold /*C*/, std::vector<double> & T_data /*C*/, std::v
 	}
 }
 
+void sco2_parallel_for(int n_tasks, int n_threads, const std::function<void(int)> & f)
+{
+	n_threads = std::max(1, std::min(n_threads, n_tasks));
+
+	if (n_threads == 1)
+	{
+		for (int i = 0; i < n_tasks; i++)
+		{
+			f(i);
+		}
+		return;
+	}
+
+	std::atomic<int> next_task(0);
+	std::exception_ptr p_exception;
+	std::mutex exception_mutex;
+
+	auto run_tasks = [&]()
+	{
+		for (int i = next_task++; i < n_tasks; i = next_task++)
+		{
+			try
+			{
+				f(i);
+			}
+			catch (...)
+			{
+				std::lock_guard<std::mutex> lock(exception_mutex);
+				if (!p_exception)
+					p_exception = std::current_exception();
+			}
+		}
+	};
+
+	std::vector<std::thread> v_threads;
+	for (int i = 1; i < n_threads; i++)
+	{
+		v_threads.push_back(std::thread(run_tasks));
+	}
+
+	// The calling thread takes tasks too
+	run_tasks();
+
+	for (size_t i = 0; i < v_threads.size(); i++)
+	{
+		v_threads[i].join();
+	}
+
+	if (p_exception)
+	{
+		std::rethrow_exception(p_exception);
+	}
+}
+
 int Ph_dome(double P_low /*MPa*/, std::vector<double> & P_data /*MPa*/, std::vector<double> & h_data)
 {
 	CO2_info t_co2_info;
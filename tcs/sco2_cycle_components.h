@@ -3,6 +3,7 @@
 
 #include <vector>
 #include <memory>
+#include <functional>
 
 #include "numeric_solvers.h"
 #include "CO2_properties.h"
@@ -71,6 +72,10 @@ int Ts_full_dome(double T_cold /*C*/, std::vector<double> & T_data /*C*/, std::v
 
 int Ph_dome(double P_low /*MPa*/, std::vector<double> & P_data /*MPa*/, std::vector<double> & h_data);
 
+// Call 'f' once for each task index in [0, n_tasks) using up to 'n_threads' threads
+//   The first exception thrown by a task is rethrown once all threads have finished
+void sco2_parallel_for(int n_tasks, int n_threads, const std::function<void(int)> & f);
+
 class C_MEQ_CO2_props_at_2phase_P : public C_monotonic_equation
 {
 private:
@@ -139,6 +139,8 @@ public:
         double m_f_PR_HP_to_IP_guess;       //[-] Initial guess fraction of HP-to-LP deltaP for HP-to-IP (partial cooling cycle)
         bool m_fixed_f_PR_HP_to_IP;         //[-] if true, use guess
 
+		int m_n_multi_start_threads;		//[-] > 1: optimize from several starting points, solved in parallel on this many threads
+
 		// Callback function only log
 		bool(*mf_callback_log)(std::string &log_msg, std::string &progress_msg, void *data, double progress, int out_type);
 		void *mp_mf_active;
@@ -170,6 +172,8 @@ public:
             m_fixed_PR_HP_to_LP = false;    //[-] If false, then should default to optimizing this parameter
             m_fixed_f_PR_HP_to_IP = false;  //[-] If false, then should default to optimizing this parameter
 
+            m_n_multi_start_threads = 1;    //[-] Single starting point
+
 			mf_callback_log = 0;
 			mp_mf_active = 0;
 
@@ -219,6 +223,8 @@ public:
 		int m_des_objective_type;		//[2] = min phx deltat then max eta, [else] max eta
 		double m_min_phx_deltaT;		//[C]
 
+		int m_n_multi_start_threads;	//[-] > 1: optimize from several starting points, solved in parallel on this many threads
+
 		// Callback function only log
 		bool(*mf_callback_log)(std::string &log_msg, std::string &progress_msg, void *data, double progress, int out_type);
 		void *mp_mf_active;
@@ -247,6 +253,8 @@ public:
             m_fixed_PR_HP_to_LP = false;    //[-] If false, then should default to optimizing this parameter
             m_fixed_f_PR_HP_to_IP = false;  //[-] If false, then should default to optimizing this parameter
 
+            m_n_multi_start_threads = 1;    //[-] Single starting point
+
 			// Default to standard optimization to maximize cycle efficiency
 			m_des_objective_type = 1;
 			m_min_phx_deltaT = 0.0;		//[C]
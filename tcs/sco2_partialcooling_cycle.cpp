@@ -464,56 +464,150 @@ int C_PartialCooling_Cycle::C_MEQ_LTR_des::operator()(double T_LTR_LP_out /*K*/,
 double C_PartialCooling_Cycle::opt_eta_fixed_P_high(double P_high_opt /*kPa*/)
 {
 	// Complete 'ms_opt_des_par'
-	ms_opt_des_par.m_P_mc_out_guess = P_high_opt;	//[kPa]
-	ms_opt_des_par.m_fixed_P_mc_out = true;
+	S_opt_des_params opt_des_par = ms_opt_des_par;
+	opt_des_par.m_P_mc_out_guess = P_high_opt;	//[kPa]
+	opt_des_par.m_fixed_P_mc_out = true;
 
-	ms_opt_des_par.m_fixed_PR_total = false;
-	ms_opt_des_par.m_PR_total_guess = 25. / 6.5;	//[-] Guess could be improved...
+	opt_des_par.m_fixed_PR_total = false;
+	opt_des_par.m_PR_total_guess = 25. / 6.5;	//[-] Guess could be improved...
 
     if (ms_auto_opt_des_par.m_fixed_f_PR_HP_to_IP)
     {
-        ms_opt_des_par.m_fixed_f_PR_mc = true;
-        ms_opt_des_par.m_f_PR_mc_guess = ms_auto_opt_des_par.m_fixed_f_PR_HP_to_IP; //[-]
+        opt_des_par.m_fixed_f_PR_mc = true;
+        opt_des_par.m_f_PR_mc_guess = ms_auto_opt_des_par.m_fixed_f_PR_HP_to_IP; //[-]
     }
     else
     {
-        ms_opt_des_par.m_fixed_f_PR_mc = false;
-        ms_opt_des_par.m_f_PR_mc_guess = (25. - 8.5) / (25. - 6.5);		//[-] Guess could be improved...
+        opt_des_par.m_fixed_f_PR_mc = false;
+        opt_des_par.m_f_PR_mc_guess = (25. - 8.5) / (25. - 6.5);		//[-] Guess could be improved...
     }
 
     // Is the recompression fraction fixed or optimized?
     if (ms_auto_opt_des_par.m_is_recomp_ok < 0.0)
     {
-        ms_opt_des_par.m_recomp_frac_guess = std::abs(ms_auto_opt_des_par.m_is_recomp_ok);  //[-]
-        ms_opt_des_par.m_fixed_recomp_frac = true;
+        opt_des_par.m_recomp_frac_guess = std::abs(ms_auto_opt_des_par.m_is_recomp_ok);  //[-]
+        opt_des_par.m_fixed_recomp_frac = true;
     }
     else
     {
-        ms_opt_des_par.m_recomp_frac_guess = 0.25;	//[-]
-        ms_opt_des_par.m_fixed_recomp_frac = false;
+        opt_des_par.m_recomp_frac_guess = 0.25;	//[-]
+        opt_des_par.m_fixed_recomp_frac = false;
     }	
 
-	ms_opt_des_par.m_LTR_frac_guess = 0.5;		//[-]
-	ms_opt_des_par.m_fixed_LTR_frac = false;
+	opt_des_par.m_LTR_frac_guess = 0.5;		//[-]
+	opt_des_par.m_fixed_LTR_frac = false;
 
-    if (ms_opt_des_par.m_LTR_target_code != NS_HX_counterflow_eqs::OPTIMIZE_UA || ms_opt_des_par.m_HTR_target_code != NS_HX_counterflow_eqs::OPTIMIZE_UA)
+    if (opt_des_par.m_LTR_target_code != NS_HX_counterflow_eqs::OPTIMIZE_UA || opt_des_par.m_HTR_target_code != NS_HX_counterflow_eqs::OPTIMIZE_UA)
     {
-        ms_opt_des_par.m_fixed_LTR_frac = true;
+        opt_des_par.m_fixed_LTR_frac = true;
     }
 
-	int pc_error_code = opt_design_core();
+	std::vector<S_opt_des_params> v_opt_des_par(1, opt_des_par);
+	add_multi_starts(v_opt_des_par);
 
-	double local_objective_metric = 0.0;
-	if (pc_error_code == 0)
-		local_objective_metric = m_objective_metric_opt;
+	return -opt_design_starts(v_opt_des_par);
+}
+
+void C_PartialCooling_Cycle::add_multi_starts(std::vector<S_opt_des_params> & v_opt_des_par)
+{
+	// Adds alternate starting points around the last entry of 'v_opt_des_par'
+	if (ms_auto_opt_des_par.m_n_multi_start_threads <= 1 || v_opt_des_par.empty())
+		return;
 
-	if (pc_error_code == 0 && m_objective_metric_opt > m_objective_metric_auto_opt)
+	S_opt_des_params opt_des_par_base = v_opt_des_par.back();
+
+	if (!opt_des_par_base.m_fixed_recomp_frac)
 	{
-		ms_des_par_auto_opt = ms_des_par_optimal;
-		m_objective_metric_auto_opt = m_objective_metric_opt;
+		double recomp_frac_starts[2] = {0.1, 0.45};
+		for (int i = 0; i < 2; i++)
+		{
+			v_opt_des_par.push_back(opt_des_par_base);
+			v_opt_des_par.back().m_recomp_frac_guess = recomp_frac_starts[i];	//[-]
+		}
 	}
 
-	return -local_objective_metric;
+	if (!opt_des_par_base.m_fixed_LTR_frac)
+	{
+		double LTR_frac_starts[2] = {0.3, 0.7};
+		for (int i = 0; i < 2; i++)
+		{
+			v_opt_des_par.push_back(opt_des_par_base);
+			v_opt_des_par.back().m_LTR_frac_guess = LTR_frac_starts[i];	//[-]
+		}
+	}
+}
+
+double C_PartialCooling_Cycle::opt_design_starts(const std::vector<S_opt_des_params> & v_opt_des_par)
+{
+	// Runs 'opt_design_core' from each starting point, updates 'ms_des_par_auto_opt' with the best result,
+	//   and returns the best objective metric (0 if no start solved)
+	int n_starts = (int)v_opt_des_par.size();
+
+	std::vector<int> v_error_code(n_starts, 0);
+	std::vector<double> v_objective_metric(n_starts, 0.0);
+	std::vector<S_des_params> v_des_par_optimal(n_starts);
+
+	if (ms_auto_opt_des_par.m_n_multi_start_threads > 1 && n_starts > 1)
+	{
+		// Each starting point is solved by its own cycle so the optimizations are independent.
+		//   The cycles are kept through the auto-optimization so each can reuse its memoized designs
+		while ((int)mv_multi_start_cycles.size() < n_starts)
+		{
+			mv_multi_start_cycles.push_back(std::unique_ptr<C_PartialCooling_Cycle>(new C_PartialCooling_Cycle(m_turbo_gen_motor_config,
+				m_eta_generator,
+				m_T_mc_in,
+				m_W_dot_net,
+				m_T_t_in, m_P_high_limit,
+				m_DP_LTR, m_DP_HTR,
+				m_DP_PC_main, m_DP_PHX,
+				m_LTR_N_sub_hxrs, m_HTR_N_sub_hxrs,
+				m_eta_mc, m_mc_comp_model_code,
+				m_eta_rc,
+				m_eta_t, m_N_turbine,
+				m_frac_fan_power, m_eta_fan, m_deltaP_cooler_frac,
+				m_N_nodes_pass,
+				m_T_amb_des, m_elevation)));
+		}
+
+		sco2_parallel_for(n_starts, ms_auto_opt_des_par.m_n_multi_start_threads, [&](int i)
+		{
+			C_PartialCooling_Cycle *p_cycle = mv_multi_start_cycles[i].get();
+			p_cycle->ms_opt_des_par = v_opt_des_par[i];
+			v_error_code[i] = p_cycle->opt_design_core();
+			v_objective_metric[i] = p_cycle->m_objective_metric_opt;
+			v_des_par_optimal[i] = p_cycle->ms_des_par_optimal;
+		});
+
+		ms_opt_des_par = v_opt_des_par[n_starts - 1];
+	}
+	else
+	{
+		for (int i = 0; i < n_starts; i++)
+		{
+			ms_opt_des_par = v_opt_des_par[i];
+			v_error_code[i] = opt_design_core();
+			v_objective_metric[i] = m_objective_metric_opt;
+			v_des_par_optimal[i] = ms_des_par_optimal;
+		}
+	}
+
+	// Earlier starts win ties, as when the starts are solved in sequence
+	double objective_metric_max = 0.0;
+	for (int i = 0; i < n_starts; i++)
+	{
+		if (v_error_code[i] != 0)
+			continue;
+
+		objective_metric_max = std::max(objective_metric_max, v_objective_metric[i]);
+
+		if (v_objective_metric[i] > m_objective_metric_auto_opt)
+		{
+			ms_des_par_auto_opt = v_des_par_optimal[i];
+			m_objective_metric_auto_opt = v_objective_metric[i];
+		}
+	}
+
+	return objective_metric_max;
 }
 
 int C_PartialCooling_Cycle::finalize_design()
@@ -778,6 +872,26 @@ double C_PartialCooling_Cycle::design_cycle_return_objective_metric(const std::v
         ms_des_par.m_HTR_UA = ms_opt_des_par.m_HTR_UA;      //[kW/K]
     }
 	
+	// Optimizers often revisit points, and the P_high search re-runs from the same starting points, so check if this design has been solved
+	std::vector<double> memo_key(6);
+	memo_key[0] = ms_des_par.m_P_pc_in;		//[kPa]
+	memo_key[1] = ms_des_par.m_P_mc_in;		//[kPa]
+	memo_key[2] = ms_des_par.m_P_mc_out;	//[kPa]
+	memo_key[3] = ms_des_par.m_recomp_frac;	//[-]
+	memo_key[4] = ms_des_par.m_LTR_UA;		//[kW/K]
+	memo_key[5] = ms_des_par.m_HTR_UA;		//[kW/K]
+
+	std::map<std::vector<double>, S_design_memo>::const_iterator it_memo = mm_design_memo.find(memo_key);
+	if (it_memo != mm_design_memo.end())
+	{
+		if (it_memo->second.m_objective_metric > m_objective_metric_opt)
+		{
+			ms_des_par_optimal = it_memo->second.ms_des_par;
+			m_objective_metric_opt = it_memo->second.m_objective_metric;
+		}
+
+		return it_memo->second.m_objective_metric;
+	}
 
 	int des_err_code = design_core();
 
@@ -793,6 +907,11 @@ double C_PartialCooling_Cycle::design_cycle_return_objective_metric(const std::v
 		}
 	}
 
+	S_design_memo s_memo;
+	s_memo.m_objective_metric = objective_metric;
+	s_memo.ms_des_par = ms_des_par;
+	mm_design_memo[memo_key] = s_memo;
+
 	return objective_metric;
 }
 
@@ -939,6 +1058,8 @@ int C_PartialCooling_Cycle::opt_design(S_opt_des_params & opt_des_par_in)
 {
 	ms_opt_des_par = opt_des_par_in;
 
+	mm_design_memo.clear();
+
 	int opt_des_err_code = opt_design_core();
 
 	if (opt_des_err_code != 0)
@@ -996,6 +1117,10 @@ int C_PartialCooling_Cycle::auto_opt_design_core()
 	
 	ms_opt_des_par.m_fixed_PR_total = ms_auto_opt_des_par.m_fixed_PR_HP_to_LP;		//[-]
 
+	// Memoized designs depend on the parameters mapped above
+	mm_design_memo.clear();
+	mv_multi_start_cycles.clear();
+
 	// Outer optimization loop
 	m_objective_metric_auto_opt = 0.0;
 
@@ -1016,57 +1141,55 @@ int C_PartialCooling_Cycle::auto_opt_design_core()
 		// m_eta_thermal_opt;
 
 		// Complete 'ms_opt_des_par'
-	ms_opt_des_par.m_P_mc_out_guess = best_P_high;	//[kPa]
-	ms_opt_des_par.m_fixed_P_mc_out = true;
+	S_opt_des_params opt_des_par = ms_opt_des_par;
+	opt_des_par.m_P_mc_out_guess = best_P_high;	//[kPa]
+	opt_des_par.m_fixed_P_mc_out = true;
 
-	if (ms_opt_des_par.m_fixed_PR_total)
+	if (opt_des_par.m_fixed_PR_total)
 	{
-		ms_opt_des_par.m_PR_total_guess = ms_auto_opt_des_par.m_PR_HP_to_LP_guess;	//[-]
+		opt_des_par.m_PR_total_guess = ms_auto_opt_des_par.m_PR_HP_to_LP_guess;	//[-]
 	}
 	else
 	{
-		ms_opt_des_par.m_PR_total_guess = 25. / 6.5;	//[-] Guess could be improved...
+		opt_des_par.m_PR_total_guess = 25. / 6.5;	//[-] Guess could be improved...
 	}
 
     if (ms_auto_opt_des_par.m_fixed_f_PR_HP_to_IP)
     {
-        ms_opt_des_par.m_fixed_f_PR_mc = true;
-        ms_opt_des_par.m_f_PR_mc_guess = ms_auto_opt_des_par.m_f_PR_HP_to_IP_guess; //[-]
+        opt_des_par.m_fixed_f_PR_mc = true;
+        opt_des_par.m_f_PR_mc_guess = ms_auto_opt_des_par.m_f_PR_HP_to_IP_guess; //[-]
     }
     else
     {
-        ms_opt_des_par.m_fixed_f_PR_mc = false;
-        ms_opt_des_par.m_f_PR_mc_guess = (25. - 8.5) / (25. - 6.5);		//[-] Guess could be improved...
+        opt_des_par.m_fixed_f_PR_mc = false;
+        opt_des_par.m_f_PR_mc_guess = (25. - 8.5) / (25. - 6.5);		//[-] Guess could be improved...
     }
 	
 
     // Is recompression fraction fixed or optimized?
     if (ms_auto_opt_des_par.m_is_recomp_ok < 0.0)
     {
-        ms_opt_des_par.m_recomp_frac_guess = std::abs(ms_auto_opt_des_par.m_is_recomp_ok);  //[-]
-        ms_opt_des_par.m_fixed_recomp_frac = true;  
+        opt_des_par.m_recomp_frac_guess = std::abs(ms_auto_opt_des_par.m_is_recomp_ok);  //[-]
+        opt_des_par.m_fixed_recomp_frac = true;  
     }
     else
     {
-        ms_opt_des_par.m_recomp_frac_guess = 0.25;	//[-]
-        ms_opt_des_par.m_fixed_recomp_frac = false;
+        opt_des_par.m_recomp_frac_guess = 0.25;	//[-]
+        opt_des_par.m_fixed_recomp_frac = false;
     }	
 
-	ms_opt_des_par.m_LTR_frac_guess = 0.5;		//[-]
-	ms_opt_des_par.m_fixed_LTR_frac = false;
+	opt_des_par.m_LTR_frac_guess = 0.5;		//[-]
+	opt_des_par.m_fixed_LTR_frac = false;
 
-    if (ms_opt_des_par.m_LTR_target_code != NS_HX_counterflow_eqs::OPTIMIZE_UA || ms_opt_des_par.m_HTR_target_code != NS_HX_counterflow_eqs::OPTIMIZE_UA)
+    if (opt_des_par.m_LTR_target_code != NS_HX_counterflow_eqs::OPTIMIZE_UA || opt_des_par.m_HTR_target_code != NS_HX_counterflow_eqs::OPTIMIZE_UA)
     {
-        ms_opt_des_par.m_fixed_LTR_frac = true;
+        opt_des_par.m_fixed_LTR_frac = true;
     }
 
-	int pc_error_code = opt_design_core();
+	std::vector<S_opt_des_params> v_opt_des_par(1, opt_des_par);
+	add_multi_starts(v_opt_des_par);
 
-	if (pc_error_code == 0 && m_objective_metric_opt > m_objective_metric_auto_opt)
-	{
-		ms_des_par_auto_opt = ms_des_par_optimal;
-		m_objective_metric_auto_opt = m_objective_metric_opt;
-	}
+	opt_design_starts(v_opt_des_par);
 
 	ms_des_par = ms_des_par_auto_opt;
 
@@ -1123,6 +1246,8 @@ int C_PartialCooling_Cycle::auto_opt_design_hit_eta(S_auto_opt_design_hit_eta_pa
     ms_auto_opt_des_par.m_f_PR_HP_to_IP_guess = auto_opt_des_hit_eta_in.m_f_PR_HP_to_IP_guess;  //[-]
     ms_auto_opt_des_par.m_fixed_f_PR_HP_to_IP = auto_opt_des_hit_eta_in.m_fixed_f_PR_HP_to_IP;  //[-]
 
+	ms_auto_opt_des_par.m_n_multi_start_threads = auto_opt_des_hit_eta_in.m_n_multi_start_threads;	//[-]
+
 	// At this point, 'auto_opt_des_hit_eta_in' should only be used to access the targer thermal efficiency: 'm_eta_thermal'
 
 	double Q_dot_rec_des = m_W_dot_net / auto_opt_des_hit_eta_in.m_eta_thermal;		//[kWt] Receiver thermal input at design
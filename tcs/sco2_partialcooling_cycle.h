@@ -41,6 +41,8 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <string>
 #include <vector>
+#include <map>
+#include <memory>
 #include <math.h>
 #include <limits>
 
@@ -237,6 +239,18 @@ private:
 	double m_objective_metric_auto_opt;
 	S_des_params ms_des_par_auto_opt;
 
+		// Objective metrics already solved by 'design_cycle_return_objective_metric'
+		//   keyed on (P_pc_in, P_mc_in, P_mc_out, recomp_frac, LTR_UA, HTR_UA). Cleared by each optimization entry point
+	struct S_design_memo
+	{
+		double m_objective_metric;
+		S_des_params ms_des_par;
+	};
+	std::map<std::vector<double>, S_design_memo> mm_design_memo;
+
+		// Cycles that solve the optimizer starting points when multi-start is on. One per starting point
+	std::vector<std::unique_ptr<C_PartialCooling_Cycle>> mv_multi_start_cycles;
+
 	// Results from last off-design solution
 	std::vector<double> mv_temp_od, mv_pres_od, mv_enth_od, mv_entr_od, mv_dens_od;
 	double m_eta_thermal_od;
@@ -253,6 +267,10 @@ private:
 
 	int opt_design_core();
 
+	void add_multi_starts(std::vector<S_opt_des_params> & v_opt_des_par);
+
+	double opt_design_starts(const std::vector<S_opt_des_params> & v_opt_des_par);
+
 	int off_design_fix_shaft_speeds_core(double od_tol /*-*/);
 
 public:
@@ -200,6 +200,8 @@ void C_sco2_phx_air_cooler::design_core()
         ms_cycle_des_par.m_f_PR_HP_to_IP_guess = ms_des_par.m_f_PR_HP_to_IP_guess;      //[-]
         ms_cycle_des_par.m_fixed_f_PR_HP_to_IP = ms_des_par.m_fixed_f_PR_HP_to_IP;      //[-]
 
+		ms_cycle_des_par.m_n_multi_start_threads = ms_des_par.m_n_multi_start_threads;	//[-]
+
 		ms_cycle_des_par.mf_callback_log = mf_callback_update;
 		ms_cycle_des_par.mp_mf_active = mp_mf_update;
 
@@ -260,6 +262,8 @@ void C_sco2_phx_air_cooler::design_core()
         des_params.m_f_PR_HP_to_IP_guess = ms_des_par.m_f_PR_HP_to_IP_guess;    //[-]
         des_params.m_fixed_f_PR_HP_to_IP = ms_des_par.m_fixed_f_PR_HP_to_IP;    //[-]
 
+		des_params.m_n_multi_start_threads = ms_des_par.m_n_multi_start_threads;	//[-]
+
 		des_params.m_is_recomp_ok = ms_des_par.m_is_recomp_ok;
 
 		auto_err_code = mpc_sco2_cycle->auto_opt_design(des_params);
@@ -4857,17 +4861,49 @@ int C_sco2_phx_air_cooler::C_sco2_csp_od::operator()(S_f_inputs inputs, S_f_outp
 	return off_design_code;
 }
 
+std::unique_ptr<C_od_pc_function> C_sco2_phx_air_cooler::C_sco2_csp_od::clone_for_thread()
+{
+	// The cycle classes hold their component models by pointer, so design an
+	//    independent cycle from the same design parameters rather than copy this one
+	std::unique_ptr<C_sco2_phx_air_cooler> pc_sco2_rc(new C_sco2_phx_air_cooler());
+	pc_sco2_rc->m_is_T_crit_limit = mpc_sco2_rc->m_is_T_crit_limit;
+
+	try
+	{
+		pc_sco2_rc->design(mpc_sco2_rc->ms_des_par);
+	}
+	catch (C_csp_exception &)
+	{
+		return std::unique_ptr<C_od_pc_function>();
+	}
+
+	// Only use the clone if it solved the same design point
+	const C_sco2_cycle_core::S_design_solved & des_solved = mpc_sco2_rc->ms_des_solved.ms_rc_cycle_solved;
+	const C_sco2_cycle_core::S_design_solved & clone_solved = pc_sco2_rc->ms_des_solved.ms_rc_cycle_solved;
+	if (std::abs(clone_solved.m_W_dot_net - des_solved.m_W_dot_net) > 1.E-9*std::abs(des_solved.m_W_dot_net) ||
+		std::abs(clone_solved.m_eta_thermal - des_solved.m_eta_thermal) > 1.E-9*std::abs(des_solved.m_eta_thermal))
+	{
+		return std::unique_ptr<C_od_pc_function>();
+	}
+
+	C_sco2_csp_od *p_clone = new C_sco2_csp_od(pc_sco2_rc.get(), m_od_opt_tol, m_od_tol);
+	p_clone->mpc_sco2_rc_clone = std::move(pc_sco2_rc);
+
+	return std::unique_ptr<C_od_pc_function>(p_clone);
+}
+
 int C_sco2_phx_air_cooler::generate_ud_pc_tables(double T_htf_low /*C*/, double T_htf_high /*C*/, int n_T_htf /*-*/,
 	double T_amb_low /*C*/, double T_amb_high /*C*/, int n_T_amb /*-*/,
 	double m_dot_htf_ND_low /*-*/, double m_dot_htf_ND_high /*-*/, int n_m_dot_htf_ND,
 	util::matrix_t<double> & T_htf_ind, util::matrix_t<double> & T_amb_ind, util::matrix_t<double> & m_dot_htf_ND_ind,
-    double od_opt_tol /*-*/, double od_tol /*-*/)
+    double od_opt_tol /*-*/, double od_tol /*-*/, int n_threads /*-*/)
 {
 	C_sco2_csp_od c_sco2_csp(this, od_opt_tol, od_tol);
 	C_ud_pc_table_generator c_sco2_ud_pc(c_sco2_csp);
 
 	c_sco2_ud_pc.mf_callback = mf_callback_update;
 	c_sco2_ud_pc.mp_mf_active = mp_mf_update;
+	c_sco2_ud_pc.m_n_threads = n_threads;
 
 	double T_htf_ref = ms_des_par.m_T_htf_hot_in - 273.15;	//[C] convert from K
 	double T_amb_ref = ms_des_par.m_T_amb_des - 273.15;		//[C] convert from K
@@ -111,6 +111,8 @@ public:
         double m_f_PR_HP_to_IP_guess;   //[-] Initial guess fraction of HP-to-LP deltaP for HP-to-IP (partial cooling cycle)
         bool m_fixed_f_PR_HP_to_IP;     //[-] if true, use guess        
 
+		int m_n_multi_start_threads;	//[-] > 1: optimize the cycle design from several starting points, solved in parallel on this many threads
+
 		// PHX design parameters
 		// This is a PHX rather than system parameter because we don't know T_CO2_in until cycle model is solved
 		double m_phx_dt_cold_approach;	//[K/C] Temperature difference between cold HTF and PHX CO2 inlet
@@ -167,6 +169,7 @@ public:
             m_fixed_PR_HP_to_LP = false;    //[-] If false, then should default to optimizing this parameter
             m_fixed_f_PR_HP_to_IP = false;  //[-] If false, then should default to optimizing this parameter
 
+            m_n_multi_start_threads = 1;    //[-] Single starting point
 		}
 	};
 
@@ -594,6 +597,9 @@ public:
         double m_od_opt_tol;
         double m_od_tol;
 
+        // Cycle owned by a clone: designed from the same parameters as the original
+        std::unique_ptr<C_sco2_phx_air_cooler> mpc_sco2_rc_clone;
+
 	public:
 		C_sco2_csp_od(C_sco2_phx_air_cooler *pc_sco2_rc,
             double od_opt_tol /*-*/,
@@ -605,13 +611,15 @@ public:
 		}
 	
 		virtual int operator()(S_f_inputs inputs, S_f_outputs & outputs);
+
+		virtual std::unique_ptr<C_od_pc_function> clone_for_thread();
 	};
 
 	int generate_ud_pc_tables(double T_htf_low /*C*/, double T_htf_high /*C*/, int n_T_htf /*-*/,
 		double T_amb_low /*C*/, double T_amb_high /*C*/, int n_T_amb /*-*/,
 		double m_dot_htf_ND_low /*-*/, double m_dot_htf_ND_high /*-*/, int n_m_dot_htf_ND,
 		util::matrix_t<double> & T_htf_ind, util::matrix_t<double> & T_amb_ind, util::matrix_t<double> & m_dot_htf_ND_ind,
-        double od_opt_tol /*-*/, double od_tol /*-*/);
+        double od_opt_tol /*-*/, double od_tol /*-*/, int n_threads = 1 /*-*/);
 
 	void design(S_des_par des_par);
 
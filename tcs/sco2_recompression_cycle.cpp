@@ -2392,6 +2392,8 @@ void C_RecompCycle::opt_design(S_opt_design_parameters & opt_des_par_in, int & e
 {
 	ms_opt_des_par = opt_des_par_in;
 
+	mm_design_memo.clear();
+
 	error_code = 0;
 
 	opt_design_core(error_code);
@@ -2630,6 +2632,26 @@ double C_RecompCycle::design_cycle_return_objective_metric(const std::vector<dou
         ms_des_par.m_HTR_UA = ms_opt_des_par.m_HTR_UA;      //[kW/K]
     }
 
+	// Optimizers often revisit points, and the P_high search re-runs from the same starting points, so check if this design has been solved
+	std::vector<double> memo_key(5);
+	memo_key[0] = ms_des_par.m_P_mc_in;		//[kPa]
+	memo_key[1] = ms_des_par.m_P_mc_out;	//[kPa]
+	memo_key[2] = ms_des_par.m_recomp_frac;	//[-]
+	memo_key[3] = ms_des_par.m_LTR_UA;		//[kW/K]
+	memo_key[4] = ms_des_par.m_HTR_UA;		//[kW/K]
+
+	std::map<std::vector<double>, S_design_memo>::const_iterator it_memo = mm_design_memo.find(memo_key);
+	if (it_memo != mm_design_memo.end())
+	{
+		if (it_memo->second.m_objective_metric > m_objective_metric_opt)
+		{
+			ms_des_par_optimal = it_memo->second.ms_des_par;
+			m_objective_metric_opt = it_memo->second.m_objective_metric;
+		}
+
+		return it_memo->second.m_objective_metric;
+	}
+
 	int error_code = 0;
 
 	design_core(error_code);
@@ -2646,6 +2668,11 @@ double C_RecompCycle::design_cycle_return_objective_metric(const std::vector<dou
 		}
 	}
 
+	S_design_memo s_memo;
+	s_memo.m_objective_metric = objective_metric;
+	s_memo.ms_des_par = ms_des_par;
+	mm_design_memo[memo_key] = s_memo;
+
 	return objective_metric;
 }
 
@@ -2700,6 +2727,10 @@ void C_RecompCycle::auto_opt_design_core(int & error_code)
 	
 	ms_opt_des_par.m_fixed_PR_HP_to_LP = ms_auto_opt_des_par.m_fixed_PR_HP_to_LP;			//[-]
 
+	// Memoized designs depend on the parameters mapped above
+	mm_design_memo.clear();
+	mv_multi_start_cycles.clear();
+
 	// Outer optimization loop
 	m_objective_metric_auto_opt = 0.0;
 
@@ -2725,50 +2756,46 @@ void C_RecompCycle::auto_opt_design_core(int & error_code)
         }
 	}
 
+	std::vector<S_opt_design_parameters> v_opt_des_par;
+
 	if( ms_auto_opt_des_par.m_is_recomp_ok != 0 )
 	{
 		// Complete 'ms_opt_des_par' for recompression cycle
-		ms_opt_des_par.m_P_mc_out_guess = best_P_high;      //[kPa]
-		ms_opt_des_par.m_fixed_P_mc_out = true;
+		S_opt_design_parameters opt_des_par_rc = ms_opt_des_par;
+		opt_des_par_rc.m_P_mc_out_guess = best_P_high;      //[kPa]
+		opt_des_par_rc.m_fixed_P_mc_out = true;
 		
-		if (ms_opt_des_par.m_fixed_PR_HP_to_LP)
+		if (opt_des_par_rc.m_fixed_PR_HP_to_LP)
 		{
-			ms_opt_des_par.m_PR_HP_to_LP_guess = ms_auto_opt_des_par.m_PR_HP_to_LP_guess;	//[-]
+			opt_des_par_rc.m_PR_HP_to_LP_guess = ms_auto_opt_des_par.m_PR_HP_to_LP_guess;	//[-]
 		}
 		else
 		{
-			ms_opt_des_par.m_PR_HP_to_LP_guess = PR_mc_guess;		//[-]
+			opt_des_par_rc.m_PR_HP_to_LP_guess = PR_mc_guess;		//[-]
 		}
 
         // Is recompression fraction fixed or optimized?
         if (ms_auto_opt_des_par.m_is_recomp_ok < 0.0)
         {   // fixed
-            ms_opt_des_par.m_recomp_frac_guess = std::abs(ms_auto_opt_des_par.m_is_recomp_ok);
-            ms_opt_des_par.m_fixed_recomp_frac = true;
+            opt_des_par_rc.m_recomp_frac_guess = std::abs(ms_auto_opt_des_par.m_is_recomp_ok);
+            opt_des_par_rc.m_fixed_recomp_frac = true;
         }
         else
         {   // optimized
-            ms_opt_des_par.m_recomp_frac_guess = 0.3;
-            ms_opt_des_par.m_fixed_recomp_frac = false;
+            opt_des_par_rc.m_recomp_frac_guess = 0.3;
+            opt_des_par_rc.m_fixed_recomp_frac = false;
         }
 
-        ms_opt_des_par.m_LT_frac_guess = 0.5;
-		ms_opt_des_par.m_fixed_LT_frac = false;
+        opt_des_par_rc.m_LT_frac_guess = 0.5;
+		opt_des_par_rc.m_fixed_LT_frac = false;
 
-        if (ms_opt_des_par.m_LTR_target_code != NS_HX_counterflow_eqs::OPTIMIZE_UA || ms_opt_des_par.m_HTR_target_code != NS_HX_counterflow_eqs::OPTIMIZE_UA)
+        if (opt_des_par_rc.m_LTR_target_code != NS_HX_counterflow_eqs::OPTIMIZE_UA || opt_des_par_rc.m_HTR_target_code != NS_HX_counterflow_eqs::OPTIMIZE_UA)
         {
-            ms_opt_des_par.m_fixed_LT_frac = true;
+            opt_des_par_rc.m_fixed_LT_frac = true;
         }
 
-		int rc_error_code = 0;
-
-		opt_design_core(rc_error_code);
-
-		if( rc_error_code == 0 && m_objective_metric_opt > m_objective_metric_auto_opt )
-		{
-			ms_des_par_auto_opt = ms_des_par_optimal;
-			m_objective_metric_auto_opt = m_objective_metric_opt;
-		}
+		v_opt_des_par.push_back(opt_des_par_rc);
+		add_multi_starts(v_opt_des_par);
 	}
 
     // Is recompression fraction fixed or optimized?
@@ -2777,34 +2804,29 @@ void C_RecompCycle::auto_opt_design_core(int & error_code)
     {
 
         // Complete 'ms_opt_des_par' for simple cycle
-        ms_opt_des_par.m_P_mc_out_guess = best_P_high;      //[kPa]
-        ms_opt_des_par.m_fixed_P_mc_out = true;
+		S_opt_design_parameters opt_des_par_s = ms_opt_des_par;
+        opt_des_par_s.m_P_mc_out_guess = best_P_high;      //[kPa]
+        opt_des_par_s.m_fixed_P_mc_out = true;
 
-        if (ms_opt_des_par.m_fixed_PR_HP_to_LP)
+        if (opt_des_par_s.m_fixed_PR_HP_to_LP)
         {
-            ms_opt_des_par.m_PR_HP_to_LP_guess = ms_auto_opt_des_par.m_PR_HP_to_LP_guess;	//[-]
+            opt_des_par_s.m_PR_HP_to_LP_guess = ms_auto_opt_des_par.m_PR_HP_to_LP_guess;	//[-]
         }
         else
         {
-            ms_opt_des_par.m_PR_HP_to_LP_guess = PR_mc_guess;		//[-]
+            opt_des_par_s.m_PR_HP_to_LP_guess = PR_mc_guess;		//[-]
         }
 
-        ms_opt_des_par.m_recomp_frac_guess = 0.0;
-        ms_opt_des_par.m_fixed_recomp_frac = true;
-        ms_opt_des_par.m_LT_frac_guess = 1.0;
-        ms_opt_des_par.m_fixed_LT_frac = true;
-
-        int s_error_code = 0;
-
-        opt_design_core(s_error_code);
+        opt_des_par_s.m_recomp_frac_guess = 0.0;
+        opt_des_par_s.m_fixed_recomp_frac = true;
+        opt_des_par_s.m_LT_frac_guess = 1.0;
+        opt_des_par_s.m_fixed_LT_frac = true;
 
-        if (s_error_code == 0 && m_objective_metric_opt > m_objective_metric_auto_opt)
-        {
-            ms_des_par_auto_opt = ms_des_par_optimal;
-            m_objective_metric_auto_opt = m_objective_metric_opt;
-        }
+		v_opt_des_par.push_back(opt_des_par_s);
     }
 
+	opt_design_starts(v_opt_des_par);
+
 	ms_des_par = ms_des_par_auto_opt;
 
 	int optimal_design_error_code = 0;
@@ -2856,6 +2878,8 @@ int C_RecompCycle::auto_opt_design_hit_eta(S_auto_opt_design_hit_eta_parameters
 	ms_auto_opt_des_par.m_PR_HP_to_LP_guess = auto_opt_des_hit_eta_in.m_PR_HP_to_LP_guess;			//[-] Initial guess for ratio of P_mc_out to P_mc_in
 	ms_auto_opt_des_par.m_fixed_PR_HP_to_LP = auto_opt_des_hit_eta_in.m_fixed_PR_HP_to_LP;			//[-] if true, ratio of P_mc_out to P_mc_in is fixed at PR_mc_guess		
 
+	ms_auto_opt_des_par.m_n_multi_start_threads = auto_opt_des_hit_eta_in.m_n_multi_start_threads;	//[-]
+
 	// At this point, 'auto_opt_des_hit_eta_in' should only be used to access the targer thermal efficiency: 'm_eta_thermal'
 
 	double Q_dot_rec_des = m_W_dot_net / auto_opt_des_hit_eta_in.m_eta_thermal;		//[kWt] Receiver thermal input at design
@@ -3136,57 +3160,49 @@ double C_RecompCycle::opt_eta_fixed_P_high(double P_high_opt /*kPa*/)
 	if(P_high_opt > P_pseudocritical_1(m_T_mc_in))
 		PR_mc_guess = P_high_opt / P_pseudocritical_1(m_T_mc_in);
 		
-	double local_eta_rc = 0.0;
-    double local_eta_s = 0.0;
+	std::vector<S_opt_design_parameters> v_opt_des_par;
+
 	if( ms_auto_opt_des_par.m_is_recomp_ok != 0 )
 	{		 
 		// Complete 'ms_opt_des_par' for recompression cycle
-		ms_opt_des_par.m_P_mc_out_guess = P_high_opt;
-		ms_opt_des_par.m_fixed_P_mc_out = true;
+		S_opt_design_parameters opt_des_par_rc = ms_opt_des_par;
+		opt_des_par_rc.m_P_mc_out_guess = P_high_opt;
+		opt_des_par_rc.m_fixed_P_mc_out = true;
 		
-		//ms_opt_des_par.m_PR_HP_to_LP_guess = PR_mc_guess;
-		//ms_opt_des_par.m_fixed_PR_HP_to_LP = false;
-		ms_opt_des_par.m_fixed_PR_HP_to_LP = ms_auto_opt_des_par.m_fixed_PR_HP_to_LP;	//[-]
-		if (ms_opt_des_par.m_fixed_PR_HP_to_LP)
+		//opt_des_par_rc.m_PR_HP_to_LP_guess = PR_mc_guess;
+		//opt_des_par_rc.m_fixed_PR_HP_to_LP = false;
+		opt_des_par_rc.m_fixed_PR_HP_to_LP = ms_auto_opt_des_par.m_fixed_PR_HP_to_LP;	//[-]
+		if (opt_des_par_rc.m_fixed_PR_HP_to_LP)
 		{
-			ms_opt_des_par.m_PR_HP_to_LP_guess = ms_auto_opt_des_par.m_PR_HP_to_LP_guess;	//[-]
+			opt_des_par_rc.m_PR_HP_to_LP_guess = ms_auto_opt_des_par.m_PR_HP_to_LP_guess;	//[-]
 		}
 		else
 		{
-			ms_opt_des_par.m_PR_HP_to_LP_guess = PR_mc_guess;		//[-]
+			opt_des_par_rc.m_PR_HP_to_LP_guess = PR_mc_guess;		//[-]
 		}
 
         // Is the recompression fraction fixed or optimized?
         if (ms_auto_opt_des_par.m_is_recomp_ok < 0.0)
         {   // fixed
-            ms_opt_des_par.m_recomp_frac_guess = std::abs(ms_auto_opt_des_par.m_is_recomp_ok);
-            ms_opt_des_par.m_fixed_recomp_frac = true;
+            opt_des_par_rc.m_recomp_frac_guess = std::abs(ms_auto_opt_des_par.m_is_recomp_ok);
+            opt_des_par_rc.m_fixed_recomp_frac = true;
         }
         else
         {   // optimized
-            ms_opt_des_par.m_recomp_frac_guess = 0.3;
-            ms_opt_des_par.m_fixed_recomp_frac = false;
+            opt_des_par_rc.m_recomp_frac_guess = 0.3;
+            opt_des_par_rc.m_fixed_recomp_frac = false;
         }
 		
-		ms_opt_des_par.m_LT_frac_guess = 0.5;
-		ms_opt_des_par.m_fixed_LT_frac = false;
+		opt_des_par_rc.m_LT_frac_guess = 0.5;
+		opt_des_par_rc.m_fixed_LT_frac = false;
 
-        if (ms_opt_des_par.m_LTR_target_code != NS_HX_counterflow_eqs::OPTIMIZE_UA || ms_opt_des_par.m_HTR_target_code != NS_HX_counterflow_eqs::OPTIMIZE_UA)
+        if (opt_des_par_rc.m_LTR_target_code != NS_HX_counterflow_eqs::OPTIMIZE_UA || opt_des_par_rc.m_HTR_target_code != NS_HX_counterflow_eqs::OPTIMIZE_UA)
         {
-            ms_opt_des_par.m_fixed_LT_frac = true;
+            opt_des_par_rc.m_fixed_LT_frac = true;
         }
 
-		int rc_error_code = 0;
-		opt_design_core(rc_error_code);
-	
-		if( rc_error_code == 0 )
-			local_eta_rc = m_objective_metric_opt;
-	
-		if(rc_error_code == 0 && m_objective_metric_opt > m_objective_metric_auto_opt)
-		{
-			ms_des_par_auto_opt = ms_des_par_optimal;
-			m_objective_metric_auto_opt = m_objective_metric_opt;
-		}
+		v_opt_des_par.push_back(opt_des_par_rc);
+		add_multi_starts(v_opt_des_par);
 	}
 
     // Is recompression fraction fixed or optimized?
@@ -3194,42 +3210,136 @@ double C_RecompCycle::opt_eta_fixed_P_high(double P_high_opt /*kPa*/)
     if (ms_auto_opt_des_par.m_is_recomp_ok == 1.0 || ms_auto_opt_des_par.m_is_recomp_ok == 0.0)
     {
         // Complete 'ms_opt_des_par' for simple cycle
-        ms_opt_des_par.m_P_mc_out_guess = P_high_opt;
-        ms_opt_des_par.m_fixed_P_mc_out = true;
-
-        //ms_opt_des_par.m_PR_HP_to_LP_guess = PR_mc_guess;
-        //ms_opt_des_par.m_fixed_PR_HP_to_LP = false;
-        ms_opt_des_par.m_fixed_PR_HP_to_LP = ms_auto_opt_des_par.m_fixed_PR_HP_to_LP;	//[-]
-        if (ms_opt_des_par.m_fixed_PR_HP_to_LP)
+		S_opt_design_parameters opt_des_par_s = ms_opt_des_par;
+        opt_des_par_s.m_P_mc_out_guess = P_high_opt;
+        opt_des_par_s.m_fixed_P_mc_out = true;
+
+        //opt_des_par_s.m_PR_HP_to_LP_guess = PR_mc_guess;
+        //opt_des_par_s.m_fixed_PR_HP_to_LP = false;
+        opt_des_par_s.m_fixed_PR_HP_to_LP = ms_auto_opt_des_par.m_fixed_PR_HP_to_LP;	//[-]
+        if (opt_des_par_s.m_fixed_PR_HP_to_LP)
         {
-            ms_opt_des_par.m_PR_HP_to_LP_guess = ms_auto_opt_des_par.m_PR_HP_to_LP_guess;	//[-]
+            opt_des_par_s.m_PR_HP_to_LP_guess = ms_auto_opt_des_par.m_PR_HP_to_LP_guess;	//[-]
         }
         else
         {
-            ms_opt_des_par.m_PR_HP_to_LP_guess = PR_mc_guess;		//[-]
+            opt_des_par_s.m_PR_HP_to_LP_guess = PR_mc_guess;		//[-]
         }
 
-        ms_opt_des_par.m_recomp_frac_guess = 0.0;
-        ms_opt_des_par.m_fixed_recomp_frac = true;
-        ms_opt_des_par.m_LT_frac_guess = 1.0;
-        ms_opt_des_par.m_fixed_LT_frac = true;
+        opt_des_par_s.m_recomp_frac_guess = 0.0;
+        opt_des_par_s.m_fixed_recomp_frac = true;
+        opt_des_par_s.m_LT_frac_guess = 1.0;
+        opt_des_par_s.m_fixed_LT_frac = true;
 
-        int s_error_code = 0;
-        opt_design_core(s_error_code);
+		v_opt_des_par.push_back(opt_des_par_s);
+    }
 
-        if (s_error_code == 0)
-            local_eta_s = m_objective_metric_opt;
+	return -opt_design_starts(v_opt_des_par);
 
-        if (s_error_code == 0 && m_objective_metric_opt > m_objective_metric_auto_opt)
-        {
-            ms_des_par_auto_opt = ms_des_par_optimal;
-            m_objective_metric_auto_opt = m_objective_metric_opt;
-        }
-    }
+}
 
-	return -max(local_eta_rc, local_eta_s);
+void C_RecompCycle::add_multi_starts(std::vector<S_opt_design_parameters> & v_opt_des_par)
+{
+	// Adds alternate starting points around the last entry of 'v_opt_des_par'
+	if (ms_auto_opt_des_par.m_n_multi_start_threads <= 1 || v_opt_des_par.empty())
+		return;
 
+	S_opt_design_parameters opt_des_par_base = v_opt_des_par.back();
+
+	if (!opt_des_par_base.m_fixed_recomp_frac)
+	{
+		double recomp_frac_starts[2] = {0.1, 0.5};
+		for (int i = 0; i < 2; i++)
+		{
+			v_opt_des_par.push_back(opt_des_par_base);
+			v_opt_des_par.back().m_recomp_frac_guess = recomp_frac_starts[i];	//[-]
+		}
+	}
+
+	if (!opt_des_par_base.m_fixed_LT_frac)
+	{
+		double LT_frac_starts[2] = {0.3, 0.7};
+		for (int i = 0; i < 2; i++)
+		{
+			v_opt_des_par.push_back(opt_des_par_base);
+			v_opt_des_par.back().m_LT_frac_guess = LT_frac_starts[i];	//[-]
+		}
+	}
 }
+
+double C_RecompCycle::opt_design_starts(const std::vector<S_opt_design_parameters> & v_opt_des_par)
+{
+	// Runs 'opt_design_core' from each starting point, updates 'ms_des_par_auto_opt' with the best result,
+	//   and returns the best objective metric (0 if no start solved)
+	int n_starts = (int)v_opt_des_par.size();
+
+	std::vector<int> v_error_code(n_starts, 0);
+	std::vector<double> v_objective_metric(n_starts, 0.0);
+	std::vector<S_design_parameters> v_des_par_optimal(n_starts);
+
+	if (ms_auto_opt_des_par.m_n_multi_start_threads > 1 && n_starts > 1)
+	{
+		// Each starting point is solved by its own cycle so the optimizations are independent.
+		//   The cycles are kept through the auto-optimization so each can reuse its memoized designs
+		while ((int)mv_multi_start_cycles.size() < n_starts)
+		{
+			mv_multi_start_cycles.push_back(std::unique_ptr<C_RecompCycle>(new C_RecompCycle(m_turbo_gen_motor_config,
+				m_eta_generator,
+				m_T_mc_in,
+				m_W_dot_net,
+				m_T_t_in, m_P_high_limit,
+				m_DP_LTR, m_DP_HTR,
+				m_DP_PC_main, m_DP_PHX,
+				m_LTR_N_sub_hxrs, m_HTR_N_sub_hxrs,
+				m_eta_mc, m_mc_comp_model_code,
+				m_eta_rc,
+				m_eta_t, m_N_turbine,
+				m_frac_fan_power, m_eta_fan, m_deltaP_cooler_frac,
+				m_N_nodes_pass,
+				m_T_amb_des, m_elevation)));
+		}
+
+		sco2_parallel_for(n_starts, ms_auto_opt_des_par.m_n_multi_start_threads, [&](int i)
+		{
+			C_RecompCycle *p_cycle = mv_multi_start_cycles[i].get();
+			p_cycle->ms_opt_des_par = v_opt_des_par[i];
+			p_cycle->opt_design_core(v_error_code[i]);
+			v_objective_metric[i] = p_cycle->m_objective_metric_opt;
+			v_des_par_optimal[i] = p_cycle->ms_des_par_optimal;
+		});
+
+		ms_opt_des_par = v_opt_des_par[n_starts - 1];
+	}
+	else
+	{
+		for (int i = 0; i < n_starts; i++)
+		{
+			ms_opt_des_par = v_opt_des_par[i];
+			opt_design_core(v_error_code[i]);
+			v_objective_metric[i] = m_objective_metric_opt;
+			v_des_par_optimal[i] = ms_des_par_optimal;
+		}
+	}
+
+	// Earlier starts win ties, as when the starts are solved in sequence
+	double objective_metric_max = 0.0;
+	for (int i = 0; i < n_starts; i++)
+	{
+		if (v_error_code[i] != 0)
+			continue;
+
+		objective_metric_max = std::max(objective_metric_max, v_objective_metric[i]);
+
+		if (v_objective_metric[i] > m_objective_metric_auto_opt)
+		{
+			ms_des_par_auto_opt = v_des_par_optimal[i];
+			m_objective_metric_auto_opt = v_objective_metric[i];
+		}
+	}
+
+	return objective_metric_max;
+}
+
 void C_RecompCycle::check_od_solution(double & diff_m_dot, double & diff_E_cycle, 
     double & diff_Q_LTR, double & diff_Q_HTR)
 {
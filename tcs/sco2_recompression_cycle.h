@@ -38,6 +38,8 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <limits>
 #include <vector>
+#include <map>
+#include <memory>
 #include <algorithm>
 #include <string>
 #include <math.h>
@@ -431,6 +433,18 @@ private:
 	double m_objective_metric_auto_opt;	
 	S_design_parameters ms_des_par_auto_opt;
 
+		// Objective metrics already solved by 'design_cycle_return_objective_metric'
+		//   keyed on (P_mc_in, P_mc_out, recomp_frac, LTR_UA, HTR_UA). Cleared by each optimization entry point
+	struct S_design_memo
+	{
+		double m_objective_metric;
+		S_design_parameters ms_des_par;
+	};
+	std::map<std::vector<double>, S_design_memo> mm_design_memo;
+
+		// Cycles that solve the optimizer starting points when multi-start is on. One per starting point
+	std::vector<std::unique_ptr<C_RecompCycle>> mv_multi_start_cycles;
+
 		// Results from last off-design solution
 	std::vector<double> m_temp_od, m_pres_od, m_enth_od, m_entr_od, m_dens_od;					// thermodynamic states (K, kPa, kJ/kg, kJ/kg-K, kg/m3)
 	double m_eta_thermal_od;
@@ -467,6 +481,10 @@ private:
 
 	void auto_opt_design_core(int & error_code);
 
+	void add_multi_starts(std::vector<S_opt_design_parameters> & v_opt_des_par);
+
+	double opt_design_starts(const std::vector<S_opt_design_parameters> & v_opt_des_par);
+
 	void finalize_design(int & error_code);	
 
 	//void off_design_core(int & error_code);
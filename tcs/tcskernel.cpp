@@ -450,6 +450,9 @@ tcskernel::tcskernel( tcstypeprovider *prov )
 	m_provider = prov;
 	m_proceedAnyway = true;
 	m_maxIterations = 100;
+	m_solveMode = TCS_SOLVE_SWEEP;
+	m_componentsValid = false;
+	m_unitInvocations = 0;
 	m_currentTime = 0;
 	m_timeStep = 0;
 	m_startTime = 0;
@@ -479,6 +482,22 @@ void tcskernel::set_max_iterations( int iter, bool proceed )
 	m_proceedAnyway = proceed;
 }
 
+void tcskernel::set_solve_mode( int mode )
+{
+	if ( mode == TCS_SOLVE_SWEEP || mode == TCS_SOLVE_ORDERED )
+		m_solveMode = mode;
+}
+
+int tcskernel::solve_mode()
+{
+	return m_solveMode;
+}
+
+size_t tcskernel::unit_invocations()
+{
+	return m_unitInvocations;
+}
+
 double tcskernel::current_time()
 {
 	return m_currentTime;
@@ -751,6 +770,7 @@ int tcskernel::add_unit( const std::string &type, const std::string &name )
 	u.name = name;
 	u.type = t;
 	u.instance = 0;
+	m_componentsValid = false;
 	
 	u.context.kernel_internal = this;
 	u.context.unit_internal = id;
@@ -819,6 +839,8 @@ int tcskernel::add_unit( const std::string &type, const std::string &name )
 void tcskernel::clear_units()
 {	
 	m_units.clear();
+	m_components.clear();
+	m_componentsValid = false;
 }
 
 bool tcskernel::connect( int unit1, int output, 
@@ -852,6 +874,7 @@ bool tcskernel::connect( int unit1, int output,
 	c.ftol = tol;
 	c.arridx = arridx;
 	u1.conn[ output ].push_back( c );
+	m_componentsValid = false;
 	
 	return true;
 }
@@ -920,6 +943,115 @@ void tcskernel::free_instances()
 	}
 }
 
+int tcskernel::invoke_unit( size_t i, double time, double step )
+{
+	unit &u = m_units[i];
+	if ( u.type->invoke( &u.context, u.instance, TCS_INVOKE,
+			&u.values[0], (unsigned int)u.values.size(),
+			time, step, u.ncall ) < 0 )
+	{
+		message( TCS_ERROR,"unit %d (%s) type '%s' failed at time %.2lf", i, u.name.c_str(),
+			u.type->name, time );
+		return -2;
+	}
+
+	u.mustcall = false;
+	u.ncall++;
+	m_unitInvocations++;
+	return 0;
+}
+
+int tcskernel::propagate_outputs( size_t i )
+{
+	unit &u = m_units[i];
+
+	// check all values of the current unit
+	// for connections to other units to see if their 
+	// inputs need to be updated
+	for (size_t j=0;j<u.values.size();j++)
+	{
+		// reference current output value
+		tcsvalue *val1 = &u.values[j];
+		
+		// go through each connection attached to this output
+		for (size_t k=0;k<u.conn[j].size();k++)
+		{
+			connection &c = u.conn[j][k];
+			tcsvalue *val2 = &m_units[c.target_unit].values[c.target_index];
+			
+			// check that 'val2' and 'val1' are
+			// within tolerances of one another
+			
+			if ( val1->type == TCS_NUMBER 
+				&& val2->type == TCS_NUMBER)
+			{
+				if ( !check_tolerance( val1->data.value, val2->data.value, c.ftol ) )
+				{
+					// mark units for recalculation and propagate new output value to input									
+					val2->data.value = val1->data.value;									
+					m_units[c.target_unit].mustcall = true;
+				}
+			}
+			else if ( val1->type == TCS_ARRAY
+				&& val2->type == TCS_NUMBER
+				&& c.arridx >= 0 && c.arridx < (int)val1->data.array.length )
+			{
+				if ( !check_tolerance( val1->data.array.values[c.arridx], val2->data.value, c.ftol ))
+				{
+					val2->data.value = val1->data.array.values[c.arridx];
+					m_units[c.target_unit].mustcall = true;
+				}
+			}
+			else if ( val1->type == TCS_ARRAY && val2->type == TCS_ARRAY
+				 && val1->data.array.length == val2->data.array.length )
+			{
+				int len = val1->data.array.length;
+				bool pass = true;
+				for ( int m=0;m<len;m++ )
+					pass = pass && check_tolerance( val1->data.array.values[m],
+						val2->data.array.values[m], c.ftol );
+				
+				if ( !pass )
+				{
+					// propagate values and mark for recalculation
+					for ( int m=0;m<len;m++ )
+						val2->data.array.values[m] = val1->data.array.values[m];
+					m_units[c.target_unit].mustcall = true;									
+				}
+			}
+			else if ( val1->type == TCS_MATRIX && val2->type == TCS_MATRIX
+				&& val1->data.matrix.nrows == val2->data.matrix.nrows
+				&& val1->data.matrix.ncols == val2->data.matrix.ncols )
+			{
+				int len = val1->data.matrix.nrows * val1->data.matrix.ncols;
+				bool pass = true;
+				for ( int m=0;m<len;m++ )
+					pass = pass && check_tolerance( val1->data.matrix.values[m],
+						val2->data.matrix.values[m], c.ftol );
+				
+				if ( !pass )
+				{
+					// propagate values and mark for recalculation
+					for ( int m=0;m<len;m++ )
+						val2->data.matrix.values[m] = val1->data.matrix.values[m];
+					m_units[c.target_unit].mustcall = true;	
+				}
+			}
+			else
+			{
+				// type mismatch,
+				// dimension mismatch,
+				// or cannot compare strings for convergence
+				message( TCS_ERROR, "kernel could not check connection between [%d,%d] and [%d,%d]: type mismatch, dimension mismatch, or invalid type connection",
+					i, j, c.target_unit, c.target_index);
+				return -3;						
+			}
+		}
+	} // loop over all output connections, checking for output->input propagations
+
+	return 0;
+}
+
 int tcskernel::solve( double time, double step )
 {
 	// must call each unit at least once each timestep
@@ -928,6 +1060,9 @@ int tcskernel::solve( double time, double step )
 		m_units[i].ncall = 0;
 		m_units[i].mustcall = true;
 	}
+
+	if ( m_solveMode == TCS_SOLVE_ORDERED )
+		return solve_ordered( time, step );
 	
 	int iterations = 0;
 	bool converged = false;		
@@ -952,101 +1087,13 @@ int tcskernel::solve( double time, double step )
 				notice( "@ time %.2lf, iteration %d for unit %d\n", time, m_units[i].ncall, i );
 			}*/
 
-			if ( m_units[i].type->invoke( &m_units[i].context, m_units[i].instance, TCS_INVOKE,
-					&m_units[i].values[0], (unsigned int)m_units[i].values.size(),
-					time, step, m_units[i].ncall ) < 0 )
-			{
-				message( TCS_ERROR,"unit %d (%s) type '%s' failed at time %.2lf", i, m_units[i].name.c_str(),
-					m_units[i].type->name, time );
-				return -2;
-			}
+			int code = invoke_unit( i, time, step );
+			if ( code < 0 )
+				return code;
 			
-			m_units[i].mustcall = false;
-			m_units[i].ncall++;
-			
-			// check all values of the current unit
-			// for connections to other units to see if their 
-			// inputs need to be updated
-			for (size_t j=0;j<m_units[i].values.size();j++)
-			{
-				// reference current output value
-				tcsvalue *val1 = &m_units[i].values[j];
-				
-				// go through each connection attached to this output
-				for (size_t k=0;k<m_units[i].conn[j].size();k++)
-				{
-					connection &c = m_units[i].conn[j][k];
-					tcsvalue *val2 = &m_units[c.target_unit].values[c.target_index];
-					
-					// check that 'val2' and 'val1' are
-					// within tolerances of one another
-					
-					if ( val1->type == TCS_NUMBER 
-						&& val2->type == TCS_NUMBER)
-					{
-						if ( !check_tolerance( val1->data.value, val2->data.value, c.ftol ) )
-						{
-							// mark units for recalculation and propagate new output value to input									
-							val2->data.value = val1->data.value;									
-							m_units[c.target_unit].mustcall = true;
-						}
-					}
-					else if ( val1->type == TCS_ARRAY
-						&& val2->type == TCS_NUMBER
-						&& c.arridx >= 0 && c.arridx < (int)val1->data.array.length )
-					{
-						if ( !check_tolerance( val1->data.array.values[c.arridx], val2->data.value, c.ftol ))
-						{
-							val2->data.value = val1->data.array.values[c.arridx];
-							m_units[c.target_unit].mustcall = true;
-						}
-					}
-					else if ( val1->type == TCS_ARRAY && val2->type == TCS_ARRAY
-						 && val1->data.array.length == val2->data.array.length )
-					{
-						int len = val1->data.array.length;
-						bool pass = true;
-						for ( int m=0;m<len;m++ )
-							pass = pass && check_tolerance( val1->data.array.values[m],
-								val2->data.array.values[m], c.ftol );
-						
-						if ( !pass )
-						{
-							// propagate values and mark for recalculation
-							for ( int m=0;m<len;m++ )
-								val2->data.array.values[m] = val1->data.array.values[m];
-							m_units[c.target_unit].mustcall = true;									
-						}
-					}
-					else if ( val1->type == TCS_MATRIX && val2->type == TCS_MATRIX
-						&& val1->data.matrix.nrows == val2->data.matrix.nrows
-						&& val1->data.matrix.ncols == val2->data.matrix.ncols )
-					{
-						int len = val1->data.matrix.nrows * val1->data.matrix.ncols;
-						bool pass = true;
-						for ( int m=0;m<len;m++ )
-							pass = pass && check_tolerance( val1->data.matrix.values[m],
-								val2->data.matrix.values[m], c.ftol );
-						
-						if ( !pass )
-						{
-							// propagate values and mark for recalculation
-							for ( int m=0;m<len;m++ )
-								val2->data.matrix.values[m] = val1->data.matrix.values[m];
-							m_units[c.target_unit].mustcall = true;	
-						}
-					}
-					else
-					{
-						// type mismatch,
-						// dimension mismatch,
-						// or cannot compare strings for convergence
-						message( TCS_ERROR, "kernel could not check connection between [%d,%d] and [%d,%d]: type mismatch, dimension mismatch, or invalid type connection",
-							i, j, c.target_unit, c.target_index);
-						return -3;						
-					}
-				}
-			} // loop over all output connections, checking for output->input propagations
+			code = propagate_outputs( i );
+			if ( code < 0 )
+				return code;
 			
 		} // loop over all units, invoke each if needed, check outputs etc
 		
@@ -1062,6 +1109,230 @@ int tcskernel::solve( double time, double step )
 	return iterations; // success
 }
 
+void tcskernel::build_components()
+{
+	// Tarjan's algorithm on the unit connection graph
+	size_t n = m_units.size();
+	std::vector< std::vector<int> > adj( n );
+	std::vector<bool> self_loop( n, false );
+	for ( size_t i=0;i<n;i++ )
+	{
+		for ( size_t j=0;j<m_units[i].conn.size();j++ )
+		{
+			for ( size_t k=0;k<m_units[i].conn[j].size();k++ )
+			{
+				int t = m_units[i].conn[j][k].target_unit;
+				if ( t == (int)i )
+					self_loop[i] = true;
+				else if ( std::find( adj[i].begin(), adj[i].end(), t ) == adj[i].end() )
+					adj[i].push_back( t );
+			}
+		}
+	}
+
+	std::vector<int> index( n, -1 ), lowlink( n, 0 ), stack;
+	std::vector<bool> onstack( n, false );
+	std::vector< std::pair<int, size_t> > work; // (unit, next edge) for the iterative depth-first search
+	std::vector< std::vector<int> > sccs; // emitted in reverse topological order
+	int next_index = 0;
+
+	for ( size_t s=0;s<n;s++ )
+	{
+		if ( index[s] >= 0 ) continue;
+
+		work.push_back( std::make_pair( (int)s, (size_t)0 ) );
+		while ( !work.empty() )
+		{
+			int v = work.back().first;
+			size_t &e = work.back().second;
+			if ( e == 0 && index[v] < 0 )
+			{
+				index[v] = lowlink[v] = next_index++;
+				stack.push_back( v );
+				onstack[v] = true;
+			}
+
+			if ( e < adj[v].size() )
+			{
+				int w = adj[v][e++];
+				if ( index[w] < 0 )
+					work.push_back( std::make_pair( w, (size_t)0 ) );
+				else if ( onstack[w] )
+					lowlink[v] = std::min( lowlink[v], index[w] );
+				continue;
+			}
+
+			if ( lowlink[v] == index[v] )
+			{
+				std::vector<int> scc;
+				int w;
+				do
+				{
+					w = stack.back();
+					stack.pop_back();
+					onstack[w] = false;
+					scc.push_back( w );
+				} while ( w != v );
+				sccs.push_back( scc );
+			}
+
+			work.pop_back();
+			if ( !work.empty() )
+			{
+				int parent = work.back().first;
+				lowlink[parent] = std::min( lowlink[parent], lowlink[v] );
+			}
+		}
+	}
+
+	m_components.clear();
+	for ( std::vector< std::vector<int> >::reverse_iterator it = sccs.rbegin(); it != sccs.rend(); ++it )
+	{
+		component c;
+		c.units = *it;
+		std::sort( c.units.begin(), c.units.end() );
+		c.cyclic = c.units.size() > 1 || self_loop[ c.units[0] ];
+
+		if ( c.cyclic )
+		{
+			// inputs fed from a unit at or after the target in the sweep order are the torn variables.
+			// only scalar connections are relaxed, arrays and matrices are passed through as in the sweep
+			for ( size_t a=0;a<c.units.size();a++ )
+			{
+				unit &u = m_units[ c.units[a] ];
+				for ( size_t j=0;j<u.conn.size();j++ )
+				{
+					for ( size_t k=0;k<u.conn[j].size();k++ )
+					{
+						connection &cn = u.conn[j][k];
+						std::vector<int>::iterator pos = std::find( c.units.begin(), c.units.end(), cn.target_unit );
+						if ( pos == c.units.end() || (size_t)(pos - c.units.begin()) > a )
+							continue;
+
+						if ( m_units[cn.target_unit].values[cn.target_index].type != TCS_NUMBER )
+							continue;
+
+						tear t;
+						t.target_unit = cn.target_unit;
+						t.target_index = cn.target_index;
+						t.x_prev = t.r_prev = 0.0;
+						t.omega = 1.0;
+						c.tears.push_back( t );
+					}
+				}
+			}
+		}
+
+		m_components.push_back( c );
+	}
+
+	m_componentsValid = true;
+}
+
+int tcskernel::solve_ordered( double time, double step )
+{
+	if ( !m_componentsValid )
+		build_components();
+
+	int iterations = 1;
+	for ( size_t c=0;c<m_components.size();c++ )
+	{
+		component &comp = m_components[c];
+		if ( !comp.cyclic )
+		{
+			// every upstream unit has already been called this timestep, so one call is sufficient
+			size_t i = (size_t)comp.units[0];
+			int code = invoke_unit( i, time, step );
+			if ( code < 0 )
+				return code;
+
+			code = propagate_outputs( i );
+			if ( code < 0 )
+				return code;
+		}
+		else
+		{
+			int code = solve_cycle( comp, time, step );
+			if ( code < 0 )
+				return code;
+
+			iterations = std::max( iterations, code );
+		}
+	}
+
+	return iterations;
+}
+
+int tcskernel::solve_cycle( component &comp, double time, double step )
+{
+	// bounds on the relaxation factor keep an ill-conditioned secant estimate from stalling or diverging the loop
+	const double omega_min = 0.1;
+	const double omega_max = 1.5;
+
+	for ( size_t t=0;t<comp.tears.size();t++ )
+	{
+		comp.tears[t].omega = 1.0;
+		comp.tears[t].r_prev = 0.0;
+	}
+
+	int iterations = 0;
+	bool converged = false;
+	while ( !converged )
+	{
+		if ( iterations++ >= m_maxIterations )
+		{
+			message( TCS_NOTICE, "kernel exceeded maximum iterations of %d, at time %lf", m_maxIterations, time);
+			if ( m_proceedAnyway )
+				return iterations;
+			else
+				return -1;
+		}
+
+		for ( size_t t=0;t<comp.tears.size();t++ )
+			comp.tears[t].x_prev = m_units[ comp.tears[t].target_unit ].values[ comp.tears[t].target_index ].data.value;
+
+		for ( size_t a=0;a<comp.units.size();a++ )
+		{
+			size_t i = (size_t)comp.units[a];
+			if ( !m_units[i].mustcall )
+				continue;
+
+			int code = invoke_unit( i, time, step );
+			if ( code < 0 )
+				return code;
+
+			code = propagate_outputs( i );
+			if ( code < 0 )
+				return code;
+		}
+
+		// Aitken relaxation of the torn inputs: x = x_prev + omega * r, with omega updated
+		// from the change in residual between successive sweeps
+		for ( size_t t=0;t<comp.tears.size();t++ )
+		{
+			tear &tr = comp.tears[t];
+			double &x = m_units[ tr.target_unit ].values[ tr.target_index ].data.value;
+			double r = x - tr.x_prev;
+			if ( r == 0.0 )
+				continue; // within tolerance, input was not updated
+
+			double dr = r - tr.r_prev;
+			if ( iterations > 1 && tr.r_prev != 0.0 && dr != 0.0 )
+				tr.omega = std::min( omega_max, std::max( omega_min, -tr.omega * tr.r_prev / dr ) );
+
+			x = tr.x_prev + tr.omega * r;
+			tr.r_prev = r;
+		}
+
+		converged = true;
+		for ( size_t a=0;a<comp.units.size();a++ )
+			if ( m_units[ comp.units[a] ].mustcall )
+				converged = false;
+	}
+
+	return iterations;
+}
+
 void tcskernel::message( int msgtype, const char *fmt, ... )
 {
 	char buf[2048];
@@ -89,6 +89,13 @@ private:
 	std::vector<std::string> m_messages;
 };
 
+/* kernel solve modes:
+   TCS_SOLVE_SWEEP: repeated Gauss-Seidel sweeps over all units flagged 'mustcall' (default)
+   TCS_SOLVE_ORDERED: units are grouped into strongly connected components of the connection graph.
+     acyclic units are called once per timestep in topological order, and each cycle is iterated
+     on its own with Aitken relaxation of the torn (feedback) inputs */
+enum { TCS_SOLVE_SWEEP, TCS_SOLVE_ORDERED };
+
 class tcskernel
 {
 public:
@@ -106,6 +113,9 @@ public:
 
 	int version();
 	void set_max_iterations( int iter, bool proceed_anyway );
+	void set_solve_mode( int mode );
+	int solve_mode();
+	size_t unit_invocations();
 
 	double current_time();
 	double time_step();
@@ -172,9 +182,35 @@ public:
 		tcscontext context;
 	};
 
+	// feedback input of a cycle, relaxed with a scalar Aitken factor
+	struct tear {
+		int target_unit;
+		int target_index;
+		double x_prev;
+		double r_prev;
+		double omega;
+	};
+
+	struct component {
+		std::vector<int> units; // in sweep (unit index) order
+		bool cyclic;
+		std::vector<tear> tears;
+	};
+
 			
 protected:
 	int find_var( int unit, const char *name );
+	int propagate_outputs( size_t i );
+	int invoke_unit( size_t i, double time, double step );
+	void build_components();
+	int solve_ordered( double time, double step );
+	int solve_cycle( component &c, double time, double step );
+
+	int m_solveMode;
+	bool m_componentsValid;
+	std::vector<component> m_components; // topological order
+	size_t m_unitInvocations;
+
 	bool m_proceedAnyway;
 	int m_maxIterations;
 	double m_currentTime;
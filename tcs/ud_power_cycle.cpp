@@ -38,6 +38,11 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <set>
 #include <fstream>
 #include <unordered_set>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <exception>
 #include <map>
 
 C_ud_power_cycle::C_ud_power_cycle()
@@ -608,6 +613,8 @@ C_ud_pc_table_generator::C_ud_pc_table_generator(C_od_pc_function & f_pc_eq) : m
 	m_progress_msg = "Power cycle preprocessing...";
 	m_log_msg = "Log message";
 
+	m_n_threads = 1;	//[-] Solve runs serially unless the caller asks for more
+
 	return;
 }
 
@@ -687,11 +694,8 @@ int C_ud_pc_table_generator::generate_tables(double T_htf_ref /*C*/, double T_ht
 		throw(C_csp_exception(msg, "User defined power cycle, generate tables"));
 	}
 
-	C_od_pc_function::S_f_inputs pc_inputs;
-	C_od_pc_function::S_f_outputs pc_outputs;
-
 	// ******************************************
-	// Setup T_HTF parameteric runs
+	// Check number of levels for each parametric
 	if(n_T_htf < 3)
 	{
 		std::string msg = util::format("The input argument for number of indepedent HTF temperatures is %d."
@@ -699,203 +703,287 @@ int C_ud_pc_table_generator::generate_tables(double T_htf_ref /*C*/, double T_ht
 		mc_messages.add_notice(msg);
 		n_T_htf = 3;
 	}
+	if(n_T_amb < 3)
+	{
+		std::string msg = util::format("The input argument for number of independent ambient temperatures"
+						" is %d. It was reset to the minimum value of 3.", n_T_amb);
+		mc_messages.add_notice(msg);
+		n_T_amb = 3;
+	}
+	if(n_m_dot_htf_ND < 3)
+	{
+		std::string msg = util::format("The input argument for number of independent normalized HTF mass flow rates"
+						" is %d. It was reset to the minimum value of 3.", n_m_dot_htf_ND);
+		mc_messages.add_notice(msg);
+		n_m_dot_htf_ND = 3;
+	}
+	// ******************************************
+
+	// Collect every off-design run before solving any of them so they can be distributed across threads
+	//    Runs are ordered table by table, row by row, so neighboring runs are adjacent in the list
+	std::vector<S_od_run> v_runs;
+	v_runs.reserve(3*(n_T_htf + n_T_amb + n_m_dot_htf_ND));
+
+	S_od_run od_run;
 
+	// ******************************************
+	// Setup T_HTF parameteric runs
 	T_htf_ind.clear();
 	T_htf_ind.resize(n_T_htf, 13);		// Set matrix size
 	double delta_T_htf = (T_htf_high - T_htf_low)/double(n_T_htf-1);
 
-	double n_runs_total = 3.0*(n_T_htf + n_T_amb + n_m_dot_htf_ND);
+	// Call at low, ref, and high ND mass flow rate levels
+	double m_dot_htf_ND_levels[3] = {m_dot_htf_ND_low, m_dot_htf_ND_ref, m_dot_htf_ND_high};
 
 	// Set ambient temperature because it is constant for the HTF temperature parametrics
-	pc_inputs.m_T_amb = T_amb_ref;	//[C]
+	od_run.m_i_table = 0;
+	od_run.ms_inputs.m_T_amb = T_amb_ref;	//[C]
 	for(int i = 0; i < n_T_htf; i++)
 	{
 		T_htf_ind(i,0) = T_htf_low + delta_T_htf*i;	//[C]
-		pc_inputs.m_T_htf_hot = T_htf_ind(i,0);
-
-		// Call at low, ref, and high ND mass flow rate levels
-		std::vector<double> m_dot_htf_ND_levels(3);
-		m_dot_htf_ND_levels[0] = m_dot_htf_ND_low;
-		m_dot_htf_ND_levels[1] = m_dot_htf_ND_ref;
-		m_dot_htf_ND_levels[2] = m_dot_htf_ND_high;
+		od_run.m_i_row = i;
+		od_run.ms_inputs.m_T_htf_hot = T_htf_ind(i,0);
 		for(int j = 0; j < 3; j++)
 		{
-			bool is_od_model_error = false;
-
-			pc_inputs.m_m_dot_htf_ND = m_dot_htf_ND_levels[j];
-			int off_design_code = mf_pc_eq(pc_inputs,pc_outputs);
-
-			if( off_design_code == 0 )
-			{
-				// Save outputs
-				T_htf_ind(i,1+j) = pc_outputs.m_W_dot_gross_ND;		//[-]
-				T_htf_ind(i,4+j) = pc_outputs.m_Q_dot_in_ND;		//[-]
-				T_htf_ind(i,7+j) = pc_outputs.m_W_dot_cooling_ND;	//[-]
-				T_htf_ind(i,10+j) = pc_outputs.m_m_dot_water_ND;	//[-]
-			}
-			else if (off_design_code == -1)
-			{
-				// Save 'generic' off design model response
-				T_htf_ind(i, 1 + j) = pc_inputs.m_m_dot_htf_ND;		//[-]
-				T_htf_ind(i, 4 + j) = pc_inputs.m_m_dot_htf_ND;		//[-]
-				T_htf_ind(i, 7 + j) = pc_inputs.m_m_dot_htf_ND;		//[-]
-				T_htf_ind(i, 10 + j) = pc_inputs.m_m_dot_htf_ND;	//[-]
-
-				is_od_model_error = true;
-			}
-			else
-			{
-				std::string err_msg = util::format("The 1st UDPC table (primary: T_htf, interaction: m_dot_htf_ND) generation failed at T_htf = %lg [C] and m_dot_htf = %lg [-]", pc_inputs.m_T_htf_hot, pc_inputs.m_m_dot_htf_ND);
-				throw(C_csp_exception(err_msg, "UDPC"));
-			}
-
-			double run_number = i*3 + j;
-
-			send_callback(is_od_model_error, (int)run_number + 1, (int)n_runs_total,
-				pc_inputs.m_T_htf_hot, pc_inputs.m_m_dot_htf_ND, pc_inputs.m_T_amb,
-				T_htf_ind(i, 1 + j), T_htf_ind(i, 4 + j),
-				T_htf_ind(i, 7 + j), T_htf_ind(i, 10 + j));
-
+			od_run.m_j_level = j;
+			od_run.ms_inputs.m_m_dot_htf_ND = m_dot_htf_ND_levels[j];
+			v_runs.push_back(od_run);
 		}
-
 	}
 	// ******************************************
 
 	// ******************************************
 	// Setup T_amb parametric runs
-	if(n_T_amb < 3)
-	{
-		std::string msg = util::format("The input argument for number of independent ambient temperatures"
-						" is %d. It was reset to the minimum value of 3.", n_T_amb);
-		mc_messages.add_notice(msg);
-		n_T_amb = 3;
-	}
-
 	T_amb_ind.clear();
 	T_amb_ind.resize(n_T_amb, 13);		// Set matrix size
 	double delta_T_amb = (T_amb_high - T_amb_low)/double(n_T_amb-1);
 
+	// Call at low, ref, and high HTF temperature levels
+	double T_htf_levels[3] = {T_htf_low, T_htf_ref, T_htf_high};	//[C]
+
 	// Set ND htf mass flow rate because it is constant for the ambient temperature parametrics
-	pc_inputs.m_m_dot_htf_ND = m_dot_htf_ND_ref;
+	od_run.m_i_table = 1;
+	od_run.ms_inputs.m_m_dot_htf_ND = m_dot_htf_ND_ref;
 	for(int i = 0; i < n_T_amb; i++)
 	{
 		T_amb_ind(i,0) = T_amb_low + delta_T_amb*i;		//[C]
-		pc_inputs.m_T_amb = T_amb_ind(i,0);				//[C]
-
-		// Call at low, ref, and high HTF temperature levels
-		std::vector<double> T_htf_levels(3);
-		T_htf_levels[0] = T_htf_low;   //[C]
-		T_htf_levels[1] = T_htf_ref;   //[C]
-		T_htf_levels[2] = T_htf_high;  //[C]
+		od_run.m_i_row = i;
+		od_run.ms_inputs.m_T_amb = T_amb_ind(i,0);		//[C]
 		for(int j = 0; j < 3; j++)
 		{
-			bool is_od_model_error = false;
-
-			pc_inputs.m_T_htf_hot = T_htf_levels[j];
-			int off_design_code = mf_pc_eq(pc_inputs,pc_outputs);
-
-			if( off_design_code == 0 )
-			{
-				// Save outputs
-				T_amb_ind(i,1+j) = pc_outputs.m_W_dot_gross_ND;		//[-]
-				T_amb_ind(i,4+j) = pc_outputs.m_Q_dot_in_ND;		//[-]
-				T_amb_ind(i,7+j) = pc_outputs.m_W_dot_cooling_ND;	//[-]
-				T_amb_ind(i,10+j) = pc_outputs.m_m_dot_water_ND;	//[-]
-			}
-			else if (off_design_code == -1)
-			{
-				// Save 'generic' off design model response
-				T_amb_ind(i, 1 + j) = pc_inputs.m_m_dot_htf_ND;		//[-]
-				T_amb_ind(i, 4 + j) = pc_inputs.m_m_dot_htf_ND;		//[-]
-				T_amb_ind(i, 7 + j) = pc_inputs.m_m_dot_htf_ND;		//[-]
-				T_amb_ind(i, 10 + j) = pc_inputs.m_m_dot_htf_ND;	//[-]
-
-				is_od_model_error = true;
-			}
-			else
-			{
-				std::string err_msg = util::format("The 2nd UDPC table (primary: T_amb, interaction: T_htf) generation failed at T_amb = %lg [C] and T_htf = %lg [C]", pc_inputs.m_T_amb, pc_inputs.m_T_htf_hot);
-				throw(C_csp_exception(err_msg, "UDPC"));
-			}
-
-			double run_number = 3.0*n_T_htf + i*3 + j;
-
-			send_callback(is_od_model_error, (int)run_number + 1, (int)n_runs_total,
-				pc_inputs.m_T_htf_hot, pc_inputs.m_m_dot_htf_ND, pc_inputs.m_T_amb,
-				T_amb_ind(i, 1 + j), T_amb_ind(i, 4 + j),
-				T_amb_ind(i, 7 + j), T_amb_ind(i, 10 + j));
+			od_run.m_j_level = j;
+			od_run.ms_inputs.m_T_htf_hot = T_htf_levels[j];
+			v_runs.push_back(od_run);
 		}
 	}
 	// ******************************************
 
 	// ******************************************
 	// Setup ND m_dot parametric runs
-	if(n_m_dot_htf_ND < 3)
-	{
-		std::string msg = util::format("The input argument for number of independent normalized HTF mass flow rates"
-						" is %d. It was reset to the minimum value of 3.", n_m_dot_htf_ND);
-		mc_messages.add_notice(msg);
-		n_m_dot_htf_ND = 3;
-	}
-
 	m_dot_htf_ind.clear();
 	m_dot_htf_ind.resize(n_m_dot_htf_ND,13);		// Set matrix size
 	double delta_m_dot = (m_dot_htf_ND_high-m_dot_htf_ND_low)/double(n_m_dot_htf_ND-1);
 
+	// Call at low, ref, and high ambient temperatures
+	double T_amb_levels[3] = {T_amb_low, T_amb_ref, T_amb_high};	//[C]
+
 	// Set HTF temperature because it is constant for the ambient temperature parametrics
-	pc_inputs.m_T_htf_hot = T_htf_ref;
+	od_run.m_i_table = 2;
+	od_run.ms_inputs.m_T_htf_hot = T_htf_ref;
 	for(int i = 0; i < n_m_dot_htf_ND; i++)
 	{
 		m_dot_htf_ind(i,0) = m_dot_htf_ND_low + delta_m_dot*i;		//[-]
-		pc_inputs.m_m_dot_htf_ND = m_dot_htf_ind(i,0);				//[-]
-
-		// Call at low, ref, and high ambient temperatures
-		std::vector<double> T_amb_levels(3);
-		T_amb_levels[0] = T_amb_low;    //[C]
-		T_amb_levels[1] = T_amb_ref;	//[C]
-		T_amb_levels[2] = T_amb_high;	//[C]
+		od_run.m_i_row = i;
+		od_run.ms_inputs.m_m_dot_htf_ND = m_dot_htf_ind(i,0);		//[-]
 		for(int j = 0; j < 3; j++)
 		{
-			bool is_od_model_error = false;
+			od_run.m_j_level = j;
+			od_run.ms_inputs.m_T_amb = T_amb_levels[j];
+			v_runs.push_back(od_run);
+		}
+	}
+	// ******************************************
+
+	solve_runs(v_runs, T_htf_ind, T_amb_ind, m_dot_htf_ind);
+	
+	return 0;
+}
+
+void C_ud_pc_table_generator::save_run(const S_od_run & od_run, int run_number, int n_runs_total,
+	util::matrix_t<double> & T_htf_ind, util::matrix_t<double> & T_amb_ind, util::matrix_t<double> & m_dot_htf_ind)
+{
+	util::matrix_t<double> *p_table = &T_htf_ind;
+	if (od_run.m_i_table == 1)
+		p_table = &T_amb_ind;
+	else if (od_run.m_i_table == 2)
+		p_table = &m_dot_htf_ind;
+
+	int i = od_run.m_i_row;
+	int j = od_run.m_j_level;
+
+	bool is_od_model_error = false;
+
+	if( od_run.m_off_design_code == 0 )
+	{
+		// Save outputs
+		(*p_table)(i,1+j) = od_run.ms_outputs.m_W_dot_gross_ND;		//[-]
+		(*p_table)(i,4+j) = od_run.ms_outputs.m_Q_dot_in_ND;		//[-]
+		(*p_table)(i,7+j) = od_run.ms_outputs.m_W_dot_cooling_ND;	//[-]
+		(*p_table)(i,10+j) = od_run.ms_outputs.m_m_dot_water_ND;	//[-]
+	}
+	else if (od_run.m_off_design_code == -1)
+	{
+		// Save 'generic' off design model response
+		(*p_table)(i, 1 + j) = od_run.ms_inputs.m_m_dot_htf_ND;		//[-]
+		(*p_table)(i, 4 + j) = od_run.ms_inputs.m_m_dot_htf_ND;		//[-]
+		(*p_table)(i, 7 + j) = od_run.ms_inputs.m_m_dot_htf_ND;		//[-]
+		(*p_table)(i, 10 + j) = od_run.ms_inputs.m_m_dot_htf_ND;	//[-]
+
+		is_od_model_error = true;
+	}
+	else
+	{
+		std::string err_msg;
+		if (od_run.m_i_table == 0)
+			err_msg = util::format("The 1st UDPC table (primary: T_htf, interaction: m_dot_htf_ND) generation failed at T_htf = %lg [C] and m_dot_htf = %lg [-]", od_run.ms_inputs.m_T_htf_hot, od_run.ms_inputs.m_m_dot_htf_ND);
+		else if (od_run.m_i_table == 1)
+			err_msg = util::format("The 2nd UDPC table (primary: T_amb, interaction: T_htf) generation failed at T_amb = %lg [C] and T_htf = %lg [C]", od_run.ms_inputs.m_T_amb, od_run.ms_inputs.m_T_htf_hot);
+		else
+			err_msg = util::format("The 3rd UDPC table (primary: m_dot_htf_ND, interaction: T_amb) generation failed at T_amb = %lg [C] and m_dot_htf = %lg [-]", od_run.ms_inputs.m_T_amb, od_run.ms_inputs.m_m_dot_htf_ND);
+		throw(C_csp_exception(err_msg, "UDPC"));
+	}
+
+	send_callback(is_od_model_error, run_number, n_runs_total,
+		od_run.ms_inputs.m_T_htf_hot, od_run.ms_inputs.m_m_dot_htf_ND, od_run.ms_inputs.m_T_amb,
+		(*p_table)(i, 1 + j), (*p_table)(i, 4 + j),
+		(*p_table)(i, 7 + j), (*p_table)(i, 10 + j));
+}
+
+void C_ud_pc_table_generator::solve_runs(std::vector<S_od_run> & v_runs,
+	util::matrix_t<double> & T_htf_ind, util::matrix_t<double> & T_amb_ind, util::matrix_t<double> & m_dot_htf_ind)
+{
+	int n_runs_total = (int)v_runs.size();
+
+	// Workers claim one table row (its 3 interaction levels) at a time
+	//    so each model solves neighboring points back-to-back
+	int n_rows = n_runs_total / 3;
+
+	int n_threads = m_n_threads;
+	if (n_threads < 1)
+	{
+		n_threads = (int)std::thread::hardware_concurrency();
+	}
+	n_threads = std::max(1, std::min(n_threads, n_rows));
 
-			pc_inputs.m_T_amb = T_amb_levels[j];
-			int off_design_code = mf_pc_eq(pc_inputs, pc_outputs);
-		
-			if( off_design_code == 0 )
+	if (n_threads == 1)
+	{
+		for (int k = 0; k < n_runs_total; k++)
+		{
+			v_runs[k].m_off_design_code = mf_pc_eq(v_runs[k].ms_inputs, v_runs[k].ms_outputs);
+
+			save_run(v_runs[k], k + 1, n_runs_total, T_htf_ind, T_amb_ind, m_dot_htf_ind);
+		}
+
+		return;
+	}
+
+	// Worker threads only solve the off-design model. Results are saved, and callbacks sent,
+	//    on this thread in run order so the log and any user termination match the serial case
+	std::vector<char> v_is_solved(n_runs_total, 0);
+	std::vector<std::exception_ptr> v_run_exception(n_runs_total);
+	std::mutex run_mutex;
+	std::condition_variable run_cv;
+	std::atomic<int> next_row(0);
+	std::atomic<bool> is_abort(false);
+
+	auto solve_rows = [&](C_od_pc_function & f_pc_eq)
+	{
+		for (int i_row = next_row++; i_row < n_rows && !is_abort; i_row = next_row++)
+		{
+			for (int k = 3*i_row; k < 3*i_row + 3; k++)
 			{
-				// Save outputs
-				m_dot_htf_ind(i,1+j) = pc_outputs.m_W_dot_gross_ND;		//[-]
-				m_dot_htf_ind(i,4+j) = pc_outputs.m_Q_dot_in_ND;		//[-]
-				m_dot_htf_ind(i,7+j) = pc_outputs.m_W_dot_cooling_ND;	//[-]
-				m_dot_htf_ind(i,10+j) = pc_outputs.m_m_dot_water_ND;	//[-]
+				std::exception_ptr p_exception;
+				try
+				{
+					v_runs[k].m_off_design_code = f_pc_eq(v_runs[k].ms_inputs, v_runs[k].ms_outputs);
+				}
+				catch (...)
+				{
+					p_exception = std::current_exception();
+				}
+
+				std::lock_guard<std::mutex> lock(run_mutex);
+				v_run_exception[k] = p_exception;
+				v_is_solved[k] = 1;
+				run_cv.notify_all();
 			}
-			else if (off_design_code == -1)
+		}
+	};
+
+	std::vector<std::thread> v_threads;
+	v_threads.reserve(n_threads);
+
+	try
+	{
+		// The first worker uses the caller's model
+		v_threads.push_back(std::thread([&]() { solve_rows(mf_pc_eq); }));
+
+		// The other workers each need their own model. If a model can't be cloned,
+		//    that worker exits and the remaining workers pick up its rows
+		for (int i_thread = 1; i_thread < n_threads; i_thread++)
+		{
+			v_threads.push_back(std::thread([&]()
 			{
-				// Save 'generic' off design model response
-				m_dot_htf_ind(i, 1 + j) = pc_inputs.m_m_dot_htf_ND;		//[-]
-				m_dot_htf_ind(i, 4 + j) = pc_inputs.m_m_dot_htf_ND;		//[-]
-				m_dot_htf_ind(i, 7 + j) = pc_inputs.m_m_dot_htf_ND;		//[-]
-				m_dot_htf_ind(i, 10 + j) = pc_inputs.m_m_dot_htf_ND;	//[-]
+				std::unique_ptr<C_od_pc_function> p_f_pc_eq;
+				try
+				{
+					p_f_pc_eq = mf_pc_eq.clone_for_thread();
+				}
+				catch (...)
+				{
+					p_f_pc_eq.reset();
+				}
+
+				if (p_f_pc_eq)
+				{
+					solve_rows(*p_f_pc_eq);
+				}
+			}));
+		}
 
-				is_od_model_error = true;
-			}
-			else
+		for (int k = 0; k < n_runs_total; k++)
+		{
+			std::exception_ptr p_exception;
 			{
-				std::string err_msg = util::format("The 3rd UDPC table (primary: m_dot_htf_ND, interaction: T_amb) generation failed at T_amb = %lg [C] and m_dot_htf = %lg [-]", pc_inputs.m_T_amb, pc_inputs.m_m_dot_htf_ND);
-				throw(C_csp_exception(err_msg, "UDPC"));
+				std::unique_lock<std::mutex> lock(run_mutex);
+				run_cv.wait(lock, [&]() { return v_is_solved[k] != 0; });
+				p_exception = v_run_exception[k];
 			}
 
-			double run_number = 3.0*n_T_htf + 3.0*n_T_amb  + i*3 + j;
+			if (p_exception)
+			{
+				std::rethrow_exception(p_exception);
+			}
 
-			send_callback(is_od_model_error, (int)run_number + 1, (int)n_runs_total,
-				pc_inputs.m_T_htf_hot, pc_inputs.m_m_dot_htf_ND, pc_inputs.m_T_amb,
-				m_dot_htf_ind(i, 1 + j), m_dot_htf_ind(i, 4 + j),
-				m_dot_htf_ind(i, 7 + j), m_dot_htf_ind(i, 10 + j));
+			save_run(v_runs[k], k + 1, n_runs_total, T_htf_ind, T_amb_ind, m_dot_htf_ind);
 		}
 	}
-	// ******************************************
-	
-	return 0;
+	catch (...)
+	{
+		// Stop claiming new rows and wait for the runs in progress before passing the error on
+		is_abort = true;
+		for (size_t i = 0; i < v_threads.size(); i++)
+		{
+			if (v_threads[i].joinable())
+				v_threads[i].join();
+		}
+		throw;
+	}
+
+	for (size_t i = 0; i < v_threads.size(); i++)
+	{
+		v_threads[i].join();
+	}
 }
 
 void N_udpc_common::get_var_setup(const std::vector<double>& vec_unique, const std::vector<double>& var_vec,
@@ -34,6 +34,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #define __UD_POWER_CYCLE_
 
 #include <limits>
+#include <memory>
 #include "interpolation_routines.h"
 #include "csp_solver_util.h"
 
@@ -214,11 +215,19 @@ public:
 	C_od_pc_function()
 	{
 	}
-	~C_od_pc_function()
+	virtual ~C_od_pc_function()
 	{
 	}
 
 	virtual int operator()(S_f_inputs inputs, S_f_outputs & outputs) = 0;
+
+	// Return an independent copy of the model that a worker thread can call while this one
+	//    is in use, or an empty pointer if the model can only be evaluated serially.
+	//    This is called from the worker thread, so it may only read from this object
+	virtual std::unique_ptr<C_od_pc_function> clone_for_thread()
+	{
+		return std::unique_ptr<C_od_pc_function>();
+	}
 };
 
 class C_ud_pc_table_generator
@@ -229,6 +238,29 @@ private:
 	std::string m_log_msg;
 	std::string m_progress_msg;	
 
+	struct S_od_run
+	{
+		int m_i_table;		//[-] 0: T_htf parametric, 1: T_amb parametric, 2: m_dot parametric
+		int m_i_row;		//[-] Row of the parametric table
+		int m_j_level;		//[-] Interaction level: 0 = low, 1 = design, 2 = high
+
+		C_od_pc_function::S_f_inputs ms_inputs;
+		C_od_pc_function::S_f_outputs ms_outputs;
+		int m_off_design_code;
+
+		S_od_run()
+		{
+			m_i_table = m_i_row = m_j_level = -1;
+			m_off_design_code = -1;
+		}
+	};
+
+	void solve_runs(std::vector<S_od_run> & v_runs,
+		util::matrix_t<double> & T_htf_ind, util::matrix_t<double> & T_amb_ind, util::matrix_t<double> & m_dot_htf_ind);
+
+	void save_run(const S_od_run & od_run, int run_number, int n_runs_total,
+		util::matrix_t<double> & T_htf_ind, util::matrix_t<double> & T_amb_ind, util::matrix_t<double> & m_dot_htf_ind);
+
 	void send_callback(bool is_od_model_error, int run_number, int n_runs_total,
 		double T_htf_hot, double m_dot_htf_ND, double T_amb,
 		double W_dot_gross_ND, double Q_dot_in_ND,
@@ -251,6 +283,10 @@ public:
 	bool(*mf_callback)(std::string &log_msg, std::string &progress_msg, void *data, double progress, int out_type);
 	void *mp_mf_active;
 
+	// Number of threads used to solve the off-design runs. Values < 1 use the hardware concurrency
+	//    Runs are only distributed if the off-design function can clone itself (C_od_pc_function::clone_for_thread)
+	int m_n_threads;	//[-]
+
 };
 
 namespace N_udpc_common
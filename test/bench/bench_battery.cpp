@@ -0,0 +1,65 @@
+/*
+BSD 3-Clause License
+
+Copyright (c) Alliance for Sustainable Energy, LLC. See also https://github.com/NREL/ssc/blob/develop/LICENSE
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+   contributors may be used to endorse or promote products derived from
+   this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "ssc_bench.h"
+#include "../input_cases/pvsamv1_common_data.h"
+#include "../input_cases/pvsamv1_battery_common_data.h"
+
+std::vector<bench_workload> battery_bench_workloads() {
+    return {
+        { "battery_btm", "pvsamv1 residential DC-coupled battery behind the meter, retail rate (price signal) dispatch",
+          [](ssc_data_t data) {
+              pvsamv_nofinancial_default(data);
+              battery_data_default(data);
+              setup_residential_utility_rates(data);
+              ssc_data_set_number(data, "en_batt", 1);
+              ssc_data_set_number(data, "batt_meter_position", 0);
+              ssc_data_set_number(data, "batt_ac_or_dc", 0);
+              ssc_data_set_number(data, "analysis_period", 1);
+              ssc_data_set_number(data, "batt_dispatch_choice", 4);
+              ssc_data_set_number(data, "batt_dispatch_auto_can_clipcharge", 1);
+              return set_array(data, "load", load_profile_path, 8760) == 1;
+          },
+          { "pvsamv1" } },
+        { "battery_fom", "pvsamv1 single owner AC-coupled battery in front of the meter, automated look-ahead dispatch",
+          [](ssc_data_t data) {
+              pvsamv1_pv_defaults(data);
+              pvsamv1_battery_defaults(data);
+              grid_and_rate_defaults(data);
+              singleowner_defaults(data);
+              ssc_data_set_number(data, "batt_dispatch_choice", 0);
+              ssc_data_set_number(data, "batt_dispatch_wf_forecast_choice", 0);
+              return true;
+          },
+          { "pvsamv1" } },
+    };
+}
@@ -0,0 +1,59 @@
+/*
+BSD 3-Clause License
+
+Copyright (c) Alliance for Sustainable Energy, LLC. See also https://github.com/NREL/ssc/blob/develop/LICENSE
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+   contributors may be used to endorse or promote products derived from
+   this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "ssc_bench.h"
+#include "../input_cases/pvsamv1_common_data.h"
+#include "../input_cases/singleowner_common.h"
+
+std::vector<bench_workload> financial_bench_workloads() {
+    return {
+        { "utilityrate5_lifetime", "utilityrate5 residential TOU defaults on 25 years of hourly pvsamv1 generation and load",
+          [](ssc_data_t data) {
+              pvsamv_nofinancial_default(data);
+              utility_rate5_default(data);
+              ssc_data_set_number(data, "system_use_lifetime_output", 1);
+              ssc_data_set_number(data, "analysis_period", 25);
+              ssc_number_t dc_degradation[1] = { 0.5 };
+              ssc_data_set_array(data, "dc_degradation", dc_degradation, 1);
+              if (set_array(data, "load", load_profile_path, 8760) != 1)
+                  return false;
+              // the generation profile is an input to the timed module, not part of the measurement
+              return run_module(data, "pvsamv1", false) == 0;
+          },
+          { "utilityrate5" } },
+        { "singleowner", "singleowner defaults, 25-year analysis period",
+          [](ssc_data_t data) {
+              return singleowner_common(data) == 0;
+          },
+          { "singleowner" } },
+    };
+}
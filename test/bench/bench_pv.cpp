@@ -0,0 +1,125 @@
+/*
+BSD 3-Clause License
+
+Copyright (c) Alliance for Sustainable Energy, LLC. See also https://github.com/NREL/ssc/blob/develop/LICENSE
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+   contributors may be used to endorse or promote products derived from
+   this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <vector>
+
+#include "ssc_bench.h"
+#include "../input_cases/pvsamv1_common_data.h"
+#include "../input_cases/pvwatts_cases.h"
+
+namespace {
+    const int lifetime_years = 25;
+
+    void set_pvsamv1_lifetime(ssc_data_t data) {
+        ssc_data_set_number(data, "system_use_lifetime_output", 1);
+        ssc_data_set_number(data, "analysis_period", lifetime_years);
+        ssc_number_t dc_degradation[1] = { 0.5 };
+        ssc_data_set_array(data, "dc_degradation", dc_degradation, 1);
+    }
+
+    /**
+    *   Replaces the hourly Phoenix weather file with a 5-minute solar_resource_data table, holding each hourly
+    *   record for its twelve 5-minute steps, so the subhourly workload does not need its own resource file.
+    */
+    bool set_five_minute_resource(ssc_data_t data) {
+        const int steps_per_hour = 12;
+        ssc_data_t wf = ssc_data_create();
+        ssc_data_set_string(wf, "file_name", solar_resource_path);
+        if (run_module(wf, "wfreader", false) != 0) {
+            ssc_data_free(wf);
+            return false;
+        }
+
+        ssc_data_t table = ssc_data_create();
+        const char *headers[4] = { "lat", "lon", "tz", "elev" };
+        for (auto name : headers) {
+            ssc_number_t value = 0;
+            ssc_data_get_number(wf, name, &value);
+            ssc_data_set_number(table, name, value);
+        }
+
+        // wfreader name -> solar_resource_data name
+        const char *columns[9][2] = { { "year", "year" }, { "month", "month" }, { "day", "day" }, { "hour", "hour" },
+                                      { "glob", "gh" }, { "beam", "dn" }, { "diff", "df" }, { "tdry", "tdry" },
+                                      { "wspd", "wspd" } };
+        int n_hourly = 0;
+        if (!ssc_data_get_array(wf, "year", &n_hourly) || n_hourly != 8760) {
+            ssc_data_free(table);
+            ssc_data_free(wf);
+            return false;
+        }
+        for (auto &column : columns) {
+            int n = 0;
+            ssc_number_t *hourly = ssc_data_get_array(wf, column[0], &n);
+            if (!hourly || n != n_hourly)
+                continue;
+            std::vector<ssc_number_t> values((size_t)n_hourly * steps_per_hour);
+            for (size_t i = 0; i < values.size(); i++)
+                values[i] = hourly[i / steps_per_hour];
+            ssc_data_set_array(table, column[1], &values[0], (int)values.size());
+        }
+        std::vector<ssc_number_t> minute((size_t)n_hourly * steps_per_hour);
+        for (size_t i = 0; i < minute.size(); i++)
+            minute[i] = (ssc_number_t)(5 * (i % steps_per_hour));
+        ssc_data_set_array(table, "minute", &minute[0], (int)minute.size());
+
+        ssc_data_unassign(data, "solar_resource_file");
+        ssc_data_set_table(data, "solar_resource_data", table);
+        ssc_data_free(table);
+        ssc_data_free(wf);
+        return true;
+    }
+}
+
+std::vector<bench_workload> pv_bench_workloads() {
+    return {
+        { "pvsamv1_hourly_lifetime", "pvsamv1 no-financial defaults, Phoenix TMY2, 25-year lifetime output",
+          [](ssc_data_t data) {
+              pvsamv_nofinancial_default(data);
+              set_pvsamv1_lifetime(data);
+              return true;
+          },
+          { "pvsamv1" } },
+        { "pvsamv1_5min_lifetime", "pvsamv1 no-financial defaults, Phoenix TMY2 held at 5-minute steps, 25-year lifetime output",
+          [](ssc_data_t data) {
+              pvsamv_nofinancial_default(data);
+              set_pvsamv1_lifetime(data);
+              return set_five_minute_resource(data);
+          },
+          { "pvsamv1" } },
+        { "pvwattsv8", "PVWatts no-financial defaults, Phoenix TMY2",
+          [](ssc_data_t data) {
+              return pvwatts_nofinancial_testfile(data) == 0;
+          },
+          { "pvwattsv8" } },
+    };
+}
@@ -0,0 +1,62 @@
+/*
+BSD 3-Clause License
+
+Copyright (c) Alliance for Sustainable Energy, LLC. See also https://github.com/NREL/ssc/blob/develop/LICENSE
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+   contributors may be used to endorse or promote products derived from
+   this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <vector>
+
+#include "ssc_bench.h"
+#include "../input_cases/windpower_cases.h"
+
+std::vector<bench_workload> wind_bench_workloads() {
+    return {
+        { "windpower_large_farm", "windpower defaults on a 300-turbine grid at 8 x 5 rotor diameters, eddy-viscosity wakes",
+          [](ssc_data_t data) {
+              if (windpower_nofinancial_testfile(data) != 0)
+                  return false;
+
+              const int n_cols = 15, n_rows = 20, n_turbines = n_cols * n_rows;
+              const double rotor_diameter = 77, turbine_kw = 1500;
+              std::vector<ssc_number_t> xcoord(n_turbines), ycoord(n_turbines);
+              for (int i = 0; i < n_turbines; i++) {
+                  // stagger alternate rows by half a column, as in the 32-turbine default layout
+                  xcoord[i] = (ssc_number_t)(8 * rotor_diameter * ((i % n_cols) + 0.5 * ((i / n_cols) % 2)));
+                  ycoord[i] = (ssc_number_t)(5 * rotor_diameter * (i / n_cols));
+              }
+              ssc_data_set_array(data, "wind_farm_xCoordinates", &xcoord[0], n_turbines);
+              ssc_data_set_array(data, "wind_farm_yCoordinates", &ycoord[0], n_turbines);
+              ssc_data_set_number(data, "max_turbine_override", n_turbines);
+              ssc_data_set_number(data, "system_capacity", (ssc_number_t)(n_turbines * turbine_kw));
+              ssc_data_set_number(data, "wind_farm_wake_model", 2);
+              return true;
+          },
+          { "windpower" } },
+    };
+}
@@ -0,0 +1,356 @@
+/*
+BSD 3-Clause License
+
+Copyright (c) Alliance for Sustainable Energy, LLC. See also https://github.com/NREL/ssc/blob/develop/LICENSE
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+   contributors may be used to endorse or promote products derived from
+   this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <new>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#if defined(_WIN32)
+#include <windows.h>
+#include <psapi.h>
+#pragma comment(lib, "psapi.lib")
+#else
+#include <sys/resource.h>
+#endif
+
+#include "ssc_bench.h"
+
+/**
+*   ssc_bench runs the canonical per-technology workloads in ssc_bench.h and writes one JSON document with the wall
+*   time, heap allocations and peak resident set size of each, so results can be compared release over release.
+*
+*   usage: ssc_bench [--list] [--repeat N] [--output FILE] [workload ...]
+*
+*   Only the modules of a workload are measured; its setup, including any prerequisite module runs, is not.
+*   Allocations are counted by the replacement operator new below, which also sees allocations made inside the ssc
+*   shared library on Linux and macOS but not inside a Windows DLL. On Linux the resident set high-water mark is
+*   reset before each measured run, elsewhere peak_rss_kb is the process peak up to the end of that workload.
+*/
+
+namespace {
+    std::atomic<bool> count_allocations(false);
+    std::atomic<unsigned long long> n_allocations(0);
+    std::atomic<unsigned long long> n_bytes_allocated(0);
+
+    void *counted_malloc(std::size_t size) {
+        if (count_allocations.load(std::memory_order_relaxed)) {
+            n_allocations.fetch_add(1, std::memory_order_relaxed);
+            n_bytes_allocated.fetch_add(size, std::memory_order_relaxed);
+        }
+        return std::malloc(size ? size : 1);
+    }
+}
+
+void *operator new(std::size_t size) {
+    if (void *p = counted_malloc(size))
+        return p;
+    throw std::bad_alloc();
+}
+
+void *operator new[](std::size_t size) {
+    return operator new(size);
+}
+
+void *operator new(std::size_t size, const std::nothrow_t &) noexcept {
+    return counted_malloc(size);
+}
+
+void *operator new[](std::size_t size, const std::nothrow_t &) noexcept {
+    return counted_malloc(size);
+}
+
+void operator delete(void *p) noexcept {
+    std::free(p);
+}
+
+void operator delete[](void *p) noexcept {
+    std::free(p);
+}
+
+void operator delete(void *p, const std::nothrow_t &) noexcept {
+    std::free(p);
+}
+
+void operator delete[](void *p, const std::nothrow_t &) noexcept {
+    std::free(p);
+}
+
+namespace {
+    /// Resets the peak resident set size so the next reading covers only what follows, returns false if unsupported
+    bool reset_peak_rss() {
+#if defined(__linux__)
+        FILE *fp = fopen("/proc/self/clear_refs", "w");
+        if (!fp)
+            return false;
+        bool ok = fputs("5", fp) >= 0;
+        return (fclose(fp) == 0) && ok;
+#else
+        return false;
+#endif
+    }
+
+    /// Peak resident set size [kB]
+    unsigned long long peak_rss_kb() {
+#if defined(_WIN32)
+        PROCESS_MEMORY_COUNTERS pmc;
+        if (GetProcessMemoryInfo(GetCurrentProcess(), &pmc, sizeof(pmc)))
+            return (unsigned long long)(pmc.PeakWorkingSetSize / 1024);
+        return 0;
+#else
+#if defined(__linux__)
+        std::ifstream status("/proc/self/status");
+        std::string line;
+        while (std::getline(status, line)) {
+            if (line.compare(0, 6, "VmHWM:") == 0)
+                return std::strtoull(line.c_str() + 6, nullptr, 10);
+        }
+#endif
+        struct rusage usage;
+        if (getrusage(RUSAGE_SELF, &usage) != 0)
+            return 0;
+#if defined(__APPLE__)
+        return (unsigned long long)usage.ru_maxrss / 1024;
+#else
+        return (unsigned long long)usage.ru_maxrss;
+#endif
+#endif
+    }
+
+    std::string json_string(const std::string &s) {
+        std::string out = "\"";
+        for (char c : s) {
+            switch (c) {
+            case '"': out += "\\\""; break;
+            case '\\': out += "\\\\"; break;
+            case '\n': out += "\\n"; break;
+            case '\r': out += "\\r"; break;
+            case '\t': out += "\\t"; break;
+            default:
+                if ((unsigned char)c < 0x20) {
+                    char buf[8];
+                    sprintf(buf, "\\u%04x", c);
+                    out += buf;
+                }
+                else
+                    out += c;
+            }
+        }
+        return out + "\"";
+    }
+
+    std::string json_number(double d) {
+        char buf[32];
+        sprintf(buf, "%.6f", d);
+        return buf;
+    }
+
+    struct bench_result {
+        std::string status = "ok";
+        std::string message;
+        std::vector<double> wall_s;
+        unsigned long long allocations = 0;
+        unsigned long long bytes_allocated = 0;
+        unsigned long long peak_rss_kb = 0;
+    };
+
+    /// Runs the module on data, returning an empty string on success or the first error message
+    std::string exec_module(const std::string &name, ssc_data_t data) {
+        ssc_module_t module = ssc_module_create(name.c_str());
+        if (!module)
+            return "could not create module " + name;
+        std::string error;
+        try {
+            if (!ssc_module_exec(module, data)) {
+                error = name + " failed";
+                int type = 0;
+                float time = 0;
+                if (const char *text = ssc_module_log(module, 0, &type, &time))
+                    error += ": " + std::string(text);
+            }
+        }
+        catch (std::exception &e) {
+            error = name + " threw: " + e.what();
+        }
+        ssc_module_free(module);
+        return error;
+    }
+
+    bench_result run_workload(const bench_workload &workload, int repeat, bool &rss_per_workload) {
+        bench_result result;
+        for (int r = 0; r < repeat; r++) {
+            ssc_data_t data = ssc_data_create();
+            if (!workload.setup(data)) {
+                ssc_data_free(data);
+                result.status = "setup_failed";
+                return result;
+            }
+
+            rss_per_workload = reset_peak_rss() && rss_per_workload;
+            n_allocations = 0;
+            n_bytes_allocated = 0;
+            count_allocations = true;
+            auto start = std::chrono::steady_clock::now();
+            for (auto &name : workload.modules) {
+                result.message = exec_module(name, data);
+                if (!result.message.empty())
+                    break;
+            }
+            auto end = std::chrono::steady_clock::now();
+            count_allocations = false;
+            ssc_data_free(data);
+
+            if (!result.message.empty()) {
+                result.status = "failed";
+                return result;
+            }
+            // allocation counts are deterministic up to caching, so the last repeat's are reported
+            result.wall_s.push_back(std::chrono::duration<double>(end - start).count());
+            result.allocations = n_allocations;
+            result.bytes_allocated = n_bytes_allocated;
+            result.peak_rss_kb = std::max(result.peak_rss_kb, peak_rss_kb());
+        }
+        return result;
+    }
+
+    std::vector<bench_workload> all_workloads() {
+        std::vector<bench_workload> workloads;
+        for (auto group : { pv_bench_workloads, battery_bench_workloads, wind_bench_workloads,
+                            financial_bench_workloads, csp_bench_workloads }) {
+            auto w = group();
+            workloads.insert(workloads.end(), w.begin(), w.end());
+        }
+        return workloads;
+    }
+
+    int usage() {
+        std::cerr << "usage: ssc_bench [--list] [--repeat N] [--output FILE] [workload ...]" << std::endl;
+        return 1;
+    }
+}
+
+int main(int argc, char **argv) {
+    int repeat = 3;
+    bool list = false;
+    std::string output;
+    std::vector<std::string> selected;
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "--list")
+            list = true;
+        else if (arg == "--repeat" && i + 1 < argc)
+            repeat = std::max(1, atoi(argv[++i]));
+        else if (arg == "--output" && i + 1 < argc)
+            output = argv[++i];
+        else if (arg.compare(0, 2, "--") == 0)
+            return usage();
+        else
+            selected.push_back(arg);
+    }
+
+    std::vector<bench_workload> workloads = all_workloads();
+    if (list) {
+        for (auto &w : workloads)
+            std::cout << w.name << "\t" << w.description << std::endl;
+        return 0;
+    }
+    for (auto &name : selected) {
+        if (std::none_of(workloads.begin(), workloads.end(), [&](const bench_workload &w) { return w.name == name; })) {
+            std::cerr << "unknown workload " << name << ", see ssc_bench --list" << std::endl;
+            return 1;
+        }
+    }
+    if (!std::getenv("SSCDIR")) {
+        std::cerr << "SSCDIR must be set to the ssc source directory to find the input_cases data" << std::endl;
+        return 1;
+    }
+
+    ssc_module_exec_set_print(0);
+    bool rss_per_workload = true;
+    bool all_ok = true;
+    std::ostringstream results;
+    for (auto &w : workloads) {
+        if (!selected.empty() && std::find(selected.begin(), selected.end(), w.name) == selected.end())
+            continue;
+        std::cerr << "running " << w.name << std::endl;
+        bench_result r = run_workload(w, repeat, rss_per_workload);
+        all_ok = all_ok && r.status == "ok";
+
+        std::vector<double> sorted = r.wall_s;
+        std::sort(sorted.begin(), sorted.end());
+        if (results.tellp() > 0)
+            results << ",\n";
+        results << "    {\"name\": " << json_string(w.name) << ", \"description\": " << json_string(w.description)
+                << ", \"modules\": [";
+        for (size_t i = 0; i < w.modules.size(); i++)
+            results << (i ? ", " : "") << json_string(w.modules[i]);
+        results << "], \"status\": " << json_string(r.status);
+        if (!r.message.empty())
+            results << ", \"message\": " << json_string(r.message);
+        results << ", \"wall_s\": [";
+        for (size_t i = 0; i < r.wall_s.size(); i++)
+            results << (i ? ", " : "") << json_number(r.wall_s[i]);
+        results << "]";
+        if (!sorted.empty()) {
+            results << ", \"wall_s_min\": " << json_number(sorted.front())
+                    << ", \"wall_s_median\": " << json_number(sorted[sorted.size() / 2])
+                    << ", \"allocations\": " << r.allocations << ", \"bytes_allocated\": " << r.bytes_allocated
+                    << ", \"peak_rss_kb\": " << r.peak_rss_kb;
+        }
+        results << "}";
+    }
+
+    std::ostringstream doc;
+    doc << "{\n  \"ssc_version\": " << ssc_version() << ",\n  \"build_info\": " << json_string(ssc_build_info())
+        << ",\n  \"repeat\": " << repeat << ",\n  \"rss_scope\": " << json_string(rss_per_workload ? "run" : "process")
+        << ",\n  \"workloads\": [\n" << results.str() << "\n  ]\n}\n";
+
+    if (output.empty())
+        std::cout << doc.str();
+    else {
+        std::ofstream out(output);
+        if (!out) {
+            std::cerr << "could not open " << output << std::endl;
+            return 1;
+        }
+        out << doc.str();
+    }
+    return all_ok ? 0 : 2;
+}
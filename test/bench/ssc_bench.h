@@ -0,0 +1,63 @@
+/*
+BSD 3-Clause License
+
+Copyright (c) Alliance for Sustainable Energy, LLC. See also https://github.com/NREL/ssc/blob/develop/LICENSE
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+   contributors may be used to endorse or promote products derived from
+   this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifndef SYSTEM_ADVISOR_MODEL_SSC_BENCH_H
+#define SYSTEM_ADVISOR_MODEL_SSC_BENCH_H
+
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "sscapi.h"
+
+/**
+*  A canonical benchmark workload: setup fills a fresh data container from the input_cases defaults and may run
+*  prerequisite modules, then only the listed modules are timed, in order, on that container.
+*/
+struct bench_workload {
+    std::string name;
+    std::string description;
+    std::function<bool(ssc_data_t)> setup;
+    std::vector<std::string> modules;
+};
+
+std::vector<bench_workload> pv_bench_workloads();
+
+std::vector<bench_workload> battery_bench_workloads();
+
+std::vector<bench_workload> wind_bench_workloads();
+
+std::vector<bench_workload> financial_bench_workloads();
+
+std::vector<bench_workload> csp_bench_workloads();
+
+#endif //SYSTEM_ADVISOR_MODEL_SSC_BENCH_H
@@ -92,3 +92,63 @@ TEST(SixParSolve_6par_solve, CIGSModules) {
         EXPECT_GT(err, -1);
     }
 }
+
+TEST(SixParSolve_6par_solve, BatchAndCache) {
+    // Vmp, Imp, Voc, Isc, alpha_isc, beta_voc, gamma_pmp, Nser, Tref
+    std::vector<std::vector<double>> datasheet_values {
+            {31.8, 17.29, 38.1, 18.39, 0.007356, -0.09525, -0.34, 110, 43},
+            {34.6, 17.34, 41.7, 18.42, 0.007368, -0.10425, -0.34, 120, 43},
+            {34.85, 17.22, 41.4, 18.5, 0.0074, -0.11178, -0.35, 120, 44},
+            {88.3, 1.7, 108.9, 1.83, 0.000183, -0.29403, -0.32, 96, 42}
+    };
+    int tech_id[4] = { module6par::monoSi, module6par::monoSi, module6par::monoSi, module6par::CIGS };
+
+    std::vector<module6par> modules, expected;
+    for (size_t i = 0; i < datasheet_values.size(); i++) {
+        auto mod = datasheet_values[i];
+        modules.push_back(module6par(tech_id[i], mod[0], mod[1], mod[2], mod[3], mod[5], mod[4], mod[6], (int)mod[7], mod[8] + 273.15));
+    }
+    std::vector<module6par> inputs = modules;
+    for (auto m : inputs) {
+        m.solve_with_sanity_and_heuristics<double>(300, 1e-7);
+        expected.push_back(m);
+    }
+
+    module6par_cache& cache = module6par_cache::instance();
+    cache.clear();
+    std::vector<int> err = module6par_solve_batch(modules, 300, 1e-7, 2, &cache);
+    ASSERT_EQ(err.size(), modules.size());
+    EXPECT_EQ(cache.size(), modules.size());
+    for (size_t i = 0; i < modules.size(); i++) {
+        EXPECT_GT(err[i], -1);
+        EXPECT_EQ(modules[i].a, expected[i].a);
+        EXPECT_EQ(modules[i].Io, expected[i].Io);
+        EXPECT_EQ(modules[i].Rsh, expected[i].Rsh);
+        EXPECT_EQ(modules[i].Adj, expected[i].Adj);
+    }
+
+    // solved coefficients survive a round trip through the cache file
+    std::string file = "6par_cache_test.txt";
+    util::remove_file(file.c_str());
+    EXPECT_TRUE(cache.load(file));
+    EXPECT_TRUE(cache.save(file));
+    cache.clear();
+    EXPECT_TRUE(cache.load(file));
+    EXPECT_EQ(cache.size(), modules.size());
+    for (size_t i = 0; i < inputs.size(); i++) {
+        module6par m = inputs[i];
+        int cached_err = -100;
+        ASSERT_TRUE(cache.lookup(m, 300, 1e-7, &cached_err));
+        EXPECT_EQ(cached_err, err[i]);
+        EXPECT_EQ(m.a, expected[i].a);
+        EXPECT_EQ(m.Il, expected[i].Il);
+        EXPECT_EQ(m.Io, expected[i].Io);
+        EXPECT_EQ(m.Rs, expected[i].Rs);
+        EXPECT_EQ(m.Rsh, expected[i].Rsh);
+        EXPECT_EQ(m.Adj, expected[i].Adj);
+    }
+    EXPECT_FALSE(cache.lookup(inputs[0], 100, 1e-7, nullptr)) << "Solver settings are part of the key";
+
+    cache.clear();
+    util::remove_file(file.c_str());
+}
@@ -32,6 +32,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 
 #include "lib_battery_dispatch_automatic_fom_test.h"
+#include <numeric>
 
 
 TEST_F(AutoFOM_lib_battery_dispatch, DispatchFOMInput) {
@@ -664,3 +665,57 @@ TEST_F(AutoFOM_lib_battery_dispatch, DispatchFOM_DCAuto_ClipChargeFlatRate) {
 
     }
 }
+
+/// Exposes the clipped energy forecast window of the front of meter dispatch
+class dispatch_automatic_front_of_meter_cliploss_t : public dispatch_automatic_front_of_meter_t {
+public:
+    using dispatch_automatic_front_of_meter_t::dispatch_automatic_front_of_meter_t;
+    size_t cliploss_window_width() const { return _cliploss_window.width(); }
+    double cliploss_window_sum() const { return _cliploss_window.sum(); }
+};
+
+TEST_F(AutoFOM_lib_battery_dispatch, DispatchFOM_DCAuto_ClipChargeLookBehind) {
+    double dtHour = 1;
+    CreateBattery(dtHour);
+
+    pv = { 21603.3, 70098.2, 44484.7, 86767.2, 87052.4, 86202.2,
+            84205.4, 78854.6, 78854.6, 78854.6, 0, 0,
+            0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0 };
+    clip = { 0, 0, 0, 9767.18, 10052.4, 9202.19,
+            7205.42, 1854.6, 1854.6, 1854.6, 0, 0,
+            0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0 };
+    ppaRate = std::vector<double>(48, 0.04938);
+    cyclingCost = { 0.0 };
+
+    // Look behind always forecasts 24 hours, whatever look ahead hours are given
+    auto dispatchLookBehind = new dispatch_automatic_front_of_meter_cliploss_t(batteryModel, dtHour, 10, 100, 1, 49960, 49960, max_power,
+        max_power, max_power, max_power, 1, dispatch_t::FOM_AUTOMATED_ECONOMIC, dispatch_t::WEATHER_FORECAST_CHOICE::WF_LOOK_BEHIND, dispatch_t::FRONT, 1, 18, 1, true, true, false,
+        false, 77000, replacementCost, 1, cyclingCost, omCost, ppaRate, ur, 98, 98, 98, interconnection_limit);
+    dispatchAuto = dispatchLookBehind;
+    EXPECT_EQ(dispatchLookBehind->cliploss_window_width(), (size_t)24);
+
+    dispatchAuto->update_pv_data(pv);
+    dispatchAuto->update_cliploss_data(clip);
+    batteryPower = dispatchAuto->getBatteryPower();
+    batteryPower->connectionMode = ChargeController::DC_CONNECTED;
+    batteryPower->voltageSystem = 600;
+    batteryPower->setSharedInverter(m_sharedInverter);
+
+    // clipping forecast wraps to the start of the year
+    std::vector<double> clipLifetime = clip;
+    clipLifetime.insert(clipLifetime.end(), clip.begin(), clip.end());
+
+    for (size_t h = 0; h < 24; h++) {
+        batteryPower->powerGeneratedBySystem = pv[h];
+        batteryPower->powerSystem = pv[h];
+        batteryPower->powerSystemClipped = clip[h];
+
+        dispatchAuto->update_dispatch(0, h, 0, h);
+        double clipForecast = std::accumulate(clipLifetime.begin() + h, clipLifetime.begin() + h + 24, 0.0);
+        EXPECT_NEAR(dispatchLookBehind->cliploss_window_sum(), clipForecast, 1e-6) << "error in clipped energy forecast at hour " << h;
+
+        dispatchAuto->dispatch(0, h, 0);
+    }
+}
@@ -410,6 +410,51 @@ TEST_F(lib_battery_test, runDuplicates) {
     delete Battery;
 }
 
+TEST_F(lib_battery_test, checkpointRollback) {
+    size_t idx = 0;
+    double I;
+    for (size_t i = 0; i < 30; i++) {
+        I = (i / 5) % 2 ? -Qfull * n_strings : Qfull * n_strings;
+        batteryModel->run(idx++, I);
+    }
+
+    battery_checkpoint cp;
+    batteryModel->save_checkpoint(cp);
+    auto saved = batteryModel->get_state();
+    auto duplicate = std::unique_ptr<battery_t>(new battery_t(*batteryModel));
+
+    // run past the checkpoint, completing more cycles, then roll back
+    for (size_t i = 0; i < 30; i++) {
+        I = (i / 3) % 2 ? Qfull * n_strings : -Qfull * n_strings;
+        batteryModel->run(idx + i, I);
+    }
+    EXPECT_NE(batteryModel->get_state().lifetime->cycle->rainflow_peaks, saved.lifetime->cycle->rainflow_peaks);
+    batteryModel->restore_checkpoint(cp);
+
+    auto restored = batteryModel->get_state();
+    EXPECT_EQ(restored.last_idx, saved.last_idx);
+    EXPECT_EQ(restored.I, saved.I);
+    EXPECT_EQ(restored.P_chargeable, saved.P_chargeable);
+    EXPECT_TRUE(*restored.capacity == *saved.capacity);
+    EXPECT_TRUE(*restored.voltage == *saved.voltage);
+    EXPECT_EQ(restored.thermal->T_batt, saved.thermal->T_batt);
+    EXPECT_EQ(restored.lifetime->q_relative, saved.lifetime->q_relative);
+    EXPECT_EQ(restored.lifetime->n_cycles, saved.lifetime->n_cycles);
+    EXPECT_EQ(restored.lifetime->cycle->rainflow_peaks, saved.lifetime->cycle->rainflow_peaks);
+    EXPECT_EQ(restored.lifetime->cycle->cycle_counts, saved.lifetime->cycle->cycle_counts);
+    EXPECT_TRUE(*restored.lifetime->calendar == *saved.lifetime->calendar);
+
+    // the restored battery continues exactly as a copy taken at the checkpoint
+    for (size_t i = 0; i < 10; i++) {
+        I = Qfull * n_strings;
+        double I_dup = I;
+        batteryModel->run(idx + i, I);
+        duplicate->run(idx + i, I_dup);
+        EXPECT_EQ(batteryModel->V(), duplicate->V());
+        EXPECT_EQ(batteryModel->SOC(), duplicate->SOC());
+    }
+}
+
 TEST_F(lib_battery_test, createFromParams) {
     auto params = std::make_shared<battery_params>(batteryModel->get_params());
     auto bat = battery_t(params);
@@ -1383,3 +1383,21 @@ TEST_F(voltage_vanadium_lib_battery_voltage_test, calculateMaxDischargeSubMinute
     cap->updateCapacity(max_current, dt_hour);
     EXPECT_NEAR(cap->SOC(), 13.93, 1e-3);
 }
+
+TEST_F(voltage_vanadium_lib_battery_voltage_test, calculateCurrentForTargetBracketed){
+    double dt_hour = 1;
+    CreateModel(dt_hour);
+
+    // charge power beyond the limit cannot push the current past full charge
+    double max_current;
+    double power = model->calculate_max_charge_w(cap->q0(), cap->qmax(), 293, &max_current);
+    double current = model->calculate_current_for_target_w(power * 2, cap->q0(), cap->qmax(), 293);
+    EXPECT_LT(current, 0);
+    EXPECT_GE(current, (cap->q0() - cap->qmax()) / dt_hour - 1e-6);
+
+    // discharge solution lies on the rising side of the power curve
+    power = model->calculate_max_discharge_w(cap->q0(), cap->qmax(), 293, &max_current);
+    current = model->calculate_current_for_target_w(power * 0.5, cap->q0(), cap->qmax(), 293);
+    EXPECT_GT(current, 0);
+    EXPECT_LT(current, max_current);
+}
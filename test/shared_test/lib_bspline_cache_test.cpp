@@ -0,0 +1,110 @@
+/*
+BSD 3-Clause License
+
+Copyright (c) Alliance for Sustainable Energy, LLC. See also https://github.com/NREL/ssc/blob/develop/LICENSE
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+   contributors may be used to endorse or promote products derived from
+   this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "lib_bspline_cache.h"
+#include "bsplinebuilder.h"
+#include "datatable.h"
+
+namespace {
+    // OND-style efficiency curve, power [W] and efficiency [%]
+    std::vector<double> eff_X = { 1000., 2000., 5000., 10000., 20000., 30000., 40000., 50000. };
+    std::vector<double> eff_Y = { 90.1, 94.2, 96.8, 97.6, 98.0, 98.1, 98.0, 97.9 };
+}
+
+TEST(lib_bspline_cache, sameCurveFitOnce) {
+    bspline_cache &cache = bspline_cache::instance();
+    cache.clear();
+
+    auto first = cache.fit(eff_X, eff_Y);
+    auto second = cache.fit(eff_X, eff_Y);
+    EXPECT_EQ(first.get(), second.get());
+    EXPECT_EQ(cache.size(), 1);
+
+    std::vector<double> other_Y = eff_Y;
+    other_Y.back() = 97.8;
+    auto third = cache.fit(eff_X, other_Y);
+    EXPECT_NE(first.get(), third.get());
+    EXPECT_EQ(cache.size(), 2);
+
+    cache.clear();
+    EXPECT_EQ(cache.size(), 0);
+}
+
+TEST(lib_bspline_cache, matchesDirectFit) {
+    DataTable samples;
+    for (size_t i = 0; i < eff_X.size(); i++)
+        samples.addSample(eff_X[i], eff_Y[i]);
+    BSpline direct = BSpline::Builder(samples).degree(3).build();
+
+    auto cached = bspline_cache::instance().fit(eff_X, eff_Y);
+    std::vector<double> x, y;
+    for (double p = 1000.; p <= 50000.; p += 1250.)
+        x.push_back(p);
+    bspline_eval(*cached, x, y);
+
+    ASSERT_EQ(y.size(), x.size());
+    DenseVector point(1);
+    for (size_t i = 0; i < x.size(); i++) {
+        point(0) = x[i];
+        EXPECT_DOUBLE_EQ(y[i], direct.eval(point)) << "at " << x[i];
+    }
+}
+
+TEST(lib_bspline_cache, multipleCurves) {
+    bspline_cache &cache = bspline_cache::instance();
+    cache.clear();
+
+    std::vector<std::vector<double>> X = { eff_X, eff_X, eff_X };
+    std::vector<std::vector<double>> Y = { eff_Y, eff_Y, eff_Y };
+    for (double &v : Y[1]) v -= 0.5;
+    for (double &v : Y[2]) v -= 1.0;
+
+    auto splines = cache.fit(X, Y);
+    ASSERT_EQ(splines.size(), 3);
+    EXPECT_EQ(cache.size(), 3);
+    EXPECT_EQ(splines[0].get(), cache.fit(eff_X, eff_Y).get());
+
+    DenseVector point(1);
+    point(0) = 25000.;
+    EXPECT_NEAR(splines[0]->eval(point) - splines[1]->eval(point), 0.5, 1e-9);
+    EXPECT_NEAR(splines[0]->eval(point) - splines[2]->eval(point), 1.0, 1e-9);
+
+    // refitting the same curves only hits the cache
+    auto again = cache.fit(X, Y);
+    for (size_t j = 0; j < 3; j++)
+        EXPECT_EQ(splines[j].get(), again[j].get());
+    EXPECT_EQ(cache.size(), 3);
+    cache.clear();
+}
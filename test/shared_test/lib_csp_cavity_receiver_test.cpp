@@ -0,0 +1,100 @@
+/*
+BSD 3-Clause License
+
+Copyright (c) Alliance for Sustainable Energy, LLC. See also https://github.com/NREL/ssc/blob/develop/LICENSE
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+   contributors may be used to endorse or promote products derived from
+   this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+
+#include <gtest/gtest.h>
+#include <memory>
+
+#include "csp_solver_cavity_receiver.h"
+#include "sam_csp_util.h"
+#include "vs_google_test_explorer_namespace.h"
+#include "csp_common_test.h"
+
+namespace csp_tower {}
+using namespace csp_tower;
+
+namespace {
+    // Meshed receiver from cavity_receiver_helpers::test_cavity_case()
+    C_cavity_receiver* make_cavity_receiver()
+    {
+        util::matrix_t<double> ud_rec_htf;
+
+        return new C_cavity_receiver(950 /*W/m2*/,
+            17 /*-*/, ud_rec_htf,
+            0.050 /*m*/, 0.005 / 2.0 /*m*/, 2 /*-*/,
+            6 /*-*/, 10 /*m*/, 10 /*m*/,
+            CSP::pi /*rad*/, 1 /*m*/, 1 /*m*/,
+            0.965 /*-*/, 0.05 /*-*/, 0.85 /*-*/, 0.25 /*-*/,
+            C_cavity_receiver::E_mesh_types::quad, C_cavity_receiver::E_mesh_types::no_mesh, C_cavity_receiver::E_mesh_types::quad,
+            0.0 /*Wt/m*/, 0.0 /*m*/, 0.0 /*-*/,
+            0.0 /*m*/, 574.0 /*C*/,
+            290.0 /*C*/, 0.25 /*-*/, 25.0 / 0.5 * 2.0 /*MWt*/,
+            0.0 /*hr*/, 0.0 /*-*/, 0.0 /*-*/,
+            0.85 /*-*/);
+    }
+}
+
+NAMESPACE_TEST(csp_tower, CavityReceiver, ViewFactorsSerialParallelCached)
+{
+    cavity_receiver_helpers::clear_cached_view_factors();
+
+    std::unique_ptr<C_cavity_receiver> rec_serial(make_cavity_receiver());
+    rec_serial->init();
+    util::matrix_t<double> F_serial = rec_serial->get_view_factors();
+    ASSERT_GT(F_serial.nrows(), (size_t)1);
+
+    cavity_receiver_helpers::clear_cached_view_factors();
+
+    std::unique_ptr<C_cavity_receiver> rec_parallel(make_cavity_receiver());
+    rec_parallel->set_n_threads_view_factors(4);
+    rec_parallel->init();
+    const util::matrix_t<double>& F_parallel = rec_parallel->get_view_factors();
+
+    // Second receiver with the same geometry reads the view factors from the cache
+    std::unique_ptr<C_cavity_receiver> rec_cached(make_cavity_receiver());
+    rec_cached->init();
+    const util::matrix_t<double>& F_cached = rec_cached->get_view_factors();
+
+    ASSERT_EQ(F_parallel.nrows(), F_serial.nrows());
+    ASSERT_EQ(F_parallel.ncols(), F_serial.ncols());
+    ASSERT_EQ(F_cached.nrows(), F_serial.nrows());
+    ASSERT_EQ(F_cached.ncols(), F_serial.ncols());
+    for (size_t i = 0; i < F_serial.nrows(); i++) {
+        for (size_t j = 0; j < F_serial.ncols(); j++) {
+            EXPECT_EQ(F_parallel(i, j), F_serial(i, j)) << "parallel view factor (" << i << ", " << j << ")";
+            EXPECT_EQ(F_cached(i, j), F_serial(i, j)) << "cached view factor (" << i << ", " << j << ")";
+        }
+    }
+
+    cavity_receiver_helpers::clear_cached_view_factors();
+}
@@ -0,0 +1,108 @@
+/*
+BSD 3-Clause License
+
+Copyright (c) Alliance for Sustainable Energy, LLC. See also https://github.com/NREL/ssc/blob/develop/LICENSE
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+   contributors may be used to endorse or promote products derived from
+   this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+#include <gtest/gtest.h>
+
+#include "htf_props.h"
+
+namespace {
+    // Fine midpoint-rule average of Cp, used as the reference for the closed-form averages
+    double Cp_ave_numeric(HTFProperties &htf, double T_cold_K, double T_hot_K)
+    {
+        const int n = 20000;
+        double cp_sum = 0.0;
+        for (int i = 0; i < n; i++)
+            cp_sum += htf.Cp(T_cold_K + (i + 0.5) * (T_hot_K - T_cold_K) / n);
+        return cp_sum / n;
+    }
+}
+
+TEST(HTFPropertiesTest, CpAveLibraryFluids)
+{
+    int fluids[] = { HTFProperties::Nitrate_Salt, HTFProperties::Therminol_VP1, HTFProperties::Salt_60_NaNO3_40_KNO3,
+        HTFProperties::Salt_45MgCl2_39KCl_16NaCl, HTFProperties::N07740, HTFProperties::Hitec_XL };
+
+    for (int fluid : fluids) {
+        HTFProperties htf;
+        htf.SetFluid(fluid);
+        for (double T_cold = 300.; T_cold < 900.; T_cold += 75.) {
+            double T_hot = T_cold + 150.;
+            EXPECT_NEAR(htf.Cp_ave(T_cold, T_hot), Cp_ave_numeric(htf, T_cold, T_hot), 1.e-4 * htf.Cp(T_cold)) << "fluid " << fluid;
+            EXPECT_NEAR(htf.Cp_ave(T_hot, T_cold), htf.Cp_ave(T_cold, T_hot), 1.e-12 * htf.Cp(T_cold)) << "fluid " << fluid;
+        }
+    }
+}
+
+TEST(HTFPropertiesTest, CpAveUserDefinedFluid)
+{
+    // Piecewise linear Cp with a kink at every row
+    util::matrix_t<double> table(5, 7, 0.0);
+    double T_C[5] = { 100., 200., 300., 400., 500. };
+    double cp[5] = { 1.5, 1.7, 1.6, 2.0, 2.1 };
+    for (int i = 0; i < 5; i++) {
+        table(i, 0) = T_C[i];
+        table(i, 1) = cp[i];
+        table(i, 2) = 1000.;
+        table(i, 3) = 1.e-3;
+        table(i, 4) = 1.e-6;
+        table(i, 5) = 0.5;
+        table(i, 6) = 1000. * i;
+    }
+
+    HTFProperties htf;
+    ASSERT_TRUE(htf.SetUserDefinedFluid(table));
+
+    // Intervals within one row, across rows, and extrapolated past both ends of the table
+    double T_cold_K[4] = { 373.15 + 10., 373.15 + 50., 300., 600. };
+    double T_hot_K[4] = { 373.15 + 20., 373.15 + 350., 450., 850. };
+    for (int i = 0; i < 4; i++) {
+        EXPECT_NEAR(htf.Cp_ave(T_cold_K[i], T_hot_K[i]), Cp_ave_numeric(htf, T_cold_K[i], T_hot_K[i]), 1.e-8);
+    }
+    EXPECT_NEAR(htf.Cp_ave(473.15, 473.15), 1.7, 1.e-12);
+}
+
+TEST(HTFPropertiesTest, ArrayVariantsMatchScalar)
+{
+    HTFProperties htf;
+    htf.SetFluid(HTFProperties::Therminol_VP1);
+
+    double T_K[4] = { 300., 450., 600., 650. };
+    double T_hot_K[4] = { 350., 550., 700., 651. };
+    double cp[4], cp_ave[4];
+    htf.Cp(T_K, cp, 4);
+    htf.Cp_ave(T_K, T_hot_K, cp_ave, 4);
+    for (int i = 0; i < 4; i++) {
+        EXPECT_EQ(cp[i], htf.Cp(T_K[i]));
+        EXPECT_EQ(cp_ave[i], htf.Cp_ave(T_K[i], T_hot_K[i]));
+    }
+}
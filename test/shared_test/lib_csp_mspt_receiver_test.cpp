@@ -0,0 +1,134 @@
+/*
+BSD 3-Clause License
+
+Copyright (c) Alliance for Sustainable Energy, LLC. See also https://github.com/NREL/ssc/blob/develop/LICENSE
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+   contributors may be used to endorse or promote products derived from
+   this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+
+#include <gtest/gtest.h>
+#include <cmath>
+
+#include "csp_solver_mspt_receiver.h"
+#include "vs_google_test_explorer_namespace.h"
+#include "csp_common_test.h"
+
+namespace csp_tower {}
+using namespace csp_tower;
+
+// Transient receiver model over ten cloudy days, compared against results from before
+//   the transient solution operators were precomputed
+NAMESPACE_TEST(csp_tower, MsptReceiver, TransientCloudyDays)
+{
+    const double tol = 1.e-8;       //[-] relative, results are expected to be unchanged to round-off
+
+    util::matrix_t<double> field_fl_props;
+    C_mspt_receiver rec(193.458 /*m*/, 0.88 /*-*/,
+        574.0 /*C*/, 290.0 /*C*/,
+        0.25 /*-*/, 670.0 /*MWt*/,
+        0.2 /*hr*/, 0.25 /*-*/,
+        1.2 /*-*/, 0.85 /*-*/,
+        40.0 /*mm*/, 1.25 /*mm*/,
+        10.2 /*Wt/m2-K*/, 0.0 /*m*/, 2.6 /*-*/,
+        17, field_fl_props,
+        2 /*-*/,
+        0 /*-*/,
+        20 /*-*/, 17.65 /*m*/, 21.6 /*m*/,
+        1 /*-*/, 0 /*-*/, 1.0 /*-*/,
+        574.0 /*C*/, 0.0 /*-*/,
+        false, 0.0 /*MWe*/,
+        true, false,
+        1.0 /*-*/, 4.0 /*m/s*/,
+        15.0 /*mm*/, 1.0 /*-*/,
+        1.0 /*-*/, 500.0 /*kW/m*/,
+        50.0 /*kW/m2*/, 36.0 / 60.0 /*hr*/,
+        10.0 / 60.0 /*hr*/, 0.0 /*hr*/,
+        290.0 /*C*/, -5.0 /*C*/,
+        5.0 /*C*/,
+        false, true);
+    rec.init();
+
+    size_t n_panels = 20;
+    util::matrix_t<double> flux_map(1, n_panels);
+    C_csp_collector_receiver::E_csp_cr_modes mode = C_csp_collector_receiver::STARTUP;
+
+    // Steps at startup, cloud transients, and overnight
+    std::vector<int> check_steps = { 2, 18, 19, 24, 25, 38, 39, 500 };
+    std::vector<double> Q_exp = { 0, 688.8351892, 721.5195327, 236.2515807, 805.1570663, 180.8765854, 805.9175933, 0 };
+    std::vector<double> T_exp = { 290, 574.7204431, 573.7262746, 571.6486922, 574.3648705, 569.853947, 574.6550088, 290 };
+    std::vector<double> T_max_exp = { 290, 584.8591518, 573.8719708, 574.2775575, 580.9577991, 573.8207974, 584.0559247, 290 };
+    std::vector<double> T_wall_exp = { 0, 353.0021471, 354.7447771, 328.5511691, 359.2819806, 325.5391012, 359.2827502, 354.7464502 };
+
+    double Q_sum = 0, T_sum = 0, m_dot_sum = 0, T_max_sum = 0, T_rec_max_sum = 0, T_wall_sum = 0;
+    int n_on = 0;
+    size_t i_check = 0;
+    for (int t = 0; t < 960; t++) {
+        double hr = 6.0 + (t % 96) * 0.125;
+        double f = std::max(0.0, std::sin((hr - 6.0) / 12.0 * 3.14159265));
+        if (t % 7 == 3) f *= 0.3;
+        if (t % 11 == 5) f *= 0.6;
+        for (size_t i = 0; i < n_panels; i++) {
+            flux_map(0, i) = 1400.0 * f * (0.45 + 0.55 * std::sin(i / (double)(n_panels - 1) * 3.14159265));   //[kW/m2]
+        }
+
+        rec.call(450.0 /*s*/, 101325.0 /*Pa*/, 293.15 /*K*/, 283.15 /*K*/, 1.0, 5.0 /*m/s*/, 1.0, &flux_map, mode, 290.0 + 273.15 /*K*/);
+        if (rec.get_operating_state() == C_csp_collector_receiver::ON) {
+            mode = C_csp_collector_receiver::ON;
+            n_on++;
+        }
+        else if (rec.get_operating_state() == C_csp_collector_receiver::OFF) {
+            mode = C_csp_collector_receiver::STARTUP;
+        }
+        rec.converged();
+
+        const C_pt_receiver::S_outputs& out = rec.ms_outputs;
+        Q_sum += out.m_Q_thermal;
+        T_sum += out.m_T_salt_hot;
+        m_dot_sum += out.m_m_dot_salt_tot;
+        T_max_sum += out.m_max_T_salt_hot;
+        T_rec_max_sum += out.m_max_rec_tout;
+        T_wall_sum += out.m_Twall_inlet;
+
+        if (i_check < check_steps.size() && t == check_steps[i_check]) {
+            EXPECT_NEAR(out.m_Q_thermal, Q_exp[i_check], 1.e-6) << "step " << t;
+            EXPECT_NEAR_FRAC(out.m_T_salt_hot, T_exp[i_check], tol) << "step " << t;
+            EXPECT_NEAR_FRAC(out.m_max_T_salt_hot, T_max_exp[i_check], tol) << "step " << t;
+            EXPECT_NEAR(out.m_Twall_inlet, T_wall_exp[i_check], 1.e-6) << "step " << t;
+            i_check++;
+        }
+    }
+
+    EXPECT_EQ(n_on, 792);
+    EXPECT_NEAR_FRAC(Q_sum, 492649.4591593, tol);
+    EXPECT_NEAR_FRAC(T_sum, 489959.8462941, tol);
+    EXPECT_NEAR_FRAC(m_dot_sum, 4148447376.665, tol);
+    EXPECT_NEAR_FRAC(T_max_sum, 490787.7364588, tol);
+    EXPECT_NEAR_FRAC(T_rec_max_sum, 491681.3641551, tol);
+    EXPECT_NEAR_FRAC(T_wall_sum, 277561.2969760, tol);
+}
@@ -133,6 +133,46 @@ NAMESPACE_TEST(csp_trough, TroughLoop, SteadyStateTest)
     EXPECT_NEAR(trough->m_T_sys_h_t_end, 659.4, 659.4 * kErrorToleranceLo);     // final loop outlet temperature
     EXPECT_NEAR(minutes2SS, 40., 40. * kErrorToleranceLo);                      // time to steady-state
 }
+
+// Test the receiver heat loss tables against the detailed receiver model, inside and outside the tables
+NAMESPACE_TEST(csp_trough, TroughLoop, HeatLossSurrogateFallback)
+{
+    DefaultTroughFactory default_trough_factory = DefaultTroughFactory();
+    Location location = default_trough_factory.MakeLocation();
+    std::unique_ptr<Trough> trough_detailed = default_trough_factory.MakeTrough(location);
+    std::unique_ptr<Trough> trough_surrogate = default_trough_factory.MakeTrough(location);
+    trough_surrogate->m_use_hl_surrogate = true;
+    trough_surrogate->build_hl_surrogates(location.m_elev);
+    ASSERT_TRUE(trough_surrogate->mv_hl_surrogate[0].is_built());
+
+    double m_dot = trough_detailed->m_m_dot_loop_des;                                   //[kg/s]
+    double q_i = trough_detailed->m_I_bn_des * trough_detailed->m_W_aperture[0];       //[W/m]
+    double T_amb = 298.15, T_sky = T_amb - 20., P_amb = 101325.;                        //[K], [K], [Pa]
+
+    // Conditions inside the tables: heat loss within 1% of the detailed model
+    double q_hl_detailed, q_hl_surrogate, q_12conv, q_34tot, c_1ave, rho_1ave, q_3reflect;
+    double T_htf = 0.5 * (trough_detailed->m_T_loop_in_des + trough_detailed->m_T_loop_out_des);
+    trough_detailed->EvacReceiver(T_htf, m_dot, T_amb, T_sky, 3., P_amb, q_i, 0, 0, 0, 0, false, 10, 0.,
+        q_hl_detailed, q_12conv, q_34tot, c_1ave, rho_1ave, q_3reflect);
+    trough_surrogate->EvacReceiver(T_htf, m_dot, T_amb, T_sky, 3., P_amb, q_i, 0, 0, 0, 0, false, 10, 0.,
+        q_hl_surrogate, q_12conv, q_34tot, c_1ave, rho_1ave, q_3reflect);
+    EXPECT_NEAR(q_hl_surrogate, q_hl_detailed, std::abs(q_hl_detailed) * kErrorToleranceHi);
+
+    // Wind speed and HTF temperature beyond the tables fall back to the detailed model
+    double v_wind_out = 25.;                                                            //[m/s] tables end at 20 m/s
+    double T_htf_out = trough_detailed->m_T_loop_out_des + 150.;                        //[K] tables end 75 K above design outlet
+    trough_detailed->EvacReceiver(T_htf, m_dot, T_amb, T_sky, v_wind_out, P_amb, q_i, 0, 0, 0, 0, false, 10, 0.,
+        q_hl_detailed, q_12conv, q_34tot, c_1ave, rho_1ave, q_3reflect);
+    trough_surrogate->EvacReceiver(T_htf, m_dot, T_amb, T_sky, v_wind_out, P_amb, q_i, 0, 0, 0, 0, false, 10, 0.,
+        q_hl_surrogate, q_12conv, q_34tot, c_1ave, rho_1ave, q_3reflect);
+    EXPECT_DOUBLE_EQ(q_hl_surrogate, q_hl_detailed);
+
+    trough_detailed->EvacReceiver(T_htf_out, m_dot, T_amb, T_sky, 3., P_amb, q_i, 0, 0, 0, 0, false, 10, 0.,
+        q_hl_detailed, q_12conv, q_34tot, c_1ave, rho_1ave, q_3reflect);
+    trough_surrogate->EvacReceiver(T_htf_out, m_dot, T_amb, T_sky, 3., P_amb, q_i, 0, 0, 0, 0, false, 10, 0.,
+        q_hl_surrogate, q_12conv, q_34tot, c_1ave, rho_1ave, q_3reflect);
+    EXPECT_DOUBLE_EQ(q_hl_surrogate, q_hl_detailed);
+}
 //========/Tests==================================================================================
 
 //========Factories:==============================================================================
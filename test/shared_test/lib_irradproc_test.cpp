@@ -201,6 +201,50 @@ TEST_F(IrradTest, ineichenTest) {
     EXPECT_NEAR(clearskyIrradiance[2], 27.505294, e) << "clearsky GHI";
 }
 
+TEST(SkyModelPOATest, matchesScalarModels_lib_irradproc) {
+    // covers sun below 87.5 and 90 deg, negative beam, zero and negative diffuse and incidence beyond 90 deg
+    std::vector<double> zen = { 0.2, 0.7, 1.2, 1.4, 1.53, 1.6, -0.1, 0.9, 1.1, 0.5 };
+    std::vector<double> inc = { 0.3, 1.0, 1.7, 0.4, 1.2, 2.0, 0.1, 1.55, 0.8, 0.0 };
+    std::vector<double> tilt = { 0.0, 0.35, 0.52, 1.57, 0.2, 0.6, 0.4, 1.0, 0.3, 0.45 };
+    std::vector<double> dn = { 900, 600, 300, 50, 20, 0, 800, -5, 450, 1000 };
+    std::vector<double> df = { 80, 150, 200, 60, 30, 10, 100, 0, -2, 50 };
+    std::vector<double> alb = { 0.2, 0.2, 0.3, 0.6, 0.2, 0.2, 0.2, 0.25, 0.2, 0.8 };
+    std::vector<double> hextra = { 1300, 1000, 500, 200, 50, 0, 1300, 800, 600, 1200 };
+    size_t n = zen.size();
+
+    // hdkr gives NaN for negative beam, which should be reproduced as well
+    auto expect_same = [](double v, double expected) {
+        if (std::isnan(expected)) EXPECT_TRUE(std::isnan(v));
+        else EXPECT_NEAR(v, expected, 1e-9);
+    };
+
+    std::vector<double> beam(n), sky(n), gnd(n), iso(n), cir(n), hor(n);
+    for (int model = 0; model < 3; model++) {
+        sky_model_poa(model, n, hextra.data(), dn.data(), df.data(), alb.data(), inc.data(), tilt.data(), zen.data(),
+                      beam.data(), sky.data(), gnd.data(), iso.data(), cir.data(), hor.data());
+        for (size_t i = 0; i < n; i++) {
+            double poa[3], diffc[3];
+            if (model == 0) isotropic(hextra[i], dn[i], df[i], alb[i], inc[i], tilt[i], zen[i], poa, diffc);
+            else if (model == 1) hdkr(hextra[i], dn[i], df[i], alb[i], inc[i], tilt[i], zen[i], poa, diffc);
+            else perez(hextra[i], dn[i], df[i], alb[i], inc[i], tilt[i], zen[i], poa, diffc);
+            SCOPED_TRACE(testing::Message() << "model " << model << " step " << i);
+            expect_same(beam[i], poa[0]);
+            expect_same(sky[i], poa[1]);
+            expect_same(gnd[i], poa[2]);
+            expect_same(iso[i], diffc[0]);
+            expect_same(cir[i], diffc[1]);
+            expect_same(hor[i], diffc[2]);
+        }
+    }
+
+    // diffuse components are optional
+    sky_model_poa(irrad::PEREZ, n, hextra.data(), dn.data(), df.data(), alb.data(), inc.data(), tilt.data(), zen.data(),
+                  beam.data(), sky.data(), gnd.data(), nullptr, nullptr, nullptr);
+    double poa[3];
+    perez(hextra[1], dn[1], df[1], alb[1], inc[1], tilt[1], zen[1], poa, nullptr);
+    EXPECT_NEAR(sky[1], poa[1], 1e-9);
+}
+
 
 TEST_F(DayCaseIrradProc, solarposTest_lib_irradproc) {
     double sun[9];
@@ -0,0 +1,109 @@
+/*
+BSD 3-Clause License
+
+Copyright (c) Alliance for Sustainable Energy, LLC. See also https://github.com/NREL/ssc/blob/develop/LICENSE
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+   contributors may be used to endorse or promote products derived from
+   this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <gtest/gtest.h>
+
+#include "lib_pvshade.h"
+
+TEST(lib_pvshade, skyDiffuseTableShared) {
+    sssky_diffuse_table::clear_shared();
+
+    sssky_diffuse_table first;
+    first.init(30., 0.4);
+    EXPECT_EQ(sssky_diffuse_table::shared_size(), 1);
+    double derate = first.lookup(30.);
+    EXPECT_NEAR(derate, 0.95987, 1e-5);
+    EXPECT_EQ(first.lookup(30.0002), derate);
+    EXPECT_EQ(sssky_diffuse_table::shared_size(), 1);
+
+    // a second table for the same gcr reuses the derates, a different gcr gets its own
+    sssky_diffuse_table second;
+    second.init(30., 0.4);
+    EXPECT_EQ(second.lookup(30.), derate);
+    EXPECT_EQ(sssky_diffuse_table::shared_size(), 1);
+    sssky_diffuse_table other;
+    other.init(30., 0.7);
+    EXPECT_LT(other.lookup(30.), derate);
+    EXPECT_EQ(sssky_diffuse_table::shared_size(), 2);
+
+    // tracker rotations compute each 0.001 degree step once
+    for (int i = 0; i < 100; i++)
+        first.lookup(i * 0.5);
+    size_t n = sssky_diffuse_table::shared_size();
+    for (int i = 0; i < 100; i++)
+        EXPECT_EQ(second.lookup(i * 0.5), first.lookup(i * 0.5));
+    EXPECT_EQ(sssky_diffuse_table::shared_size(), n);
+    EXPECT_NEAR(first.lookup(0.), 1., 1e-9);
+
+    sssky_diffuse_table::clear_shared();
+    EXPECT_EQ(sssky_diffuse_table::shared_size(), 0);
+
+    // tables initialized before the clear stop sharing, so only tables initialized after it are counted
+    EXPECT_EQ(first.lookup(45.), second.lookup(45.));
+    EXPECT_EQ(first.lookup(30.), derate);
+    EXPECT_EQ(sssky_diffuse_table::shared_size(), 0);
+    sssky_diffuse_table third;
+    third.init(45., 0.4);
+    EXPECT_EQ(third.lookup(45.), first.lookup(45.));
+    EXPECT_EQ(sssky_diffuse_table::shared_size(), 1);
+
+    sssky_diffuse_table::clear_shared();
+}
+
+TEST(lib_pvshade, skyDiffuseTableUnshared) {
+    sssky_diffuse_table::clear_shared();
+    size_t limit = sssky_diffuse_table::shared_limit();
+
+    // a table initialized without sharing keeps its derates to itself
+    sssky_diffuse_table own;
+    own.init(30., 0.4, false);
+    EXPECT_NEAR(own.lookup(30.), 0.95987, 1e-5);
+    EXPECT_EQ(sssky_diffuse_table::shared_size(), 0);
+
+    // the shared derates stop growing at the limit and the rest stay in each table
+    sssky_diffuse_table::set_shared_limit(10);
+    sssky_diffuse_table first, second;
+    first.init(0., 0.4);
+    second.init(0., 0.4);
+    for (int i = 0; i < 20; i++)
+        EXPECT_EQ(first.lookup(i * 0.5), second.lookup(i * 0.5));
+    EXPECT_EQ(sssky_diffuse_table::shared_size(), 10);
+    EXPECT_EQ(first.lookup(30.), own.lookup(30.));
+
+    sssky_diffuse_table::set_shared_limit(0);
+    sssky_diffuse_table off;
+    off.init(30., 0.7);
+    EXPECT_EQ(sssky_diffuse_table::shared_size(), 10);
+
+    sssky_diffuse_table::set_shared_limit(limit);
+    sssky_diffuse_table::clear_shared();
+}
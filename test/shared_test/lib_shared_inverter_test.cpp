@@ -261,3 +261,22 @@ TEST_F(sharedInverterTest_lib_shared_inverter, calculateEffForACPower) {
         EXPECT_NEAR(inv->powerAC_kW, -sandia.Paco / 1000., 1e-3) << "inverter cannot produce more than max (negative) Paco";
     }
 }
+
+TEST_F(sharedInverterTest_lib_shared_inverter, tempDerateRepeatedCalls) {
+    std::vector<double> c1 = { 200., 20., -0.2, 40., -0.4 };
+    std::vector<double> c2 = { 300., 30., -0.3, 60., -0.6 };
+    EXPECT_FALSE(inv->setTempDerateCurves({ c1, c2 }));
+
+    // same V and T give the same derate each call
+    for (size_t i = 0; i < 2; i++) {
+        reset();
+        inv->calculateTempDerate(250., 26., pDC, ratio, loss);
+        EXPECT_NEAR(pDC, 45848.1, e);
+    }
+
+    // replacing the curves replaces the derate at that V and T
+    EXPECT_FALSE(inv->setTempDerateCurves({ { 250., 50., -0.1 } }));
+    reset();
+    inv->calculateTempDerate(250., 26., pDC, ratio, loss);
+    EXPECT_NEAR(pDC, 61130.8, e);
+}
@@ -106,6 +106,44 @@ TEST_F(libTimeTest_lib_time, single_year_to_lifetime_with_escalation)
     }
 }
 
+// Lifetime series view gives the same values as the materialized lifetime vector
+TEST_F(libTimeTest_lib_time, single_year_to_lifetime_series_MatchesInterpolated)
+{
+    is_lifetime = true;
+    size_t n_rec_lifetime = lifetime30min.size();
+    std::vector<float> load_scale(n_years);
+    for (size_t i = 0; i < n_years; i++)
+        load_scale[i] = pow((double)(1 + 2.5 * 0.01), (double)i);
+
+    std::vector<float> lifetime_from_single;
+    size_t n_rec_singleyear;
+    double dt_hour;
+    single_year_to_lifetime_interpolated<float>(is_lifetime, n_years, n_rec_lifetime,
+        singleyear60min, load_scale, interpolation_factor, lifetime_from_single, n_rec_singleyear, dt_hour);
+
+    lifetime_series<float> series;
+    size_t n_rec_singleyear_series;
+    double dt_hour_series;
+    single_year_to_lifetime_series<float>(is_lifetime, n_years, n_rec_lifetime,
+        singleyear60min, load_scale, interpolation_factor, series, n_rec_singleyear_series, dt_hour_series);
+
+    EXPECT_EQ(series.size(), lifetime_from_single.size());
+    EXPECT_EQ(series.n_rec_single_year(), n_rec_singleyear);
+    EXPECT_EQ(n_rec_singleyear_series, n_rec_singleyear);
+    EXPECT_EQ(dt_hour_series, dt_hour);
+    for (size_t i = 0; i < n_rec_lifetime; i += increment) {
+        EXPECT_EQ(series[i], lifetime_from_single[i]);
+    }
+    EXPECT_EQ(series.at(n_years - 1, 10), lifetime_from_single[(n_years - 1) * n_rec_singleyear + 10]);
+    EXPECT_EQ(series.to_vector(), lifetime_from_single);
+
+    // empty single year input is all zeros
+    single_year_to_lifetime_series<float>(is_lifetime, n_years, n_rec_lifetime,
+        std::vector<float>(), load_scale, interpolation_factor, series, n_rec_singleyear_series, dt_hour_series);
+    EXPECT_EQ(series.size(), n_rec_lifetime);
+    EXPECT_EQ(series[n_rec_lifetime - 1], 0);
+}
+
 TEST_F(libTimeTest_lib_time, single_year_to_lifetime_interpolated_SingleValue)
 {
     is_lifetime = false;
@@ -31,6 +31,8 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 */
 
 
+#include <algorithm>
+#include <numeric>
 #include <string>
 #include <gtest/gtest.h>
 #include <lib_util.h>
@@ -63,6 +65,41 @@ TEST(libUtilTests, testNearestColValue) {
     ASSERT_EQ(8, util::nearest_col_index(cycles_vs_DOD, 0, 100));
 }
 
+TEST(libUtilTests, testSlidingWindow) {
+    // repeated values and a clamped tail exercise every incremental path
+    std::vector<double> series;
+    for (size_t i = 0; i < 200; i++)
+        series.push_back((double)((i * 37) % 23) * 0.25 - 1.0);
+
+    size_t width = 24;
+    util::sliding_window window(width);
+    auto check = [&](size_t start) {
+        window.update(series, start);
+        size_t end = std::min(start + width, series.size());
+        std::vector<double> sorted(series.begin() + start, series.begin() + end);
+        std::sort(sorted.begin(), sorted.end());
+        ASSERT_EQ(window.size(), sorted.size()) << "start " << start;
+        for (size_t n = 0; n < sorted.size(); n++) {
+            EXPECT_EQ(window.nth_smallest(n), sorted[n]) << "start " << start;
+            EXPECT_EQ(window.nth_largest(n), sorted[sorted.size() - n - 1]) << "start " << start;
+        }
+        EXPECT_EQ(window.min(), sorted.front());
+        EXPECT_EQ(window.max(), sorted.back());
+        EXPECT_NEAR(window.sum(), std::accumulate(sorted.begin(), sorted.end(), 0.0), 1e-9) << "start " << start;
+    };
+
+    for (size_t start = 0; start < series.size(); start++) {
+        check(start);
+        check(start); // repeated update at the same index
+    }
+    check(10); // jump backwards rebuilds
+    check(11);
+
+    series[12] = 100.;
+    window.reset();
+    check(11);
+}
+
 TEST(sscapiTest, SSC_DATARR_test)
 {
     // create data entries
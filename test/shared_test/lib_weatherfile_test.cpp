@@ -305,6 +305,34 @@ TEST_F(Data8760CaseWeatherData, readTest_lib_weatherfile){
 	// are not assigned but are NULL
 }
 
+TEST_F(Data8760CaseWeatherData, readBlockTest_lib_weatherfile){
+	weatherdata wd(input);
+	weatherdata ref(input);
+	weather_record block[24], r;
+	wd.set_counter_to(2000);
+	ref.set_counter_to(2000);
+	EXPECT_EQ(wd.read_block(block, 24), 24);
+	EXPECT_EQ(wd.get_counter_value(), 2024);
+	for (size_t i = 0; i < 24; i++){
+		EXPECT_TRUE(ref.read(&r));
+		EXPECT_EQ(block[i].month, r.month) << "Data8760 Case: block row " << i << "\n";
+		EXPECT_EQ(block[i].day, r.day) << "Data8760 Case: block row " << i << "\n";
+		EXPECT_EQ(block[i].hour, r.hour) << "Data8760 Case: block row " << i << "\n";
+		EXPECT_NEAR(block[i].dn, r.dn, e) << "Data8760 Case: block row " << i << "\n";
+		EXPECT_TRUE(std::isnan(block[i].gh)) << "Data8760 Case: block row " << i << "\n";
+	}
+
+	wd.set_counter_to(8750);
+	EXPECT_EQ(wd.read_block(block, 24), 10) << "Block read stops at the last record";
+	EXPECT_FALSE(wd.read(&r));
+
+	weatherdata::span s = wd.column_span(weather_data_provider::MONTH, 2000, 24);
+	EXPECT_EQ(s.len, 24);
+	EXPECT_EQ(s.p[0], 3) << "Data8760 Case: month span\n";
+	EXPECT_EQ(wd.column_span(weather_data_provider::DNI, 8750, 24).len, 10);
+	EXPECT_EQ(wd.column_span(weather_data_provider::GHI, 0, 24).len, 0) << "GHI was not provided";
+}
+
 /// Error Case
 class Data9999CaseWeatherData : public weatherdataTest{
 protected:
@@ -77,6 +77,31 @@ TEST_F(CMBattery_cmod_battery, CommercialLifetimePeakShaving) {
 	}
 }
 
+/// Reported-only battery time series are not allocated when the output selection drops them
+TEST_F(CMBattery_cmod_battery, OutputTierSkipsReportedSeries) {
+	int errors = run_module(data, "battery");
+	EXPECT_FALSE(errors);
+	ssc_number_t roundtrip_full;
+	ssc_data_get_number(data, "average_battery_roundtrip_efficiency", &roundtrip_full);
+	int n;
+	calculated_array = ssc_data_get_array(data, "batt_annual_discharge_energy", &n);
+	std::vector<ssc_number_t> discharge_full(calculated_array, calculated_array + n);
+
+	ssc_data_clear(data);
+	battery_commercial_peak_shaving_lifetime(data);
+	ssc_data_set_number(data, "output_tier", 1); // aggregate: keep annual arrays
+	errors = run_module(data, "battery");
+	EXPECT_FALSE(errors);
+
+	ssc_data_get_number(data, "average_battery_roundtrip_efficiency", &calculated_value);
+	EXPECT_EQ(calculated_value, roundtrip_full);
+	calculated_array = ssc_data_get_array(data, "batt_annual_discharge_energy", &n);
+	ASSERT_NE(calculated_array, nullptr);
+	EXPECT_EQ(std::vector<ssc_number_t>(calculated_array, calculated_array + n), discharge_full);
+	EXPECT_EQ(ssc_data_get_array(data, "batt_voltage", &n), nullptr);
+	EXPECT_EQ(ssc_data_get_array(data, "batt_SOC", &n), nullptr);
+}
+
 TEST_F(CMBattery_cmod_battery, ResilienceMetricsFullLoad){
     auto data_vtab = static_cast<var_table*>(data);
     data_vtab->assign("crit_load", data_vtab->as_vector_ssc_number_t("load"));
@@ -126,3 +126,52 @@ TEST_F(CMGrid_cmod_grid, SingleYearNoFinancial_cmod_grid) {
 		EXPECT_NEAR(annual_energy_pre_interconnect, 460351000, 10);
 	}
 }
+
+namespace {
+    struct grid_stream_chunks {
+        ssc_data_t data;
+        std::vector<size_t> chunks;
+        std::vector<double> gen_kWh;
+    };
+
+    ssc_bool_t grid_stream_handler(ssc_module_t, ssc_handler_t, int action, float f0, float f1, const char *s0, const char *, void *user) {
+        if (action != SSC_STREAM)
+            return 1;
+        grid_stream_chunks *c = static_cast<grid_stream_chunks *>(user);
+        EXPECT_EQ(std::string(s0), "gen,system_pre_curtailment_kwac,system_pre_interconnect_kwac");
+        int n = 0;
+        ssc_number_t *gen = ssc_data_get_array(c->data, "gen", &n);
+        EXPECT_EQ(n, (int)f1);
+        double sum = 0;
+        for (int i = 0; i < n; i++)
+            sum += gen[i];
+        c->chunks.push_back((size_t)f0);
+        c->gen_kWh.push_back(sum * 0.5);
+        return 1;
+    }
+}
+
+TEST_F(CMGrid_cmod_grid, StreamedLifetime_cmod_grid) {
+
+	grid_default_30_min_lifetime(data);
+	ssc_data_set_number(data, "output_stream", 1);
+
+	grid_stream_chunks streamed;
+	streamed.data = data;
+	ssc_module_t module = ssc_module_create("grid");
+	EXPECT_TRUE(ssc_module_exec_with_handler(module, data, grid_stream_handler, &streamed));
+	ssc_module_free(module);
+
+	ASSERT_EQ(streamed.chunks.size(), 2);
+	EXPECT_EQ(streamed.chunks[0], 0);
+	EXPECT_EQ(streamed.chunks[1], 1);
+
+	// outputs keep year one, matching the non-streamed lifetime run
+	ssc_number_t annual_energy;
+	int gen_size;
+	ssc_data_get_number(data, "annual_energy", &annual_energy);
+	GetArray("gen", gen_size);
+	EXPECT_EQ(gen_size, 8760 * 2);
+	EXPECT_NEAR(annual_energy, 485461500, 10);
+	EXPECT_NEAR(streamed.gen_kWh[0], annual_energy, 10);
+}
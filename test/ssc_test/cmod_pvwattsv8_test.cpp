@@ -46,6 +46,121 @@ TEST_F(CMPvwattsv8Integration_cmod_pvwattsv8, DefaultSetup) {
     ssc_data_set_number(data, "analysis_period", 25);
 }
 
+/// Unrequested array outputs are dropped without changing results
+TEST_F(CMPvwattsv8Integration_cmod_pvwattsv8, OutputSelection_cmod_pvwattsv8) {
+    compute();
+    ssc_number_t annual_energy_full, annual_energy;
+    ssc_data_get_number(data, "annual_energy", &annual_energy_full);
+
+    int count;
+    ssc_data_set_string(data, "output_filter", "monthly_energy");
+    compute();
+    ssc_data_get_number(data, "annual_energy", &annual_energy);
+    EXPECT_EQ(annual_energy, annual_energy_full);
+    EXPECT_NE(ssc_data_get_array(data, "monthly_energy", &count), nullptr);
+    EXPECT_EQ(ssc_data_get_array(data, "ac", &count), nullptr) << "Time series not in output_filter";
+    EXPECT_EQ(ssc_data_get_array(data, "dc_monthly", &count), nullptr) << "Monthly array not in output_filter";
+
+    ssc_data_set_number(data, "output_tier", 1); // aggregate: keep monthly and annual arrays
+    compute();
+    ssc_data_get_number(data, "annual_energy", &annual_energy);
+    EXPECT_EQ(annual_energy, annual_energy_full);
+    EXPECT_NE(ssc_data_get_array(data, "dc_monthly", &count), nullptr);
+    EXPECT_EQ(ssc_data_get_array(data, "gen", &count), nullptr);
+}
+
+/// A selection applies to one module run, so a module run next on the same data keeps its outputs
+TEST_F(CMPvwattsv8Integration_cmod_pvwattsv8, OutputSelectionChained_cmod_pvwattsv8) {
+    int count;
+    ssc_data_set_string(data, "output_filter", "gen"); // keep what grid reads
+    compute();
+    ssc_number_t annual_energy_pv;
+    ssc_data_get_number(data, "annual_energy", &annual_energy_pv);
+    EXPECT_EQ(ssc_data_get_array(data, "ac", &count), nullptr);
+    ASSERT_NE(ssc_data_get_array(data, "gen", &count), nullptr);
+    EXPECT_EQ(ssc_data_query(data, "output_filter"), SSC_INVALID);
+
+    std::vector<ssc_number_t> no_curtailment(8760, 1.e6);
+    ssc_data_set_array(data, "grid_curtailment", &no_curtailment[0], 8760);
+    ssc_data_set_number(data, "enable_interconnection_limit", 0);
+    ssc_data_set_number(data, "grid_interconnection_limit_kwac", 1.e6);
+    EXPECT_FALSE(run_module(data, "grid"));
+
+    ssc_number_t annual_energy;
+    ssc_data_get_number(data, "annual_energy", &annual_energy);
+    EXPECT_NEAR(annual_energy, annual_energy_pv, 1.);
+    ASSERT_NE(ssc_data_get_array(data, "gen", &count), nullptr);
+    EXPECT_EQ(count, 8760);
+    EXPECT_NE(ssc_data_get_array(data, "system_pre_curtailment_kwac", &count), nullptr) << "Selection set for pvwattsv8 applied to grid";
+}
+
+TEST_F(CMPvwattsv8Integration_cmod_pvwattsv8, BatchSites_cmod_pvwattsv8) {
+    // two sites sharing the time stamps, the second with less beam and a different location
+    size_t nrec = 8760, n_sites = 2;
+    var_table* weather = create_weatherdata_array(nrec);
+    for (const char* unused : { "tdew", "rhum", "pres", "wdir", "aod", "pwp" })
+        weather->unassign(unused);
+    ssc_number_t lat[2] = { weather->as_number("lat"), 33.45 };
+    ssc_number_t lon[2] = { weather->as_number("lon"), -111.98 };
+    ssc_number_t tz[2] = { weather->as_number("tz"), -7 };
+    ssc_number_t elev[2] = { weather->as_number("elev"), 358 };
+
+    ssc_data_t batch = ssc_data_create();
+    ssc_data_unassign(data, "solar_resource_file");
+    ssc_data_set_table(batch, "system_inputs", data);
+    ssc_data_set_number(batch, "n_threads", 2);
+    ssc_data_set_array(batch, "site_lat", lat, 2);
+    ssc_data_set_array(batch, "site_lon", lon, 2);
+    ssc_data_set_array(batch, "site_tz", tz, 2);
+    ssc_data_set_array(batch, "site_elev", elev, 2);
+    for (const char* f : { "year", "month", "day", "hour", "minute" })
+        ssc_data_set_array(batch, f, weather->as_array(f, nullptr), (int)nrec);
+    for (const char* f : { "dn", "df", "tdry", "wspd", "alb" }) {
+        std::vector<ssc_number_t> stacked(n_sites * nrec);
+        ssc_number_t* p = weather->as_array(f, nullptr);
+        for (size_t i = 0; i < nrec; i++) {
+            stacked[i] = p[i];
+            stacked[nrec + i] = std::string(f) == "dn" ? 0.8 * p[i] : p[i];
+        }
+        ssc_data_set_matrix(batch, (std::string("site_") + f).c_str(), &stacked[0], (int)n_sites, (int)nrec);
+    }
+    EXPECT_FALSE(run_module(batch, "pvwattsv8_batch"));
+
+    int count, nrows, ncols;
+    ssc_number_t* status = ssc_data_get_array(batch, "site_status", &count);
+    ssc_number_t* annual = ssc_data_get_array(batch, "annual_energy", &count);
+    ssc_number_t* monthly = ssc_data_get_matrix(batch, "monthly_energy", &nrows, &ncols);
+    ASSERT_EQ(count, 2);
+    ASSERT_EQ(nrows, 2);
+    ASSERT_EQ(ncols, 12);
+
+    // each site matches a stand-alone run on its own weather table
+    for (size_t s = 0; s < n_sites; s++) {
+        weather->assign("lat", lat[s]);
+        weather->assign("lon", lon[s]);
+        weather->assign("tz", tz[s]);
+        weather->assign("elev", elev[s]);
+        if (s == 1) {
+            ssc_number_t* dn = weather->as_array("dn", nullptr);
+            for (size_t i = 0; i < nrec; i++)
+                dn[i] = 0.8 * dn[i];
+        }
+        ssc_data_set_table(data, "solar_resource_data", weather);
+        EXPECT_FALSE(run_module(data, "pvwattsv8"));
+
+        ssc_number_t annual_energy;
+        ssc_data_get_number(data, "annual_energy", &annual_energy);
+        ssc_number_t* monthly_energy = ssc_data_get_array(data, "monthly_energy", &count);
+        EXPECT_EQ(status[s], 1);
+        EXPECT_EQ(annual[s], annual_energy) << "Site " << s;
+        for (size_t m = 0; m < 12; m++)
+            EXPECT_EQ(monthly[s * 12 + m], monthly_energy[m]) << "Site " << s << " month " << m;
+    }
+
+    ssc_data_free(batch);
+    free_weatherdata_array(weather);
+}
+
 ///Default PVWattsv8, but with TMY2 instead of TMY3
 TEST_F(CMPvwattsv8Integration_cmod_pvwattsv8, DefaultNoFinancialModel_cmod_pvwattsv8) {
     compute();
@@ -38,76 +38,92 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 //#include "../input_cases/code_generator_utilities.h"
 
-namespace sco2_tests {}
+namespace sco2_tests {
+    // recompression cycle with air cooler, 50 MWe design
+    ssc_data_t sco2_design_test_data()
+    {
+        ssc_data_t data = ssc_data_create();
+        ssc_data_set_number(data, "t_amb_des", 26);
+        ssc_data_set_number(data, "dt_mc_approach", 6);
+        ssc_data_set_number(data, "t_htf_hot_des", 720);
+
+        ssc_data_set_number(data, "n_nodes_air_cooler_pass", 10);
+        ssc_data_set_number(data, "htf", 6);
+        ssc_data_set_number(data, "design_method", 3);
+        ssc_data_set_number(data, "fan_power_frac", 0.02);
+        ssc_data_set_number(data, "deltap_counterhx_frac", -1);
+        ssc_data_set_number(data, "w_dot_net_des", 50);
+        ssc_data_set_number(data, "ltr_ua_des_in", -1);
+        ssc_data_set_number(data, "dt_phx_hot_approach", 20);
+        ssc_data_set_number(data, "site_elevation", 588);
+        ssc_data_set_number(data, "ua_recup_tot_des", -1);
+        ssc_data_set_number(data, "eta_thermal_des", -1);
+        ssc_data_set_number(data, "rel_tol", 3);
+        ssc_data_set_number(data, "ltr_design_code", 2);
+        ssc_data_set_number(data, "is_gen_od_polynomials", 0);
+        ssc_data_set_number(data, "ltr_min_dt_des_in", 10);
+        ssc_data_set_number(data, "lt_recup_eff_max", 1);
+        ssc_data_set_number(data, "ltr_eff_des_in", -1);
+        ssc_data_set_number(data, "p_high_limit", 25);
+        ssc_data_set_number(data, "eta_isen_mc", 0.84999999999999998);
+        ssc_data_set_number(data, "ltr_lp_deltap_des_in", 0.031099999999999999);
+        ssc_data_set_number(data, "ltr_hp_deltap_des_in", 0.0055999999999999999);
+        ssc_data_set_number(data, "htr_design_code", 2);
+        ssc_data_set_number(data, "htr_ua_des_in", -1);
+        ssc_data_set_number(data, "od_rel_tol", 3);
+        ssc_data_set_number(data, "htr_min_dt_des_in", 10);
+        ssc_data_set_number(data, "od_opt_objective", 0);
+        ssc_data_set_number(data, "ht_recup_eff_max", 1);
+        ssc_data_set_number(data, "htr_eff_des_in", -1);
+        ssc_data_set_number(data, "htr_lp_deltap_des_in", 0.031099999999999999);
+        ssc_data_set_number(data, "htr_hp_deltap_des_in", 0.0055999999999999999);
+
+        ssc_data_set_number(data, "cycle_config", 1);
+        ssc_data_set_number(data, "des_objective", 1);
+        ssc_data_set_number(data, "is_recomp_ok", 1);
+        ssc_data_set_number(data, "is_p_high_fixed", 1);
+        ssc_data_set_number(data, "is_pr_fixed", 0);
+        ssc_data_set_number(data, "od_t_t_in_mode", 0);
+        ssc_data_set_number(data, "is_ip_fixed", 0);
+        ssc_data_set_number(data, "min_phx_deltat", 1000);
+        ssc_data_set_number(data, "ltr_od_model", 1);
+        ssc_data_set_number(data, "deltap_cooler_frac", 0.0050000000000000001);
+        ssc_data_set_number(data, "eta_isen_rc", 0.84999999999999998);
+        ssc_data_set_number(data, "eta_isen_pc", 0.84999999999999998);
+        ssc_data_set_number(data, "eta_isen_t", 0.90000000000000002);
+        ssc_data_set_number(data, "phx_co2_deltap_des_in", 0.0055999999999999999);
+        ssc_data_set_number(data, "mc_comp_type", 1);
+        ssc_data_set_number(data, "dt_phx_cold_approach", 20);
+        ssc_data_set_number(data, "ltr_n_sub_hx", 10);
+        ssc_data_set_number(data, "htr_n_sub_hx", 10);
+        ssc_data_set_number(data, "htr_od_model", 1);
+        ssc_data_set_number(data, "phx_n_sub_hx", 10);
+        ssc_data_set_number(data, "phx_od_model", 1);
+        ssc_data_set_number(data, "is_design_air_cooler", 1);
+        ssc_data_set_number(data, "eta_air_cooler_fan", 0.5);
+
+        return data;
+    }
+
+    std::vector<ssc_number_t> get_matrix(ssc_data_t data, const char *name)
+    {
+        int nrows = 0, ncols = 0;
+        ssc_number_t *values = ssc_data_get_matrix(data, name, &nrows, &ncols);
+        if (!values)
+            return std::vector<ssc_number_t>();
+        return std::vector<ssc_number_t>(values, values + nrows * ncols);
+    }
+}
 using namespace sco2_tests;
 
 //========Tests===================================================================================
 NAMESPACE_TEST(sco2_tests, SCO2Cycle, Parametrics)
 {
     
-    ssc_data_t data = ssc_data_create();
-
-    ssc_data_set_number(data, "t_amb_des", 26);
-    ssc_data_set_number(data, "dt_mc_approach", 6);
-    ssc_data_set_number(data, "t_htf_hot_des", 720);
+    ssc_data_t data = sco2_design_test_data();
     ssc_number_t p_od_cases[12] = { 720, 1, 26, 1, 1, 1, 720, 1, 20, 1, 1, 1 };
-
-    ssc_data_set_number(data, "n_nodes_air_cooler_pass", 10);
-    ssc_data_set_number(data, "htf", 6);
-    ssc_data_set_number(data, "design_method", 3);
-    ssc_data_set_number(data, "fan_power_frac", 0.02);
-    ssc_data_set_number(data, "deltap_counterhx_frac", -1);
-    ssc_data_set_number(data, "w_dot_net_des", 50);
-    ssc_data_set_number(data, "ltr_ua_des_in", -1);
-    ssc_data_set_number(data, "dt_phx_hot_approach", 20);
-    ssc_data_set_number(data, "site_elevation", 588);
-    ssc_data_set_number(data, "ua_recup_tot_des", -1);
-    ssc_data_set_number(data, "eta_thermal_des", -1);
-    ssc_data_set_number(data, "rel_tol", 3);
-    ssc_data_set_number(data, "ltr_design_code", 2);
-    ssc_data_set_number(data, "is_gen_od_polynomials", 0);
-    ssc_data_set_number(data, "ltr_min_dt_des_in", 10);
-    ssc_data_set_number(data, "lt_recup_eff_max", 1);
-    ssc_data_set_number(data, "ltr_eff_des_in", -1);
-    ssc_data_set_number(data, "p_high_limit", 25);
-    ssc_data_set_number(data, "eta_isen_mc", 0.84999999999999998);
-    ssc_data_set_number(data, "ltr_lp_deltap_des_in", 0.031099999999999999);
-    ssc_data_set_number(data, "ltr_hp_deltap_des_in", 0.0055999999999999999);
-    ssc_data_set_number(data, "htr_design_code", 2);
-    ssc_data_set_number(data, "htr_ua_des_in", -1);
-    ssc_data_set_number(data, "od_rel_tol", 3);
-    ssc_data_set_number(data, "htr_min_dt_des_in", 10);
-    ssc_data_set_number(data, "od_opt_objective", 0);
-    ssc_data_set_number(data, "ht_recup_eff_max", 1);
-    ssc_data_set_number(data, "htr_eff_des_in", -1);
-    ssc_data_set_number(data, "htr_lp_deltap_des_in", 0.031099999999999999);
-    ssc_data_set_number(data, "htr_hp_deltap_des_in", 0.0055999999999999999);
-    
     ssc_data_set_matrix(data, "od_cases", p_od_cases, 2, 6);
-    ssc_data_set_number(data, "cycle_config", 1);
-    ssc_data_set_number(data, "des_objective", 1);
-    ssc_data_set_number(data, "is_recomp_ok", 1);
-    ssc_data_set_number(data, "is_p_high_fixed", 1);
-    ssc_data_set_number(data, "is_pr_fixed", 0);
-    ssc_data_set_number(data, "od_t_t_in_mode", 0);
-    ssc_data_set_number(data, "is_ip_fixed", 0);
-    ssc_data_set_number(data, "min_phx_deltat", 1000);
-    ssc_data_set_number(data, "ltr_od_model", 1);
-    ssc_data_set_number(data, "deltap_cooler_frac", 0.0050000000000000001);
-    ssc_data_set_number(data, "eta_isen_rc", 0.84999999999999998);
-    ssc_data_set_number(data, "eta_isen_pc", 0.84999999999999998);
-    ssc_data_set_number(data, "eta_isen_t", 0.90000000000000002);
-    ssc_data_set_number(data, "phx_co2_deltap_des_in", 0.0055999999999999999);
-    ssc_data_set_number(data, "mc_comp_type", 1);
-    ssc_data_set_number(data, "dt_phx_cold_approach", 20);
-    ssc_data_set_number(data, "ltr_n_sub_hx", 10);
-    ssc_data_set_number(data, "htr_n_sub_hx", 10);
-    ssc_data_set_number(data, "htr_od_model", 1);
-    ssc_data_set_number(data, "phx_n_sub_hx", 10);
-    ssc_data_set_number(data, "phx_od_model", 1);
-    ssc_data_set_number(data, "is_design_air_cooler", 1);
-    ssc_data_set_number(data, "eta_air_cooler_fan", 0.5);
-    
+
     CmodUnderTest sco2 = CmodUnderTest("sco2_csp_system", data);
     
     int errors = sco2.RunModule();
@@ -133,3 +149,70 @@ NAMESPACE_TEST(sco2_tests, SCO2Cycle, Parametrics)
     }
     
 }
+
+NAMESPACE_TEST(sco2_tests, SCO2Cycle, UDPCTablesParallelMatchSerial)
+{
+    // the smallest allowed table (3 points per variable, close to design) solved serially and on two threads
+    std::vector<std::string> tables = { "T_htf_ind", "T_amb_ind", "m_dot_htf_ND_ind" };
+    std::vector<std::vector<ssc_number_t>> results[2];
+    for (int n_threads = 1; n_threads <= 2; n_threads++) {
+        ssc_data_t data = sco2_design_test_data();
+        ssc_data_set_number(data, "T_htf_hot_low", 710);
+        ssc_data_set_number(data, "T_htf_hot_high", 725);
+        ssc_data_set_number(data, "T_amb_low", 24);
+        ssc_data_set_number(data, "T_amb_high", 30);
+        ssc_data_set_number(data, "m_dot_htf_ND_low", 0.95);
+        ssc_data_set_number(data, "m_dot_htf_ND_high", 1.05);
+        ssc_data_set_number(data, "n_T_htf_hot", 3);
+        ssc_data_set_number(data, "n_T_amb", 3);
+        ssc_data_set_number(data, "n_m_dot_htf_ND", 3);
+        ssc_data_set_number(data, "n_threads_udpc", n_threads);
+
+        int errors = run_module(data, "sco2_csp_ud_pc_tables");
+        EXPECT_FALSE(errors);
+        for (const std::string &name : tables)
+            results[n_threads - 1].push_back(get_matrix(data, name.c_str()));
+        ssc_data_free(data);
+    }
+
+    for (size_t i = 0; i < tables.size(); i++) {
+        EXPECT_FALSE(results[0][i].empty()) << tables[i];
+        EXPECT_EQ(results[0][i], results[1][i]) << tables[i];
+    }
+}
+
+NAMESPACE_TEST(sco2_tests, SCO2Cycle, MultiStartDesignDeterministic)
+{
+    // a single starting point gives the same design as before multi-start was added
+    CmodUnderTest serial = CmodUnderTest("sco2_csp_system", sco2_design_test_data());
+    serial.SetInput("n_multi_start_threads", 1);
+    int errors = serial.RunModule();
+    EXPECT_FALSE(errors);
+    if (!errors) {
+        EXPECT_NEAR_FRAC(serial.GetOutput("T_htf_cold_des"), 529.6897, kErrorToleranceLo);
+        EXPECT_NEAR_FRAC(serial.GetOutput("eta_thermal_calc"), 0.5071197, kErrorToleranceLo);
+        EXPECT_NEAR_FRAC(serial.GetOutput("m_dot_htf_des"), 513.344, kErrorToleranceLo);
+        EXPECT_NEAR_FRAC(serial.GetOutput("m_dot_co2_full"), 410.528, kErrorToleranceLo);
+        EXPECT_NEAR_FRAC(serial.GetOutput("P_comp_in"), 7.67490, kErrorToleranceLo);
+        EXPECT_NEAR_FRAC(serial.GetOutput("cycle_cost"), 53.2909, kErrorToleranceLo);
+    }
+
+    // parallel starts give the same design on every run, for the recompression and partial cooling cycles
+    std::vector<std::string> outputs = { "T_htf_cold_des", "eta_thermal_calc", "m_dot_htf_des", "m_dot_co2_full", "P_comp_in", "cycle_cost" };
+    for (int cycle_config = 1; cycle_config <= 2; cycle_config++) {
+        std::vector<ssc_number_t> results[2];
+        for (int run = 0; run < 2; run++) {
+            CmodUnderTest parallel = CmodUnderTest("sco2_csp_system", sco2_design_test_data());
+            parallel.SetInput("cycle_config", cycle_config);
+            parallel.SetInput("n_multi_start_threads", 4);
+            errors = parallel.RunModule();
+            EXPECT_FALSE(errors) << "cycle_config " << cycle_config;
+            for (const std::string &name : outputs)
+                results[run].push_back(parallel.GetOutput(name));
+        }
+        EXPECT_EQ(results[0], results[1]) << "cycle_config " << cycle_config;
+        // the extra starts include the single one, so the best design is at least as efficient
+        if (cycle_config == 1 && !errors)
+            EXPECT_GE(results[0][1], serial.GetOutput("eta_thermal_calc"));
+    }
+}
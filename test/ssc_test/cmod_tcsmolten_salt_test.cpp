@@ -71,6 +71,46 @@ NAMESPACE_TEST(csp_tower, PowerTowerCmod, Default_NoFinancial)
     //}
 }
 
+// Operating mode prediction ahead of the mode hierarchy
+NAMESPACE_TEST(csp_tower, PowerTowerCmod, OpModePrediction_NoFinancial)
+{
+    ssc_data_t defaults = tcsmolten_salt_defaults();
+    CmodUnderTest power_tower = CmodUnderTest("tcsmolten_salt", defaults);
+    power_tower.SetInput("is_op_mode_prediction", 1);
+    int errors = power_tower.RunModule();
+    EXPECT_FALSE(errors);
+    if (!errors) {
+        EXPECT_NEAR_FRAC(power_tower.GetOutput("annual_energy"), 602247767, kErrorToleranceHi);
+        EXPECT_NEAR_FRAC(power_tower.GetOutput("annual_W_cycle_gross"), 670611403, kErrorToleranceHi);
+        EXPECT_GT(power_tower.GetOutput("n_op_mode_predictions"), 0);
+        EXPECT_LE(power_tower.GetOutput("n_op_mode_predictions_converged"), power_tower.GetOutput("n_op_mode_predictions"));
+        EXPECT_GE(power_tower.GetOutput("n_op_mode_solves"), 8760);
+    }
+}
+
+// Cycle efficiency is reported from gross power and cycle thermal input, which are kept when only 'eta' is requested
+NAMESPACE_TEST(csp_tower, PowerTowerCmod, OutputFilterDependent_NoFinancial)
+{
+    ssc_data_t defaults = tcsmolten_salt_defaults();
+    CmodUnderTest power_tower = CmodUnderTest("tcsmolten_salt", defaults);
+    int errors = power_tower.RunModule();
+    EXPECT_FALSE(errors);
+    if (!errors) {
+        std::vector<ssc_number_t> eta_full = power_tower.GetOutputVector("eta");
+        ssc_number_t annual_energy_full = power_tower.GetOutput("annual_energy");
+
+        power_tower.SetInput("output_filter", "eta");
+        errors = power_tower.RunModule();
+        EXPECT_FALSE(errors);
+        if (!errors) {
+            std::vector<ssc_number_t> eta = power_tower.GetOutputVector("eta");
+            EXPECT_EQ(power_tower.GetOutput("annual_energy"), annual_energy_full);
+            EXPECT_EQ(std::count(eta.begin(), eta.end(), (ssc_number_t)(float)-999.9), 0);
+            EXPECT_FLOATS_NEARLY_EQ(eta_full, eta, 0.0);
+        }
+    }
+}
+
 NAMESPACE_TEST(csp_tower, PowerTowerCmod, SlidingPressure_NoFinancial)
 {
     ssc_data_t defaults = tcsmolten_salt_defaults();
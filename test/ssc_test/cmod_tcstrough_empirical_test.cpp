@@ -58,6 +58,30 @@ NAMESPACE_TEST(csp_trough, EmpiricalTroughCmod, Default_NoFinancial)
     }
 }
 
+// Dependency-ordered TCS kernel solve with accelerated cycles
+NAMESPACE_TEST(csp_trough, EmpiricalTroughCmod, OrderedSolve_NoFinancial)
+{
+    CmodUnderTest iterated_trough = CmodUnderTest("tcstrough_empirical", tcstrough_empirical_defaults());
+    int errors = iterated_trough.RunModule();
+    ASSERT_FALSE(errors);
+    double n_calls_iterated = iterated_trough.GetOutput("tcs_unit_invocations");
+
+    ssc_data_t defaults = tcstrough_empirical_defaults();
+    CmodUnderTest empirical_trough = CmodUnderTest("tcstrough_empirical", defaults);
+    empirical_trough.SetInput("tcs_solve_mode", 1);
+
+    errors = empirical_trough.RunModule();
+    EXPECT_FALSE(errors);
+    if (!errors) {
+        EXPECT_NEAR_FRAC(empirical_trough.GetOutput("annual_energy"), 344049128, kErrorToleranceHi);
+        EXPECT_NEAR_FRAC(empirical_trough.GetOutput("capacity_factor"), 39.31, kErrorToleranceHi);
+        EXPECT_NEAR_FRAC(empirical_trough.GetOutput("annual_W_cycle_gross"), 403814011, kErrorToleranceHi);
+        // The units form no cycles, so each of the 5 units is called once per hour
+        EXPECT_EQ(empirical_trough.GetOutput("tcs_unit_invocations"), 5 * 8760);
+        EXPECT_LE(empirical_trough.GetOutput("tcs_unit_invocations"), n_calls_iterated);
+    }
+}
+
 // Alternative solar field HTF type: Hitec Solar Salt
 NAMESPACE_TEST(csp_trough, EmpiricalTroughCmod, SolarSaltHtf_NoFinancial)
 {
@@ -154,6 +154,23 @@ NAMESPACE_TEST(csp_trough, PowerTroughCmod, Start_Stop_Initialize_Default_NoFina
 }
 
 
+// Receiver heat loss tables, annual energy within 1% of the detailed receiver model
+NAMESPACE_TEST(csp_trough, PowerTroughCmod, HeatLossSurrogate_NoFinancial)
+{
+    ssc_data_t defaults = trough_physical_defaults();
+    CmodUnderTest power_trough = CmodUnderTest("trough_physical", defaults);
+    int errors = power_trough.RunModule();
+    EXPECT_FALSE(errors);
+    double annual_energy_detailed = power_trough.GetOutput("annual_energy");
+
+    power_trough.SetInput("use_hl_surrogate", 1);
+    errors = power_trough.RunModule();
+    EXPECT_FALSE(errors);
+    if (!errors) {
+        EXPECT_NEAR_FRAC(power_trough.GetOutput("annual_energy"), annual_energy_detailed, kErrorToleranceHi);
+    }
+}
+
 NAMESPACE_TEST(csp_trough, PowerTroughCmod, Dispatch_Targets_Default_NoFinancial) {
 
     bool print_outputs = false; // True will make test fail to print output!
@@ -0,0 +1,97 @@
+/*
+BSD 3-Clause License
+
+Copyright Alliance for Sustainable Energy, LLC. See also https://github.com/NREL/ssc/blob/develop/LICENSE
+
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+   contributors may be used to endorse or promote products derived from
+   this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+
+#include <string>
+#include <gtest/gtest.h>
+
+#include "core.h"
+
+namespace {
+    var_info vtab_core_test[] = {
+    /*   VARTYPE           DATATYPE         NAME            LABEL         UNITS  META  GROUP  REQUIRED_IF        CONSTRAINTS           UI_HINTS*/
+        { SSC_INPUT,        SSC_NUMBER,      "mode",         "Mode",       "",    "",   "",    "*",               "INTEGER,MIN=0,MAX=3", "" },
+        { SSC_INPUT,        SSC_NUMBER,      "derate",       "Derate",     "",    "",   "",    "?=0.5",           "FACTOR",             "" },
+        { SSC_INPUT,        SSC_ARRAY,       "profile",      "Profile",    "",    "",   "",    "Mode=1|mode>2",   "LENGTH=3",           "" },
+        { SSC_OUTPUT,       SSC_ARRAY,       "gen",          "Gen",        "",    "",   "",    "*",               "",                   "" },
+        var_info_invalid };
+
+    class cm_core_test : public compute_module {
+    public:
+        cm_core_test() { add_var_info(vtab_core_test); }
+        void exec() override { allocate("gen", 3); }
+        bool compiled() { return has_info_map(); }
+    };
+
+    class core_test_handler : public handler_interface {
+    public:
+        explicit core_test_handler(compute_module *cm) : handler_interface(cm) {}
+        void on_log(const std::string &, int, float) override {}
+        bool on_update(const std::string &, float, float) override { return true; }
+    };
+
+    bool run_core_test(cm_core_test &cm, var_table &vt) {
+        core_test_handler h(&cm);
+        return cm.compute(&h, &vt);
+    }
+}
+
+TEST(compute_module_test, CompiledVarInfo) {
+    cm_core_test cm;
+    EXPECT_FALSE(cm.compiled());
+    EXPECT_TRUE(cm.has_info("profile"));
+    EXPECT_TRUE(cm.compiled());
+    EXPECT_TRUE(cm.is_ssc_array_output("GEN"));
+    EXPECT_FALSE(cm.is_ssc_array_output("profile"));
+    EXPECT_THROW(cm.info("missing"), general_error);
+
+    // default assigned, profile not required for mode 0
+    var_table vt;
+    vt.assign("mode", var_data((ssc_number_t)0));
+    EXPECT_TRUE(run_core_test(cm, vt));
+    EXPECT_DOUBLE_EQ(vt.lookup("derate")->num, 0.5);
+
+    // required_if expression and constraints evaluated for a second instance of the module
+    cm_core_test cm2;
+    vt.assign("mode", var_data((ssc_number_t)3));
+    EXPECT_FALSE(run_core_test(cm2, vt));
+    ssc_number_t profile[3] = { 1, 2, 3 };
+    vt.assign("profile", var_data(profile, 2));
+    EXPECT_FALSE(run_core_test(cm2, vt));
+    vt.assign("profile", var_data(profile, 3));
+    EXPECT_TRUE(run_core_test(cm2, vt));
+    vt.assign("mode", var_data((ssc_number_t)4));
+    EXPECT_FALSE(run_core_test(cm2, vt));
+    vt.assign("mode", var_data((ssc_number_t)1.5));
+    EXPECT_FALSE(run_core_test(cm2, vt));
+}
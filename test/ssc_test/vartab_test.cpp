@@ -70,3 +70,47 @@ TEST_F(vartab_test, test_resize) {
     ASSERT_EQ(mat.ncols(), 3);
     ASSERT_NEAR(mat.at(0, 0), 1.0, 0.001);
 }
+
+TEST_F(vartab_test, test_handle) {
+    var_handle h(var, "Value");
+    ASSERT_FALSE(h.is_assigned());
+    EXPECT_THROW(h.as_double(), general_error);
+
+    var->assign("value", var_data((ssc_number_t)2.0));
+    ASSERT_TRUE(h.is_assigned());
+    ASSERT_NEAR(h.as_double(), 2.0, 0.001);
+
+    // writes through the handle are seen by the table and vice versa
+    h.assign(var_data((ssc_number_t)3.0));
+    ASSERT_NEAR(var->as_double("value"), 3.0, 0.001);
+    var->assign("value", var_data((ssc_number_t)4.0));
+    ASSERT_EQ(h.as_integer(), 4);
+
+    // removing or renaming the variable is picked up on the next access
+    var->rename("value", "other");
+    ASSERT_FALSE(h.is_assigned());
+    var->allocate("value", 3);
+    size_t count = 0;
+    ssc_number_t* arr = h.as_array(&count);
+    ASSERT_EQ(count, 3);
+    ASSERT_EQ(arr, var->as_array("value", &count));
+    EXPECT_THROW(h.as_number(), cast_error);
+    var->unassign("value");
+    ASSERT_FALSE(h.is_assigned());
+}
+
+TEST_F(vartab_test, test_key) {
+    for (int i = 0; i < 10; i++)
+        var->assign("var" + std::to_string(i), var_data((ssc_number_t)i));
+
+    std::vector<std::string> keys;
+    for (const char* k = var->first(); k; k = var->next())
+        keys.push_back(k);
+    ASSERT_EQ(keys.size(), 10);
+
+    for (int i = 0; i < 10; i++)
+        ASSERT_EQ(keys[i], var->key(i));
+    ASSERT_EQ(keys[3], var->key(3));
+    ASSERT_EQ(keys[1], var->key(1));
+    ASSERT_EQ(var->key(10), nullptr);
+}